@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/Audio.h>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+
+namespace
+{
+    const unsigned int sampleRate = 44100;
+
+
+    ////////////////////////////////////////////////////////////
+    // Generate interleaved samples of a sine wave
+    ////////////////////////////////////////////////////////////
+    std::vector<sfInt16> makeSine(std::size_t frameCount, unsigned int channelCount, unsigned int rate)
+    {
+        std::vector<sfInt16> samples(frameCount * channelCount);
+        for (std::size_t i = 0; i < frameCount; ++i)
+        {
+            double value = std::sin(2 * 3.14159265358979323846 * 440 * static_cast<double>(i) / rate);
+            for (unsigned int c = 0; c < channelCount; ++c)
+                samples[i * channelCount + c] = static_cast<sfInt16>(value * 16000);
+        }
+        return samples;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Sound files of one second of stereo audio, encoded once and removed at exit
+    ////////////////////////////////////////////////////////////
+    class EncodedFiles
+    {
+    public:
+
+        ~EncodedFiles()
+        {
+            for (std::map<std::string, std::string>::const_iterator it = myFiles.begin(); it != myFiles.end(); ++it)
+            {
+                if (!it->second.empty())
+                    std::remove(it->second.c_str());
+            }
+        }
+
+        const char* get(const std::string& extension)
+        {
+            std::map<std::string, std::string>::iterator it = myFiles.find(extension);
+            if (it == myFiles.end())
+            {
+                std::string filename = bench::getTemporaryPath("sine." + extension);
+                std::vector<sfInt16> samples = makeSine(sampleRate, 2, sampleRate);
+
+                sfSoundBuffer* buffer = sfSoundBuffer_createFromSamples(&samples[0], samples.size(), 2, sampleRate);
+                if (!buffer || !sfSoundBuffer_saveToFile(buffer, filename.c_str()))
+                    filename.clear();
+                if (buffer)
+                    sfSoundBuffer_destroy(buffer);
+
+                it = myFiles.insert(std::make_pair(extension, filename)).first;
+            }
+
+            return it->second.empty() ? NULL : it->second.c_str();
+        }
+
+    private:
+
+        std::map<std::string, std::string> myFiles;
+    };
+
+    EncodedFiles encodedFiles;
+
+
+    ////////////////////////////////////////////////////////////
+    void runDecode(bench::State& state, const char* extension)
+    {
+        const char* filename = encodedFiles.get(extension);
+        if (!filename)
+        {
+            state.skip(std::string("failed to encode a .") + extension + " file");
+            return;
+        }
+
+        while (state.keepRunning())
+        {
+            sfSoundBuffer* buffer = sfSoundBuffer_createFromFile(filename);
+            bench::doNotOptimize(buffer);
+            if (buffer)
+                sfSoundBuffer_destroy(buffer);
+        }
+
+        state.setItemsPerIteration(sampleRate * 2);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void runConverter(bench::State& state, unsigned int inputChannels, unsigned int inputRate, unsigned int outputChannels, unsigned int outputRate)
+    {
+        const std::size_t frameCount = 4096;
+
+        sfAudioConverter* converter = sfAudioConverter_create(inputChannels, inputRate, outputChannels, outputRate);
+        std::vector<sfInt16> input = makeSine(frameCount, inputChannels, inputRate);
+        std::vector<sfInt16> output(sfAudioConverter_getOutputSampleCount(converter, input.size()) + outputChannels * 64);
+
+        while (state.keepRunning())
+            bench::doNotOptimize(sfAudioConverter_convert(converter, &input[0], input.size(), &output[0], output.size()));
+
+        sfAudioConverter_destroy(converter);
+
+        // Throughput in input samples per second
+        state.setItemsPerIteration(static_cast<double>(input.size()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Decoding (one second of 44.1 kHz stereo audio per iteration)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchDecodeWav, "Audio/Decode/wav")
+{
+    runDecode(state, "wav");
+}
+
+CSFML_BENCHMARK(benchDecodeOgg, "Audio/Decode/ogg")
+{
+    runDecode(state, "ogg");
+}
+
+CSFML_BENCHMARK(benchDecodeFlac, "Audio/Decode/flac")
+{
+    runDecode(state, "flac");
+}
+
+
+////////////////////////////////////////////////////////////
+// Channel mixing and resampling
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchConvertRemix, "Audio/AudioConverter/remix6To2")
+{
+    runConverter(state, 6, 48000, 2, 48000);
+}
+
+CSFML_BENCHMARK(benchConvertUpmix, "Audio/AudioConverter/remix1To2")
+{
+    runConverter(state, 1, 48000, 2, 48000);
+}
+
+CSFML_BENCHMARK(benchConvertResample, "Audio/AudioConverter/resample44To48")
+{
+    runConverter(state, 2, 44100, 2, 48000);
+}
+
+CSFML_BENCHMARK(benchConvertResampleMono, "Audio/AudioConverter/resample22MonoTo48Stereo")
+{
+    runConverter(state, 1, 22050, 2, 48000);
+}
+
+CSFML_BENCHMARK(benchCreateResampled, "Audio/SoundBuffer/createResampled")
+{
+    std::vector<sfInt16> samples = makeSine(sampleRate, 2, sampleRate);
+    sfSoundBuffer* buffer = sfSoundBuffer_createFromSamples(&samples[0], samples.size(), 2, sampleRate);
+    if (!buffer)
+    {
+        state.skip("failed to create a sound buffer");
+        return;
+    }
+
+    while (state.keepRunning())
+    {
+        sfSoundBuffer* resampled = sfSoundBuffer_createResampled(buffer, 2, 48000);
+        bench::doNotOptimize(resampled);
+        if (resampled)
+            sfSoundBuffer_destroy(resampled);
+    }
+
+    sfSoundBuffer_destroy(buffer);
+    state.setItemsPerIteration(static_cast<double>(samples.size()));
+}
+
+
+////////////////////////////////////////////////////////////
+// Analysis
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchAnalyzerProcess, "Audio/AudioAnalyzer/process")
+{
+    sfAudioAnalyzer* analyzer = sfAudioAnalyzer_create(2, 48000, 0, sfAudioWindowHann);
+    std::vector<sfInt16> samples = makeSine(4096, 2, 48000);
+
+    while (state.keepRunning())
+        sfAudioAnalyzer_process(analyzer, &samples[0], samples.size());
+
+    sfAudioAnalyzer_destroy(analyzer);
+    state.setItemsPerIteration(static_cast<double>(samples.size()));
+}
+
+CSFML_BENCHMARK(benchAnalyzerSpectrum, "Audio/AudioAnalyzer/spectrum2048")
+{
+    sfAudioAnalyzer* analyzer = sfAudioAnalyzer_create(2, 48000, 2048, sfAudioWindowHann);
+    std::vector<sfInt16> samples = makeSine(2048, 2, 48000);
+    std::vector<float> magnitudes(2048 / 2 + 1);
+
+    while (state.keepRunning())
+        sfAudioAnalyzer_computeSpectrum(analyzer, &samples[0], samples.size(), &magnitudes[0]);
+
+    sfAudioAnalyzer_destroy(analyzer);
+    state.setItemsPerIteration(1);
+}
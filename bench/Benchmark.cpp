@@ -0,0 +1,487 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/Config.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    const void* volatile escapeSink = NULL;
+
+
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::string     name;
+        bench::Function function;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    struct Result
+    {
+        std::string name;
+        std::string skipReason;
+        std::size_t iterations;
+        double      median;
+        double      minimum;
+        double      maximum;
+        double      items;
+        double      bytes;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry>& getRegistry()
+    {
+        static std::vector<Entry> registry;
+        return registry;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::map<std::string, std::string>& getOptions()
+    {
+        static std::map<std::string, std::string> options;
+        return options;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    double now()
+    {
+        typedef std::chrono::steady_clock Clock;
+        return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    const char* systemName()
+    {
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        return "Windows";
+    #elif defined(CSFML_SYSTEM_LINUX)
+        return "Linux";
+    #elif defined(CSFML_SYSTEM_MACOS)
+        return "macOS";
+    #else
+        return "FreeBSD";
+    #endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void writeJsonString(std::FILE* file, const std::string& string)
+    {
+        std::fputc('"', file);
+        for (std::size_t i = 0; i < string.size(); ++i)
+        {
+            unsigned char c = static_cast<unsigned char>(string[i]);
+            if ((c == '"') || (c == '\\'))
+                std::fprintf(file, "\\%c", c);
+            else if (c < 0x20)
+                std::fprintf(file, "\\u%04x", c);
+            else
+                std::fputc(c, file);
+        }
+        std::fputc('"', file);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void writeJsonNumber(std::FILE* file, double value)
+    {
+        if (value > 0)
+            std::fprintf(file, "%.6g", value);
+        else
+            std::fprintf(file, "null");
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void writeJson(std::FILE* file, const std::vector<Result>& results, unsigned int samples, double minTime)
+    {
+        std::fprintf(file, "{\n");
+        std::fprintf(file, "  \"csfml_version\": \"%d.%d.%d\",\n", CSFML_VERSION_MAJOR, CSFML_VERSION_MINOR, CSFML_VERSION_PATCH);
+        std::fprintf(file, "  \"system\": \"%s\",\n", systemName());
+        std::fprintf(file, "  \"samples\": %u,\n", samples);
+        std::fprintf(file, "  \"min_sample_time_ms\": %g,\n", minTime * 1000);
+        std::fprintf(file, "  \"benchmarks\": [");
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& result = results[i];
+
+            std::fprintf(file, "%s\n    {\n      \"name\": ", (i > 0) ? "," : "");
+            writeJsonString(file, result.name);
+            std::fprintf(file, ",\n      \"skipped\": ");
+            if (result.skipReason.empty())
+                std::fprintf(file, "null");
+            else
+                writeJsonString(file, result.skipReason);
+            std::fprintf(file, ",\n      \"iterations\": %lu", static_cast<unsigned long>(result.iterations));
+            std::fprintf(file, ",\n      \"ns_per_iteration\": { \"median\": ");
+            writeJsonNumber(file, result.median * 1e9);
+            std::fprintf(file, ", \"min\": ");
+            writeJsonNumber(file, result.minimum * 1e9);
+            std::fprintf(file, ", \"max\": ");
+            writeJsonNumber(file, result.maximum * 1e9);
+            std::fprintf(file, " },\n      \"items_per_second\": ");
+            writeJsonNumber(file, (result.median > 0) ? result.items / result.median : 0);
+            std::fprintf(file, ",\n      \"bytes_per_second\": ");
+            writeJsonNumber(file, (result.median > 0) ? result.bytes / result.median : 0);
+            std::fprintf(file, "\n    }");
+        }
+
+        std::fprintf(file, "\n  ]\n}\n");
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void printResult(const Result& result)
+    {
+        if (!result.skipReason.empty())
+        {
+            std::printf("%-52s skipped: %s\n", result.name.c_str(), result.skipReason.c_str());
+            return;
+        }
+
+        std::printf("%-52s %14.1f ns", result.name.c_str(), result.median * 1e9);
+        if (result.items > 0)
+            std::printf("  %12.4g items/s", result.items / result.median);
+        if (result.bytes > 0)
+            std::printf("  %10.2f MiB/s", result.bytes / result.median / (1024 * 1024));
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void printUsage(const char* program)
+    {
+        std::printf("Usage: %s [options]\n"
+                    "  --filter <text>   Run only the benchmarks whose name contains <text>\n"
+                    "  --list            List the benchmarks and exit\n"
+                    "  --json <file>     Write the results as JSON to <file> (- for the standard output)\n"
+                    "  --samples <n>     Number of measured samples per benchmark (default: 5)\n"
+                    "  --min-time <ms>   Minimum duration of a sample, in milliseconds (default: 50)\n"
+                    "  --font <file>     Font used by the text benchmarks\n", program);
+    }
+}
+
+
+namespace bench
+{
+////////////////////////////////////////////////////////////
+State::State(std::size_t iterations) :
+myIterations(iterations),
+myRemaining (iterations),
+myStarted   (false),
+myFinished  (false),
+myElapsed   (0),
+myPauseStart(0),
+myItems     (0),
+myBytes     (0)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool State::keepRunning()
+{
+    if (!myStarted)
+    {
+        myStarted = true;
+        myElapsed = -now();
+    }
+
+    if (myRemaining > 0)
+    {
+        --myRemaining;
+        return true;
+    }
+
+    myElapsed += now();
+    myFinished = true;
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t State::getIterations() const
+{
+    return myIterations;
+}
+
+
+////////////////////////////////////////////////////////////
+void State::pauseTiming()
+{
+    myPauseStart = now();
+}
+
+
+////////////////////////////////////////////////////////////
+void State::resumeTiming()
+{
+    myElapsed -= now() - myPauseStart;
+}
+
+
+////////////////////////////////////////////////////////////
+void State::setItemsPerIteration(double items)
+{
+    myItems = items;
+}
+
+
+////////////////////////////////////////////////////////////
+void State::setBytesPerIteration(double bytes)
+{
+    myBytes = bytes;
+}
+
+
+////////////////////////////////////////////////////////////
+void State::skip(const std::string& reason)
+{
+    mySkipReason = reason;
+}
+
+
+////////////////////////////////////////////////////////////
+// Runs the benchmarks and measures them
+////////////////////////////////////////////////////////////
+class Runner
+{
+public:
+
+    Runner(unsigned int samples, double minTime) :
+    mySamples(samples),
+    myMinTime(minTime)
+    {
+    }
+
+    Result run(const Entry& entry) const
+    {
+        Result result;
+        result.name       = entry.name;
+        result.iterations = 0;
+        result.median     = 0;
+        result.minimum    = 0;
+        result.maximum    = 0;
+        result.items      = 0;
+        result.bytes      = 0;
+
+        // Find a number of iterations that lasts at least the minimum sample time
+        std::size_t iterations = 1;
+        for (;;)
+        {
+            State state(iterations);
+            entry.function(state);
+
+            if (!state.mySkipReason.empty() || !state.myFinished)
+            {
+                result.skipReason = state.mySkipReason.empty() ? "the benchmark didn't run its loop" : state.mySkipReason;
+                return result;
+            }
+
+            if ((state.myElapsed >= myMinTime) || (iterations >= (std::size_t(1) << 40)))
+                break;
+
+            double factor = (state.myElapsed > 0) ? myMinTime * 1.4 / state.myElapsed : 10;
+            factor = std::max(2.0, std::min(factor, 10.0));
+            iterations = static_cast<std::size_t>(iterations * factor);
+        }
+
+        // Measure the samples
+        std::vector<double> times;
+        for (unsigned int i = 0; i < mySamples; ++i)
+        {
+            State state(iterations);
+            entry.function(state);
+            times.push_back(state.myElapsed / iterations);
+            result.items = state.myItems;
+            result.bytes = state.myBytes;
+        }
+
+        std::sort(times.begin(), times.end());
+        result.iterations = iterations;
+        result.median     = times[times.size() / 2];
+        result.minimum    = times.front();
+        result.maximum    = times.back();
+
+        return result;
+    }
+
+private:
+
+    unsigned int mySamples;
+    double       myMinTime;
+};
+
+
+////////////////////////////////////////////////////////////
+Registration::Registration(const char* name, Function function)
+{
+    Entry entry;
+    entry.name     = name;
+    entry.function = function;
+    getRegistry().push_back(entry);
+}
+
+
+////////////////////////////////////////////////////////////
+const char* getOption(const char* name)
+{
+    std::map<std::string, std::string>::const_iterator it = getOptions().find(name);
+    return (it != getOptions().end()) ? it->second.c_str() : NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+std::string getTemporaryPath(const std::string& filename)
+{
+    const char* variables[] = {"TMPDIR", "TEMP", "TMP"};
+    for (std::size_t i = 0; i < sizeof(variables) / sizeof(*variables); ++i)
+    {
+        const char* directory = std::getenv(variables[i]);
+        if (directory && *directory)
+            return std::string(directory) + "/csfml-bench-" + filename;
+    }
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    return "csfml-bench-" + filename;
+#else
+    return "/tmp/csfml-bench-" + filename;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void escape(const void* pointer)
+{
+    escapeSink = pointer;
+}
+
+} // namespace bench
+
+
+////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::string  filter;
+    std::string  jsonFile;
+    bool         list    = false;
+    unsigned int samples = 5;
+    double       minTime = 0.05;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        if (argument == "--list")
+        {
+            list = true;
+        }
+        else if ((argument.size() > 2) && (argument.compare(0, 2, "--") == 0) && (argument != "--help") && (i + 1 < argc))
+        {
+            std::string name = argument.substr(2);
+            std::string value = argv[++i];
+
+            if (name == "filter")
+                filter = value;
+            else if (name == "json")
+                jsonFile = value;
+            else if (name == "samples")
+                samples = std::max(1, std::atoi(value.c_str()));
+            else if (name == "min-time")
+                minTime = std::max(1.0, std::atof(value.c_str())) / 1000;
+            else
+                getOptions()[name] = value;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return (argument == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    // Run the benchmarks in name order, so that the output is stable
+    std::vector<Entry> entries;
+    for (std::size_t i = 0; i < getRegistry().size(); ++i)
+    {
+        if (getRegistry()[i].name.find(filter) != std::string::npos)
+            entries.push_back(getRegistry()[i]);
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) { return left.name < right.name; });
+
+    if (list)
+    {
+        for (std::size_t i = 0; i < entries.size(); ++i)
+            std::printf("%s\n", entries[i].name.c_str());
+        return EXIT_SUCCESS;
+    }
+
+    // When the JSON goes to the standard output, don't mix it with the table
+    bool printTable = (jsonFile != "-");
+
+    bench::Runner runner(samples, minTime);
+    std::vector<Result> results;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        results.push_back(runner.run(entries[i]));
+        if (printTable)
+            printResult(results.back());
+    }
+
+    if (!jsonFile.empty())
+    {
+        std::FILE* file = (jsonFile == "-") ? stdout : std::fopen(jsonFile.c_str(), "w");
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open %s for writing\n", jsonFile.c_str());
+            return EXIT_FAILURE;
+        }
+
+        writeJson(file, results, samples, minTime);
+
+        if (file != stdout)
+            std::fclose(file);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_BENCHMARK_HPP
+#define SFML_BENCHMARK_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string>
+#include <cstddef>
+
+
+namespace bench
+{
+////////////////////////////////////////////////////////////
+// State of a running benchmark
+//
+// A benchmark function does its setup, then runs the measured
+// code in a "while (state.keepRunning())" loop. Only the loop
+// is timed: it starts with the first call to keepRunning and
+// stops when keepRunning returns false.
+////////////////////////////////////////////////////////////
+class State
+{
+public:
+
+    explicit State(std::size_t iterations);
+
+    ////////////////////////////////////////////////////////////
+    // Return true while there are iterations left to run
+    ////////////////////////////////////////////////////////////
+    bool keepRunning();
+
+    ////////////////////////////////////////////////////////////
+    // Number of iterations of this run
+    ////////////////////////////////////////////////////////////
+    std::size_t getIterations() const;
+
+    ////////////////////////////////////////////////////////////
+    // Exclude the code between the two calls from the timing
+    ////////////////////////////////////////////////////////////
+    void pauseTiming();
+    void resumeTiming();
+
+    ////////////////////////////////////////////////////////////
+    // Report throughput: number of items / bytes processed by one iteration
+    ////////////////////////////////////////////////////////////
+    void setItemsPerIteration(double items);
+    void setBytesPerIteration(double bytes);
+
+    ////////////////////////////////////////////////////////////
+    // Mark the benchmark as skipped, and return without running the loop
+    ////////////////////////////////////////////////////////////
+    void skip(const std::string& reason);
+
+private:
+
+    friend class Runner;
+
+    std::size_t myIterations;
+    std::size_t myRemaining;
+    bool        myStarted;
+    bool        myFinished;
+    double      myElapsed;
+    double      myPauseStart;
+    double      myItems;
+    double      myBytes;
+    std::string mySkipReason;
+};
+
+
+////////////////////////////////////////////////////////////
+// Signature of a benchmark function
+////////////////////////////////////////////////////////////
+typedef void (*Function)(State& state);
+
+
+////////////////////////////////////////////////////////////
+// Register a benchmark; use the CSFML_BENCHMARK macro instead
+////////////////////////////////////////////////////////////
+struct Registration
+{
+    Registration(const char* name, Function function);
+};
+
+
+////////////////////////////////////////////////////////////
+// Return the value of a command line option (--name value), or NULL
+////////////////////////////////////////////////////////////
+const char* getOption(const char* name);
+
+
+////////////////////////////////////////////////////////////
+// Return the path of a file in the temporary directory
+////////////////////////////////////////////////////////////
+std::string getTemporaryPath(const std::string& filename);
+
+
+////////////////////////////////////////////////////////////
+// Force the compiler to compute a value that is otherwise unused
+////////////////////////////////////////////////////////////
+void escape(const void* pointer);
+
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+    escape(&value);
+#endif
+}
+
+} // namespace bench
+
+
+////////////////////////////////////////////////////////////
+// Define and register a benchmark
+//
+// Usage:
+// CSFML_BENCHMARK(benchClockRestart, "System/Clock/restart")
+// {
+//     sfClock* clock = sfClock_create();
+//     while (state.keepRunning())
+//         bench::doNotOptimize(sfClock_restart(clock));
+//     sfClock_destroy(clock);
+// }
+////////////////////////////////////////////////////////////
+#define CSFML_BENCHMARK(function, name) \
+    static void function(bench::State& state); \
+    static bench::Registration function##Registration(name, function); \
+    static void function(bench::State& state)
+
+
+#endif // SFML_BENCHMARK_HPP
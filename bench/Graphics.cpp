@@ -0,0 +1,1185 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/Graphics.h>
+#include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Create the render target of the draw benchmarks, or skip the benchmark
+    ////////////////////////////////////////////////////////////
+    sfRenderTexture* createRenderTexture(bench::State& state)
+    {
+        if (!sfContext_isAvailable())
+        {
+            state.skip("OpenGL contexts are not available (no display)");
+            return NULL;
+        }
+
+        sfRenderTexture* renderTexture = sfRenderTexture_create(512, 512, sfFalse);
+        if (!renderTexture)
+            state.skip("failed to create the render texture");
+        else
+            sfRenderTexture_clear(renderTexture, sfBlack);
+
+        return renderTexture;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Create an image that compresses like a screenshot: flat
+    // areas, gradients and some detail
+    ////////////////////////////////////////////////////////////
+    sfImage* createScreenshot(unsigned int width, unsigned int height)
+    {
+        std::vector<sfUint8> pixels(width * height * 4);
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                sfUint8* pixel = &pixels[(y * width + x) * 4];
+                pixel[0] = static_cast<sfUint8>((x / 16) * 8);
+                pixel[1] = static_cast<sfUint8>(y / 3);
+                pixel[2] = static_cast<sfUint8>(((x * y) >> 7) & 0xF0);
+                pixel[3] = 255;
+            }
+        }
+
+        return sfImage_createFromPixels(width, height, &pixels[0]);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void benchSaveToMemory(bench::State& state, sfImageFormat format)
+    {
+        sfImage* image = createScreenshot(1280, 720);
+
+        while (state.keepRunning())
+        {
+            size_t size = 0;
+            void* data = sfImage_saveToMemory(image, format, &size);
+            bench::doNotOptimize(data);
+            sfFree(data);
+        }
+
+        sfImage_destroy(image);
+        state.setBytesPerIteration(1280 * 720 * 4);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Compress an image to BC1 blocks with a quick bounding box
+    // encoder, good enough to give the blocks realistic content
+    ////////////////////////////////////////////////////////////
+    std::vector<sfUint8> compressBc1(const sfImage* image)
+    {
+        sfVector2u size = sfImage_getSize(image);
+        const sfUint8* pixels = sfImage_getPixelsPtr(image);
+        std::vector<sfUint8> blocks;
+
+        for (unsigned int blockY = 0; blockY < size.y; blockY += 4)
+        {
+            for (unsigned int blockX = 0; blockX < size.x; blockX += 4)
+            {
+                int low[3] = {255, 255, 255};
+                int high[3] = {0, 0, 0};
+                for (unsigned int i = 0; i < 16; ++i)
+                {
+                    const sfUint8* pixel = &pixels[(std::min(blockY + i / 4, size.y - 1) * size.x + std::min(blockX + i % 4, size.x - 1)) * 4];
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        low[c] = std::min(low[c], static_cast<int>(pixel[c]));
+                        high[c] = std::max(high[c], static_cast<int>(pixel[c]));
+                    }
+                }
+
+                sfUint16 color0 = static_cast<sfUint16>(((high[0] >> 3) << 11) | ((high[1] >> 2) << 5) | (high[2] >> 3));
+                sfUint16 color1 = static_cast<sfUint16>(((low[0] >> 3) << 11) | ((low[1] >> 2) << 5) | (low[2] >> 3));
+
+                // Project the pixels on the diagonal of the box; the palette is
+                // ordered high, low, 2/3 high, 1/3 high (when color0 > color1)
+                const sfUint32 order[4] = {1, 3, 2, 0};
+                int axis[3] = {high[0] - low[0], high[1] - low[1], high[2] - low[2]};
+                int length = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+                sfUint32 indices = 0;
+                for (unsigned int i = 0; (i < 16) && (color0 > color1); ++i)
+                {
+                    const sfUint8* pixel = &pixels[(std::min(blockY + i / 4, size.y - 1) * size.x + std::min(blockX + i % 4, size.x - 1)) * 4];
+                    int projection = 0;
+                    for (int c = 0; c < 3; ++c)
+                        projection += (pixel[c] - low[c]) * axis[c];
+                    indices |= order[(projection * 3 + length / 2) / length] << (i * 2);
+                }
+
+                const sfUint8 block[8] = {static_cast<sfUint8>(color0), static_cast<sfUint8>(color0 >> 8),
+                                          static_cast<sfUint8>(color1), static_cast<sfUint8>(color1 >> 8),
+                                          static_cast<sfUint8>(indices), static_cast<sfUint8>(indices >> 8),
+                                          static_cast<sfUint8>(indices >> 16), static_cast<sfUint8>(indices >> 24)};
+                blocks.insert(blocks.end(), block, block + 8);
+            }
+        }
+
+        return blocks;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void write32(std::vector<sfUint8>& file, std::size_t offset, sfUint32 value)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+            file[offset + i] = static_cast<sfUint8>(value >> (i * 8));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Wrap BC1 blocks in a DDS file
+    ////////////////////////////////////////////////////////////
+    std::vector<sfUint8> createDds(unsigned int width, unsigned int height, const std::vector<sfUint8>& blocks)
+    {
+        std::vector<sfUint8> file(128, 0);
+        write32(file, 0, 0x20534444); // "DDS "
+        write32(file, 4, 124);
+        write32(file, 8, 0x1007);
+        write32(file, 12, height);
+        write32(file, 16, width);
+        write32(file, 76, 32);
+        write32(file, 80, 0x4);
+        write32(file, 84, 0x31545844); // "DXT1"
+        file.insert(file.end(), blocks.begin(), blocks.end());
+
+        return file;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Wrap BC1 blocks in a KTX 1 file
+    ////////////////////////////////////////////////////////////
+    std::vector<sfUint8> createKtx(unsigned int width, unsigned int height, const std::vector<sfUint8>& blocks)
+    {
+        const sfUint8 identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+        std::vector<sfUint8> file(68, 0);
+        std::copy(identifier, identifier + 12, file.begin());
+        write32(file, 12, 0x04030201);
+        write32(file, 20, 1);
+        write32(file, 28, 0x83F1); // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+        write32(file, 36, width);
+        write32(file, 40, height);
+        write32(file, 52, 1);
+        write32(file, 56, 1);
+        write32(file, 64, static_cast<sfUint32>(blocks.size()));
+        file.insert(file.end(), blocks.begin(), blocks.end());
+
+        return file;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Create a texture from a file in memory in a loop
+    ////////////////////////////////////////////////////////////
+    void benchTextureLoad(bench::State& state, sfTexture* (*load)(const void*, size_t), const std::vector<sfUint8>& file)
+    {
+        if (!sfContext_isAvailable())
+        {
+            state.skip("OpenGL contexts are not available (no display)");
+            return;
+        }
+
+        while (state.keepRunning())
+            sfTexture_destroy(load(&file[0], file.size()));
+
+        state.setBytesPerIteration(1280 * 720 * 4);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTexture* createFromPngMemory(const void* data, size_t sizeInBytes)
+    {
+        return sfTexture_createFromMemory(data, sizeInBytes, NULL);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Fragment shader with the parameters of a typical material,
+    // used by the uniform and shader library benchmarks
+    ////////////////////////////////////////////////////////////
+    const unsigned int materialUniformCount = 16;
+
+    std::string getMaterialSource()
+    {
+        std::string source;
+        for (unsigned int i = 0; i < materialUniformCount; ++i)
+            source += "uniform vec4 parameter" + std::to_string(i) + ";\n";
+        source += "void main()\n{\n    gl_FragColor = vec4(0.0)";
+        for (unsigned int i = 0; i < materialUniformCount; ++i)
+            source += " + parameter" + std::to_string(i);
+        source += ";\n}\n";
+
+        return source;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Shader of the uniform benchmarks; skip the benchmark if it
+    // can't be created
+    ////////////////////////////////////////////////////////////
+    sfShader* createMaterialShader(bench::State& state, sfRenderTexture*& renderTexture)
+    {
+        // Uniforms are set while a render target is active, as when drawing
+        renderTexture = createRenderTexture(state);
+        if (!renderTexture)
+            return NULL;
+
+        sfRenderTexture_setActive(renderTexture, sfTrue);
+        if (!sfShader_isAvailable())
+        {
+            state.skip("shaders are not available");
+            return NULL;
+        }
+
+        sfShader* shader = sfShader_createFromMemory(NULL, NULL, getMaterialSource().c_str());
+        if (!shader)
+            state.skip("failed to compile the shader");
+
+        return shader;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Active render target of the shader library benchmarks, or
+    // skip the benchmark if shaders are not available
+    ////////////////////////////////////////////////////////////
+    sfRenderTexture* createShaderTarget(bench::State& state)
+    {
+        sfRenderTexture* renderTexture = createRenderTexture(state);
+        if (!renderTexture)
+            return NULL;
+
+        sfRenderTexture_setActive(renderTexture, sfTrue);
+        if (!sfShader_isAvailable())
+        {
+            state.skip("shaders are not available");
+            sfRenderTexture_destroy(renderTexture);
+            return NULL;
+        }
+
+        return renderTexture;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfGlslVec4 getMaterialParameter(unsigned int index, unsigned int frame)
+    {
+        sfGlslVec4 parameter = {static_cast<float>(index), static_cast<float>(frame), 0.5f, 1.f};
+        return parameter;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Load the font of the text benchmarks, or skip the benchmark
+    ////////////////////////////////////////////////////////////
+    sfFont* createFont(bench::State& state)
+    {
+        const char* candidates[] =
+        {
+            bench::getOption("font"),
+            "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+            "/usr/share/fonts/TTF/DejaVuSans.ttf",
+            "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+            "/Library/Fonts/Arial.ttf",
+            "C:/Windows/Fonts/arial.ttf"
+        };
+
+        for (std::size_t i = 0; i < sizeof(candidates) / sizeof(*candidates); ++i)
+        {
+            if (!candidates[i])
+                continue;
+
+            // Check that the file exists first, to avoid SFML's error message
+            std::FILE* file = std::fopen(candidates[i], "rb");
+            if (file)
+            {
+                std::fclose(file);
+                sfFont* font = sfFont_createFromFile(candidates[i]);
+                if (font)
+                    return font;
+            }
+        }
+
+        state.skip("no font found, use --font <file>");
+        return NULL;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::vector<sfColor> makeColors(std::size_t count)
+    {
+        std::vector<sfColor> colors(count);
+        for (std::size_t i = 0; i < count; ++i)
+            colors[i] = sfColor_fromInteger(static_cast<sfUint32>(i * 2654435761u));
+        return colors;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::vector<sfVector2f> makePoints(std::size_t count)
+    {
+        std::vector<sfVector2f> points(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            points[i].x = static_cast<float>((i * 37) % 200);
+            points[i].y = static_cast<float>((i * 91) % 200);
+        }
+        return points;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfFloatRect makeRect()
+    {
+        sfFloatRect rect = {50.f, 50.f, 100.f, 100.f};
+        return rect;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Value types: exported functions against their inline and array versions
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchColorModulate, "Graphics/Color/modulate")
+{
+    std::vector<sfColor> colors = makeColors(1024);
+    sfColor tint = sfColor_fromRGBA(255, 128, 64, 200);
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            colors[i] = sfColor_modulate(colors[i], tint);
+        bench::doNotOptimize(colors[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(colors.size()));
+}
+
+CSFML_BENCHMARK(benchColorModulateInline, "Graphics/Color/modulateInline")
+{
+    std::vector<sfColor> colors = makeColors(1024);
+    sfColor tint = sfColor_fromRGBA(255, 128, 64, 200);
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            colors[i] = sfColor_modulateInline(colors[i], tint);
+        bench::doNotOptimize(colors[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(colors.size()));
+}
+
+CSFML_BENCHMARK(benchColorModulateArray, "Graphics/Color/modulateArray")
+{
+    std::vector<sfColor> colors = makeColors(1024);
+    sfColor tint = sfColor_fromRGBA(255, 128, 64, 200);
+
+    while (state.keepRunning())
+    {
+        sfColor_modulateArray(&colors[0], colors.size(), tint);
+        bench::doNotOptimize(colors[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(colors.size()));
+}
+
+CSFML_BENCHMARK(benchColorAdd, "Graphics/Color/add")
+{
+    std::vector<sfColor> colors = makeColors(1024);
+    sfColor offset = sfColor_fromRGBA(1, 2, 3, 0);
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            colors[i] = sfColor_add(colors[i], offset);
+        bench::doNotOptimize(colors[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(colors.size()));
+}
+
+CSFML_BENCHMARK(benchColorAddInline, "Graphics/Color/addInline")
+{
+    std::vector<sfColor> colors = makeColors(1024);
+    sfColor offset = sfColor_fromRGBA(1, 2, 3, 0);
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            colors[i] = sfColor_addInline(colors[i], offset);
+        bench::doNotOptimize(colors[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(colors.size()));
+}
+
+CSFML_BENCHMARK(benchRectContains, "Graphics/Rect/contains")
+{
+    std::vector<sfVector2f> points = makePoints(1024);
+    sfFloatRect rect = makeRect();
+
+    while (state.keepRunning())
+    {
+        std::size_t inside = 0;
+        for (std::size_t i = 0; i < points.size(); ++i)
+            inside += sfFloatRect_contains(&rect, points[i].x, points[i].y);
+        bench::doNotOptimize(inside);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(points.size()));
+}
+
+CSFML_BENCHMARK(benchRectContainsInline, "Graphics/Rect/containsInline")
+{
+    std::vector<sfVector2f> points = makePoints(1024);
+    sfFloatRect rect = makeRect();
+
+    while (state.keepRunning())
+    {
+        std::size_t inside = 0;
+        for (std::size_t i = 0; i < points.size(); ++i)
+            inside += sfFloatRect_containsInline(&rect, points[i].x, points[i].y);
+        bench::doNotOptimize(inside);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(points.size()));
+}
+
+CSFML_BENCHMARK(benchRectContainsPoints, "Graphics/Rect/containsPoints")
+{
+    std::vector<sfVector2f> points = makePoints(1024);
+    std::vector<sfBool> results(points.size());
+    sfFloatRect rect = makeRect();
+
+    while (state.keepRunning())
+        bench::doNotOptimize(sfFloatRect_containsPoints(&rect, &points[0], points.size(), &results[0]));
+
+    state.setItemsPerIteration(static_cast<double>(points.size()));
+}
+
+CSFML_BENCHMARK(benchRectIntersects, "Graphics/Rect/intersects")
+{
+    sfFloatRect rect1 = makeRect();
+    sfFloatRect rect2 = {120.f, 80.f, 60.f, 60.f};
+    sfFloatRect overlap;
+
+    while (state.keepRunning())
+    {
+        bench::doNotOptimize(sfFloatRect_intersects(&rect1, &rect2, &overlap));
+        rect2.left += 0.001f;
+    }
+}
+
+CSFML_BENCHMARK(benchRectIntersectsInline, "Graphics/Rect/intersectsInline")
+{
+    sfFloatRect rect1 = makeRect();
+    sfFloatRect rect2 = {120.f, 80.f, 60.f, 60.f};
+    sfFloatRect overlap;
+
+    while (state.keepRunning())
+    {
+        bench::doNotOptimize(sfFloatRect_intersectsInline(&rect1, &rect2, &overlap));
+        rect2.left += 0.001f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Wrapper overhead
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchConvertRenderStates, "Graphics/RenderStates/convert")
+{
+    sfRenderStates states;
+    states.blendMode = sfBlendAlpha;
+    states.transform = sfTransform_Identity;
+    states.texture   = NULL;
+    states.shader    = NULL;
+
+    while (state.keepRunning())
+    {
+        sf::RenderStates converted = convertRenderStates(&states);
+        bench::doNotOptimize(converted);
+        states.transform.matrix[2] += 1.f;
+    }
+}
+
+CSFML_BENCHMARK(benchTransformTransformPoint, "Graphics/Transform/transformPoint")
+{
+    sfTransform transform = sfTransform_Identity;
+    sfTransform_rotate(&transform, 30.f);
+    sfVector2f point = {10.f, 20.f};
+
+    while (state.keepRunning())
+    {
+        bench::doNotOptimize(sfTransform_transformPoint(&transform, point));
+        point.x += 1.f;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Image operations (512x512 RGBA)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchImageCreateFromColor, "Graphics/Image/createFromColor")
+{
+    while (state.keepRunning())
+    {
+        sfImage* image = sfImage_createFromColor(512, 512, sfRed);
+        bench::doNotOptimize(image);
+        sfImage_destroy(image);
+    }
+
+    state.setBytesPerIteration(512 * 512 * 4);
+}
+
+CSFML_BENCHMARK(benchImageFlipHorizontally, "Graphics/Image/flipHorizontally")
+{
+    sfImage* image = sfImage_createFromColor(512, 512, sfRed);
+
+    while (state.keepRunning())
+        sfImage_flipHorizontally(image);
+
+    sfImage_destroy(image);
+    state.setBytesPerIteration(512 * 512 * 4);
+}
+
+CSFML_BENCHMARK(benchImageFlipVertically, "Graphics/Image/flipVertically")
+{
+    sfImage* image = sfImage_createFromColor(512, 512, sfRed);
+
+    while (state.keepRunning())
+        sfImage_flipVertically(image);
+
+    sfImage_destroy(image);
+    state.setBytesPerIteration(512 * 512 * 4);
+}
+
+CSFML_BENCHMARK(benchImageCreateMaskFromColor, "Graphics/Image/createMaskFromColor")
+{
+    sfImage* image = sfImage_createFromColor(512, 512, sfMagenta);
+
+    while (state.keepRunning())
+        sfImage_createMaskFromColor(image, sfMagenta, 0);
+
+    sfImage_destroy(image);
+    state.setBytesPerIteration(512 * 512 * 4);
+}
+
+CSFML_BENCHMARK(benchImageCopyImage, "Graphics/Image/copyImage")
+{
+    sfImage* image = sfImage_createFromColor(512, 512, sfBlack);
+    sfImage* source = sfImage_createFromColor(256, 256, sfColor_fromRGBA(255, 0, 0, 128));
+    sfIntRect area = {0, 0, 0, 0};
+
+    while (state.keepRunning())
+        sfImage_copyImage(image, source, 128, 128, area, sfTrue);
+
+    sfImage_destroy(source);
+    sfImage_destroy(image);
+    state.setBytesPerIteration(256 * 256 * 4);
+}
+
+CSFML_BENCHMARK(benchImageSetPixel, "Graphics/Image/setPixel")
+{
+    sfImage* image = sfImage_createFromColor(512, 512, sfBlack);
+
+    while (state.keepRunning())
+    {
+        for (unsigned int y = 0; y < 64; ++y)
+            for (unsigned int x = 0; x < 64; ++x)
+                sfImage_setPixel(image, x, y, sfWhite);
+    }
+
+    sfImage_destroy(image);
+    state.setItemsPerIteration(64 * 64);
+}
+
+
+////////////////////////////////////////////////////////////
+// Image encoding (1280x720 RGBA)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchImageSaveToMemoryPng, "Graphics/Image/saveToMemoryPng")
+{
+    benchSaveToMemory(state, sfImageFormatPng);
+}
+
+CSFML_BENCHMARK(benchImageSaveToMemoryQoi, "Graphics/Image/saveToMemoryQoi")
+{
+    benchSaveToMemory(state, sfImageFormatQoi);
+}
+
+CSFML_BENCHMARK(benchImageSaveToMemoryBmp, "Graphics/Image/saveToMemoryBmp")
+{
+    benchSaveToMemory(state, sfImageFormatBmp);
+}
+
+CSFML_BENCHMARK(benchImageSaveToFilePng, "Graphics/Image/saveToFilePng")
+{
+    sfImage* image = createScreenshot(1280, 720);
+    std::string filename = bench::getTemporaryPath("screenshot.png");
+
+    while (state.keepRunning())
+        sfImage_saveToFile(image, filename.c_str());
+
+    sfImage_destroy(image);
+    std::remove(filename.c_str());
+    state.setBytesPerIteration(1280 * 720 * 4);
+}
+
+// Time spent by the caller only: the save itself runs on the image pool
+CSFML_BENCHMARK(benchImageSaveToFileAsyncPng, "Graphics/Image/saveToFileAsyncPng")
+{
+    sfImage* image = createScreenshot(1280, 720);
+    std::string filename = bench::getTemporaryPath("screenshot-async.png");
+
+    while (state.keepRunning())
+    {
+        sfTask* task = sfImage_saveToFileAsync(image, filename.c_str(), NULL, NULL);
+
+        state.pauseTiming();
+        sfTask_wait(task);
+        sfTask_release(task);
+        state.resumeTiming();
+    }
+
+    sfImage_destroy(image);
+    std::remove(filename.c_str());
+    state.setBytesPerIteration(1280 * 720 * 4);
+}
+
+CSFML_BENCHMARK(benchImageCreateFromMemoryQoi, "Graphics/Image/createFromMemoryQoi")
+{
+    sfImage* source = createScreenshot(1280, 720);
+    size_t size = 0;
+    void* data = sfImage_saveToMemory(source, sfImageFormatQoi, &size);
+    sfImage_destroy(source);
+
+    while (state.keepRunning())
+        sfImage_destroy(sfImage_createFromMemory(data, size));
+
+    sfFree(data);
+    state.setBytesPerIteration(1280 * 720 * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+// Shader uniforms (16 vec4 per material)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchShaderSetUniformsByName, "Graphics/Shader/setUniformsByName")
+{
+    sfRenderTexture* renderTexture = NULL;
+    sfShader* shader = createMaterialShader(state, renderTexture);
+    if (!shader)
+    {
+        if (renderTexture)
+            sfRenderTexture_destroy(renderTexture);
+        return;
+    }
+
+    std::vector<std::string> names;
+    for (unsigned int i = 0; i < materialUniformCount; ++i)
+        names.push_back("parameter" + std::to_string(i));
+
+    unsigned int frame = 0;
+    while (state.keepRunning())
+    {
+        for (unsigned int i = 0; i < materialUniformCount; ++i)
+            sfShader_setVec4Uniform(shader, names[i].c_str(), getMaterialParameter(i, frame));
+        ++frame;
+    }
+
+    sfShader_destroy(shader);
+    sfRenderTexture_destroy(renderTexture);
+    state.setItemsPerIteration(materialUniformCount);
+}
+
+CSFML_BENCHMARK(benchShaderSetUniformsAt, "Graphics/Shader/setUniformsAt")
+{
+    sfRenderTexture* renderTexture = NULL;
+    sfShader* shader = createMaterialShader(state, renderTexture);
+    if (!shader)
+    {
+        if (renderTexture)
+            sfRenderTexture_destroy(renderTexture);
+        return;
+    }
+
+    std::vector<int> locations;
+    for (unsigned int i = 0; i < materialUniformCount; ++i)
+        locations.push_back(sfShader_getUniformLocation(shader, ("parameter" + std::to_string(i)).c_str()));
+
+    unsigned int frame = 0;
+    while (state.keepRunning())
+    {
+        for (unsigned int i = 0; i < materialUniformCount; ++i)
+            sfShader_setVec4UniformAt(shader, locations[i], getMaterialParameter(i, frame));
+        ++frame;
+    }
+
+    sfShader_destroy(shader);
+    sfRenderTexture_destroy(renderTexture);
+    state.setItemsPerIteration(materialUniformCount);
+}
+
+// All the values change between two applications
+CSFML_BENCHMARK(benchShaderUniformBlockApply, "Graphics/Shader/uniformBlockApply")
+{
+    sfRenderTexture* renderTexture = NULL;
+    sfShader* shader = createMaterialShader(state, renderTexture);
+    if (!shader)
+    {
+        if (renderTexture)
+            sfRenderTexture_destroy(renderTexture);
+        return;
+    }
+
+    std::vector<int> locations;
+    for (unsigned int i = 0; i < materialUniformCount; ++i)
+        locations.push_back(sfShader_getUniformLocation(shader, ("parameter" + std::to_string(i)).c_str()));
+
+    sfShaderUniformBlock* block = sfShaderUniformBlock_create();
+    unsigned int frame = 0;
+    while (state.keepRunning())
+    {
+        for (unsigned int i = 0; i < materialUniformCount; ++i)
+            sfShaderUniformBlock_setVec4(block, locations[i], getMaterialParameter(i, frame));
+        sfShaderUniformBlock_apply(block, shader);
+        ++frame;
+    }
+
+    sfShaderUniformBlock_destroy(block);
+    sfShader_destroy(shader);
+    sfRenderTexture_destroy(renderTexture);
+    state.setItemsPerIteration(materialUniformCount);
+}
+
+// Same material applied again: every value is skipped
+CSFML_BENCHMARK(benchShaderUniformBlockApplyUnchanged, "Graphics/Shader/uniformBlockApplyUnchanged")
+{
+    sfRenderTexture* renderTexture = NULL;
+    sfShader* shader = createMaterialShader(state, renderTexture);
+    if (!shader)
+    {
+        if (renderTexture)
+            sfRenderTexture_destroy(renderTexture);
+        return;
+    }
+
+    sfShaderUniformBlock* block = sfShaderUniformBlock_create();
+    for (unsigned int i = 0; i < materialUniformCount; ++i)
+    {
+        int location = sfShader_getUniformLocation(shader, ("parameter" + std::to_string(i)).c_str());
+        sfShaderUniformBlock_setVec4(block, location, getMaterialParameter(i, 0));
+    }
+
+    while (state.keepRunning())
+        sfShaderUniformBlock_apply(block, shader);
+
+    sfShaderUniformBlock_destroy(block);
+    sfShader_destroy(shader);
+    sfRenderTexture_destroy(renderTexture);
+    state.setItemsPerIteration(materialUniformCount);
+}
+
+
+////////////////////////////////////////////////////////////
+// Shader variants: compiling on the render thread vs requesting
+// a variant from a shader library, compiled in the background
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchShaderLibraryCompileVariant, "Graphics/ShaderLibrary/compileVariantSynchronously")
+{
+    sfRenderTexture* renderTexture = createShaderTarget(state);
+    if (!renderTexture)
+        return;
+
+    // Every iteration compiles a different variant, so that the driver can't reuse a program
+    std::string source = getMaterialSource();
+    unsigned int variant = 0;
+    while (state.keepRunning())
+    {
+        std::string variantSource = "#define VARIANT " + std::to_string(variant++) + "\n" + source;
+        sfShader* shader = sfShader_createFromMemory(NULL, NULL, variantSource.c_str());
+        bench::doNotOptimize(shader);
+        sfShader_destroy(shader);
+    }
+
+    sfRenderTexture_destroy(renderTexture);
+}
+
+CSFML_BENCHMARK(benchShaderLibraryAddVariant, "Graphics/ShaderLibrary/addVariant")
+{
+    sfRenderTexture* renderTexture = createShaderTarget(state);
+    if (!renderTexture)
+        return;
+
+    sfShaderLibrary* library = sfShaderLibrary_create(NULL, NULL, getMaterialSource().c_str(), 1);
+    unsigned int variant = 0;
+    while (state.keepRunning())
+    {
+        std::string define = "VARIANT=" + std::to_string(variant++);
+        const char* defines[] = {define.c_str()};
+        bench::doNotOptimize(sfShaderLibrary_addVariant(library, defines, 1));
+    }
+
+    // The variants that are still queued are dropped
+    sfShaderLibrary_destroy(library);
+    sfRenderTexture_destroy(renderTexture);
+}
+
+CSFML_BENCHMARK(benchShaderLibraryGetShader, "Graphics/ShaderLibrary/getShader")
+{
+    sfRenderTexture* renderTexture = createShaderTarget(state);
+    if (!renderTexture)
+        return;
+
+    const unsigned int variantCount = 8;
+    sfShaderLibrary* library = sfShaderLibrary_create(NULL, NULL, getMaterialSource().c_str(), 0);
+    for (unsigned int i = 0; i < variantCount; ++i)
+    {
+        std::string define = "VARIANT=" + std::to_string(i);
+        const char* defines[] = {define.c_str()};
+        sfShaderLibrary_addVariant(library, defines, 1);
+    }
+    sfShaderLibrary_waitAll(library);
+
+    unsigned int frame = 0;
+    while (state.keepRunning())
+        bench::doNotOptimize(sfShaderLibrary_getShader(library, static_cast<int>(frame++ % variantCount)));
+
+    sfShaderLibrary_destroy(library);
+    sfRenderTexture_destroy(renderTexture);
+}
+
+
+////////////////////////////////////////////////////////////
+// Transient render targets, as used by post-processing effects
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchRenderTextureCreateDestroy, "Graphics/RenderTexture/createDestroy")
+{
+    if (!sfContext_isAvailable())
+    {
+        state.skip("OpenGL contexts are not available (no display)");
+        return;
+    }
+
+    while (state.keepRunning())
+    {
+        sfRenderTexture* renderTexture = sfRenderTexture_create(1280, 720, sfFalse);
+        bench::doNotOptimize(renderTexture);
+        sfRenderTexture_destroy(renderTexture);
+    }
+}
+
+CSFML_BENCHMARK(benchRenderTexturePoolAcquire, "Graphics/RenderTexturePool/acquireEndFrame")
+{
+    if (!sfContext_isAvailable())
+    {
+        state.skip("OpenGL contexts are not available (no display)");
+        return;
+    }
+
+    sfRenderTexturePool* pool = sfRenderTexturePool_create();
+    while (state.keepRunning())
+    {
+        bench::doNotOptimize(sfRenderTexturePool_acquire(pool, 1280, 720, NULL));
+        sfRenderTexturePool_endFrame(pool);
+    }
+
+    sfRenderTexturePool_destroy(pool);
+}
+
+
+////////////////////////////////////////////////////////////
+// Draw calls, per object type (CPU cost of the call only)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchDrawSprite, "Graphics/Draw/sprite")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfTexture* texture = sfTexture_create(64, 64);
+    sfSprite* sprite = sfSprite_create();
+    sfSprite_setTexture(sprite, texture, sfTrue);
+
+    while (state.keepRunning())
+        sfRenderTexture_drawSprite(target, sprite, NULL);
+
+    sfSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+    sfRenderTexture_destroy(target);
+}
+
+CSFML_BENCHMARK(benchDrawSpriteWithStates, "Graphics/Draw/spriteWithStates")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfTexture* texture = sfTexture_create(64, 64);
+    sfSprite* sprite = sfSprite_create();
+    sfSprite_setTexture(sprite, texture, sfTrue);
+
+    sfRenderStates states;
+    states.blendMode = sfBlendAlpha;
+    states.transform = sfTransform_Identity;
+    states.texture   = NULL;
+    states.shader    = NULL;
+    sfTransform_translate(&states.transform, 10.f, 10.f);
+
+    while (state.keepRunning())
+        sfRenderTexture_drawSprite(target, sprite, &states);
+
+    sfSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+    sfRenderTexture_destroy(target);
+}
+
+CSFML_BENCHMARK(benchDrawCircleShape, "Graphics/Draw/circleShape")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfCircleShape* shape = sfCircleShape_create();
+    sfCircleShape_setRadius(shape, 50.f);
+
+    while (state.keepRunning())
+        sfRenderTexture_drawCircleShape(target, shape, NULL);
+
+    sfCircleShape_destroy(shape);
+    sfRenderTexture_destroy(target);
+}
+
+CSFML_BENCHMARK(benchDrawRectangleShape, "Graphics/Draw/rectangleShape")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfRectangleShape* shape = sfRectangleShape_create();
+    sfVector2f size = {100.f, 50.f};
+    sfRectangleShape_setSize(shape, size);
+
+    while (state.keepRunning())
+        sfRenderTexture_drawRectangleShape(target, shape, NULL);
+
+    sfRectangleShape_destroy(shape);
+    sfRenderTexture_destroy(target);
+}
+
+CSFML_BENCHMARK(benchDrawConvexShape, "Graphics/Draw/convexShape")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfConvexShape* shape = sfConvexShape_create();
+    sfConvexShape_setPointCount(shape, 6);
+    for (size_t i = 0; i < 6; ++i)
+    {
+        sfVector2f point = {static_cast<float>(i % 3) * 20.f, static_cast<float>(i / 3) * 20.f};
+        sfConvexShape_setPoint(shape, i, point);
+    }
+
+    while (state.keepRunning())
+        sfRenderTexture_drawConvexShape(target, shape, NULL);
+
+    sfConvexShape_destroy(shape);
+    sfRenderTexture_destroy(target);
+}
+
+CSFML_BENCHMARK(benchDrawVertexArray, "Graphics/Draw/vertexArray")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    // 64 quads
+    sfVertexArray* vertices = sfVertexArray_create();
+    sfVertexArray_setPrimitiveType(vertices, sfQuads);
+    for (unsigned int i = 0; i < 64 * 4; ++i)
+    {
+        sfVertex vertex;
+        vertex.position.x  = static_cast<float>((i / 4) * 8 + ((i % 4 == 1) || (i % 4 == 2) ? 8 : 0));
+        vertex.position.y  = static_cast<float>((i % 4 >= 2) ? 8 : 0);
+        vertex.color       = sfWhite;
+        vertex.texCoords.x = 0;
+        vertex.texCoords.y = 0;
+        sfVertexArray_append(vertices, vertex);
+    }
+
+    while (state.keepRunning())
+        sfRenderTexture_drawVertexArray(target, vertices, NULL);
+
+    sfVertexArray_destroy(vertices);
+    sfRenderTexture_destroy(target);
+    state.setItemsPerIteration(64);
+}
+
+CSFML_BENCHMARK(benchDrawText, "Graphics/Draw/text")
+{
+    sfRenderTexture* target = createRenderTexture(state);
+    if (!target)
+        return;
+
+    sfFont* font = createFont(state);
+    if (!font)
+    {
+        sfRenderTexture_destroy(target);
+        return;
+    }
+
+    sfText* text = sfText_create();
+    sfText_setFont(text, font);
+    sfText_setString(text, "The quick brown fox jumps over the lazy dog");
+    sfText_setCharacterSize(text, 24);
+
+    while (state.keepRunning())
+        sfRenderTexture_drawText(target, text, NULL);
+
+    sfText_destroy(text);
+    sfFont_destroy(font);
+    sfRenderTexture_destroy(target);
+}
+
+
+////////////////////////////////////////////////////////////
+// Text layout (geometry update after a string change)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTextLayout, "Graphics/Text/layout")
+{
+    if (!sfContext_isAvailable())
+    {
+        state.skip("OpenGL contexts are not available (no display)");
+        return;
+    }
+
+    sfFont* font = createFont(state);
+    if (!font)
+        return;
+
+    const char* strings[] =
+    {
+        "The quick brown fox jumps over the lazy dog",
+        "Pack my box with five dozen liquor jugs\nHow vexingly quick daft zebras jump"
+    };
+
+    sfText* text = sfText_create();
+    sfText_setFont(text, font);
+    sfText_setCharacterSize(text, 24);
+
+    // Warm up the glyph cache, so that only the layout is measured
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        sfText_setString(text, strings[i]);
+        sfText_getLocalBounds(text);
+    }
+
+    std::size_t index = 0;
+    while (state.keepRunning())
+    {
+        sfText_setString(text, strings[index]);
+        bench::doNotOptimize(sfText_getLocalBounds(text));
+        index ^= 1;
+    }
+
+    sfText_destroy(text);
+    sfFont_destroy(font);
+}
+
+
+////////////////////////////////////////////////////////////
+// Texture uploads
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTextureUpdateFromPixels, "Graphics/Texture/updateFromPixels")
+{
+    if (!sfContext_isAvailable())
+    {
+        state.skip("OpenGL contexts are not available (no display)");
+        return;
+    }
+
+    sfTexture* texture = sfTexture_create(256, 256);
+    std::vector<sfUint8> pixels(256 * 256 * 4, 128);
+
+    while (state.keepRunning())
+        sfTexture_updateFromPixels(texture, &pixels[0], 256, 256, 0, 0);
+
+    sfTexture_destroy(texture);
+    state.setBytesPerIteration(static_cast<double>(pixels.size()));
+}
+
+
+////////////////////////////////////////////////////////////
+// Texture loading, PNG against pre-compressed BC1 blocks (which
+// are decoded on the CPU when the driver doesn't support them)
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTextureLoadPng, "Graphics/Texture/loadPng")
+{
+    sfImage* image = createScreenshot(1280, 720);
+    size_t size = 0;
+    sfUint8* data = static_cast<sfUint8*>(sfImage_saveToMemory(image, sfImageFormatPng, &size));
+    std::vector<sfUint8> file(data, data + size);
+    sfFree(data);
+    sfImage_destroy(image);
+
+    benchTextureLoad(state, createFromPngMemory, file);
+}
+
+CSFML_BENCHMARK(benchTextureLoadDds, "Graphics/Texture/loadDdsBc1")
+{
+    sfImage* image = createScreenshot(1280, 720);
+    std::vector<sfUint8> file = createDds(1280, 720, compressBc1(image));
+    sfImage_destroy(image);
+
+    benchTextureLoad(state, sfTexture_createFromDDSMemory, file);
+}
+
+CSFML_BENCHMARK(benchTextureLoadKtx, "Graphics/Texture/loadKtxBc1")
+{
+    sfImage* image = createScreenshot(1280, 720);
+    std::vector<sfUint8> file = createKtx(1280, 720, compressBc1(image));
+    sfImage_destroy(image);
+
+    benchTextureLoad(state, sfTexture_createFromKTXMemory, file);
+}
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/Network.h>
+#include <SFML/System/Thread.h>
+#include <vector>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    void writePacket(sfPacket* packet)
+    {
+        for (sfInt32 i = 0; i < 16; ++i)
+            sfPacket_writeInt32(packet, i);
+        for (sfUint8 i = 0; i < 4; ++i)
+            sfPacket_writeFloat(packet, i * 0.5f);
+        sfPacket_writeUint8(packet, 42);
+        sfPacket_writeString(packet, "player-name");
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Connected pair of TCP sockets on the loopback interface
+    ////////////////////////////////////////////////////////////
+    struct TcpConnection
+    {
+        sfTcpSocket* client;
+        sfTcpSocket* server;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    bool connectLoopback(bench::State& state, TcpConnection& connection)
+    {
+        connection.client = NULL;
+        connection.server = NULL;
+
+        sfTcpListener* listener = sfTcpListener_create();
+        if (sfTcpListener_listen(listener, 0, sfIpAddress_LocalHost) == sfSocketDone)
+        {
+            connection.client = sfTcpSocket_create();
+            if (sfTcpSocket_connect(connection.client, sfIpAddress_LocalHost, sfTcpListener_getLocalPort(listener), sfSeconds(1.f)) == sfSocketDone)
+                sfTcpListener_accept(listener, &connection.server);
+        }
+        sfTcpListener_destroy(listener);
+
+        if (!connection.server)
+        {
+            if (connection.client)
+                sfTcpSocket_destroy(connection.client);
+            state.skip("failed to open a TCP connection on the loopback interface");
+            return false;
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void disconnectLoopback(TcpConnection& connection)
+    {
+        sfTcpSocket_destroy(connection.client);
+        sfTcpSocket_destroy(connection.server);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    struct TcpReceiver
+    {
+        sfTcpSocket*      socket;
+        std::size_t       count;  ///< Number of bytes or packets to receive
+        std::vector<char> buffer;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void receiveBytes(void* userData)
+    {
+        TcpReceiver* receiver = static_cast<TcpReceiver*>(userData);
+
+        std::size_t total = 0;
+        while (total < receiver->count)
+        {
+            std::size_t received = 0;
+            if (sfTcpSocket_receive(receiver->socket, &receiver->buffer[0], receiver->buffer.size(), &received) != sfSocketDone)
+                break;
+            total += received;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void receivePackets(void* userData)
+    {
+        TcpReceiver* receiver = static_cast<TcpReceiver*>(userData);
+
+        sfPacket* packet = sfPacket_create();
+        for (std::size_t i = 0; i < receiver->count; ++i)
+        {
+            if (sfTcpSocket_receivePacket(receiver->socket, packet) != sfSocketDone)
+                break;
+        }
+        sfPacket_destroy(packet);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Packet serialization
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchPacketWrite, "Network/Packet/write")
+{
+    sfPacket* packet = sfPacket_create();
+
+    while (state.keepRunning())
+    {
+        sfPacket_clear(packet);
+        writePacket(packet);
+    }
+
+    state.setBytesPerIteration(static_cast<double>(sfPacket_getDataSize(packet)));
+    sfPacket_destroy(packet);
+}
+
+CSFML_BENCHMARK(benchPacketRead, "Network/Packet/read")
+{
+    sfPacket* source = sfPacket_create();
+    writePacket(source);
+    sfPacket* packet = sfPacket_create();
+    char string[32];
+
+    while (state.keepRunning())
+    {
+        // Copying the data is needed to rewind the packet, and cheap compared to the reads
+        sfPacket_clear(packet);
+        sfPacket_append(packet, sfPacket_getData(source), sfPacket_getDataSize(source));
+
+        sfInt32 total = 0;
+        for (int i = 0; i < 16; ++i)
+            total += sfPacket_readInt32(packet);
+        for (int i = 0; i < 4; ++i)
+            total += static_cast<sfInt32>(sfPacket_readFloat(packet));
+        total += sfPacket_readUint8(packet);
+        sfPacket_readString(packet, string);
+        bench::doNotOptimize(total);
+    }
+
+    state.setBytesPerIteration(static_cast<double>(sfPacket_getDataSize(source)));
+    sfPacket_destroy(packet);
+    sfPacket_destroy(source);
+}
+
+CSFML_BENCHMARK(benchPacketCreateDestroy, "Network/Packet/createDestroy")
+{
+    while (state.keepRunning())
+    {
+        sfPacket* packet = sfPacket_create();
+        bench::doNotOptimize(packet);
+        sfPacket_destroy(packet);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Socket throughput on the loopback interface
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTcpLoopback, "Network/Tcp/loopbackThroughput")
+{
+    const std::size_t chunkSize = 64 * 1024;
+
+    TcpConnection connection;
+    if (!connectLoopback(state, connection))
+        return;
+
+    TcpReceiver receiver;
+    receiver.socket = connection.server;
+    receiver.count  = state.getIterations() * chunkSize;
+    receiver.buffer.resize(chunkSize);
+    sfThread* thread = sfThread_create(&receiveBytes, &receiver);
+    sfThread_launch(thread);
+
+    // The timing includes the reception of the last chunk
+    std::vector<char> chunk(chunkSize, 'x');
+    std::size_t remaining = state.getIterations();
+    while (state.keepRunning())
+    {
+        // On failure, disconnect so that the receiver stops waiting
+        if (sfTcpSocket_send(connection.client, &chunk[0], chunk.size()) != sfSocketDone)
+            sfTcpSocket_disconnect(connection.client);
+        if (--remaining == 0)
+            sfThread_wait(thread);
+    }
+
+    sfThread_destroy(thread);
+    disconnectLoopback(connection);
+    state.setBytesPerIteration(chunkSize);
+}
+
+CSFML_BENCHMARK(benchTcpLoopbackPackets, "Network/Tcp/loopbackPackets")
+{
+    TcpConnection connection;
+    if (!connectLoopback(state, connection))
+        return;
+
+    TcpReceiver receiver;
+    receiver.socket = connection.server;
+    receiver.count  = state.getIterations();
+    sfThread* thread = sfThread_create(&receivePackets, &receiver);
+    sfThread_launch(thread);
+
+    sfPacket* packet = sfPacket_create();
+    writePacket(packet);
+
+    std::size_t remaining = state.getIterations();
+    while (state.keepRunning())
+    {
+        if (sfTcpSocket_sendPacket(connection.client, packet) != sfSocketDone)
+            sfTcpSocket_disconnect(connection.client);
+        if (--remaining == 0)
+            sfThread_wait(thread);
+    }
+
+    state.setItemsPerIteration(1);
+    state.setBytesPerIteration(static_cast<double>(sfPacket_getDataSize(packet)));
+    sfPacket_destroy(packet);
+    sfThread_destroy(thread);
+    disconnectLoopback(connection);
+}
+
+CSFML_BENCHMARK(benchUdpLoopback, "Network/Udp/loopbackDatagram")
+{
+    const std::size_t datagramSize = 512;
+
+    sfUdpSocket* sender = sfUdpSocket_create();
+    sfUdpSocket* receiver = sfUdpSocket_create();
+    if ((sfUdpSocket_bind(sender, 0, sfIpAddress_LocalHost) != sfSocketDone) ||
+        (sfUdpSocket_bind(receiver, 0, sfIpAddress_LocalHost) != sfSocketDone))
+    {
+        sfUdpSocket_destroy(receiver);
+        sfUdpSocket_destroy(sender);
+        state.skip("failed to bind UDP sockets on the loopback interface");
+        return;
+    }
+
+    unsigned short port = sfUdpSocket_getLocalPort(receiver);
+    std::vector<char> datagram(datagramSize, 'x');
+    std::vector<char> buffer(datagramSize);
+    sfIpAddress address;
+    unsigned short remotePort;
+
+    while (state.keepRunning())
+    {
+        std::size_t received = 0;
+        sfUdpSocket_send(sender, &datagram[0], datagram.size(), sfIpAddress_LocalHost, port);
+        sfUdpSocket_receive(receiver, &buffer[0], buffer.size(), &received, &address, &remotePort);
+    }
+
+    sfUdpSocket_destroy(receiver);
+    sfUdpSocket_destroy(sender);
+    state.setItemsPerIteration(1);
+    state.setBytesPerIteration(datagramSize);
+}
@@ -0,0 +1,445 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/System.h>
+#include <vector>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    void emptyTask(void*)
+    {
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void fillRange(size_t begin, size_t end, void* userData)
+    {
+        float* values = static_cast<float*>(userData);
+        for (size_t i = begin; i < end; ++i)
+            values[i] = values[i] * 0.5f + 1.f;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    struct QueueProducer
+    {
+        sfQueue* queue;
+        size_t   count;
+        bool     batch;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void produce(void* userData)
+    {
+        QueueProducer* producer = static_cast<QueueProducer*>(userData);
+
+        if (producer->batch)
+        {
+            sfUint64 elements[64];
+            for (size_t i = 0; i < 64; ++i)
+                elements[i] = i;
+
+            // When the queue is full, block on a single element instead of spinning
+            size_t pushed = 0;
+            while (pushed < producer->count)
+            {
+                size_t count = producer->count - pushed < 64 ? producer->count - pushed : 64;
+                size_t batch = sfQueue_pushBatch(producer->queue, elements, count);
+                if (batch == 0)
+                {
+                    sfQueue_push(producer->queue, elements);
+                    batch = 1;
+                }
+                pushed += batch;
+            }
+        }
+        else
+        {
+            for (sfUint64 i = 0; i < producer->count; ++i)
+                sfQueue_push(producer->queue, &i);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void runQueueThroughput(bench::State& state, sfQueueMode mode, unsigned int producerCount, bool batch)
+    {
+        const size_t count = 1 << 16;
+
+        sfQueue* queue = sfQueue_create(mode, sizeof(sfUint64), 1024);
+        std::vector<QueueProducer> producers(producerCount);
+        std::vector<sfThread*> threads(producerCount);
+        for (unsigned int i = 0; i < producerCount; ++i)
+        {
+            producers[i].queue = queue;
+            producers[i].count = count / producerCount;
+            producers[i].batch = batch;
+            threads[i] = sfThread_create(&produce, &producers[i]);
+        }
+
+        sfUint64 elements[64];
+        while (state.keepRunning())
+        {
+            for (unsigned int i = 0; i < producerCount; ++i)
+                sfThread_launch(threads[i]);
+
+            size_t popped = 0;
+            while (popped < count)
+            {
+                size_t count = batch ? sfQueue_popBatch(queue, elements, 64) : 0;
+                if (count == 0)
+                {
+                    sfQueue_pop(queue, elements);
+                    count = 1;
+                }
+                popped += count;
+            }
+
+            for (unsigned int i = 0; i < producerCount; ++i)
+                sfThread_wait(threads[i]);
+        }
+
+        for (unsigned int i = 0; i < producerCount; ++i)
+            sfThread_destroy(threads[i]);
+        sfQueue_destroy(queue);
+
+        state.setItemsPerIteration(count);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Value types: exported functions against their inline versions
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTimeAsSeconds, "System/Time/asSeconds")
+{
+    std::vector<sfTime> times(1024);
+    for (size_t i = 0; i < times.size(); ++i)
+        times[i] = sfMicroseconds(static_cast<sfInt64>(i) * 16667);
+
+    while (state.keepRunning())
+    {
+        float total = 0;
+        for (size_t i = 0; i < times.size(); ++i)
+            total += sfTime_asSeconds(times[i]);
+        bench::doNotOptimize(total);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(times.size()));
+}
+
+CSFML_BENCHMARK(benchTimeAsSecondsInline, "System/Time/asSecondsInline")
+{
+    std::vector<sfTime> times(1024);
+    for (size_t i = 0; i < times.size(); ++i)
+        times[i] = sfMicroseconds(static_cast<sfInt64>(i) * 16667);
+
+    while (state.keepRunning())
+    {
+        float total = 0;
+        for (size_t i = 0; i < times.size(); ++i)
+            total += sfTime_asSecondsInline(times[i]);
+        bench::doNotOptimize(total);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(times.size()));
+}
+
+CSFML_BENCHMARK(benchTimeSeconds, "System/Time/seconds")
+{
+    std::vector<sfTime> times(1024);
+
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < times.size(); ++i)
+            times[i] = sfSeconds(static_cast<float>(i) * 0.016f);
+        bench::doNotOptimize(times[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(times.size()));
+}
+
+CSFML_BENCHMARK(benchTimeSecondsInline, "System/Time/secondsInline")
+{
+    std::vector<sfTime> times(1024);
+
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < times.size(); ++i)
+            times[i] = sfSecondsInline(static_cast<float>(i) * 0.016f);
+        bench::doNotOptimize(times[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(times.size()));
+}
+
+
+////////////////////////////////////////////////////////////
+// Task pool: scheduling overhead
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchTaskPoolSubmitWait, "System/TaskPool/submitWait")
+{
+    sfTaskPool* pool = sfTaskPool_create(0);
+
+    while (state.keepRunning())
+    {
+        sfTask* task = sfTaskPool_submit(pool, &emptyTask, NULL, NULL, 0);
+        sfTask_wait(task);
+        sfTask_release(task);
+    }
+
+    sfTaskPool_destroy(pool);
+}
+
+CSFML_BENCHMARK(benchTaskPoolSubmitBatch, "System/TaskPool/submitBatch")
+{
+    const size_t count = 256;
+
+    sfTaskPool* pool = sfTaskPool_create(0);
+    std::vector<sfTask*> tasks(count);
+
+    while (state.keepRunning())
+    {
+        for (size_t i = 0; i < count; ++i)
+            tasks[i] = sfTaskPool_submit(pool, &emptyTask, NULL, NULL, 0);
+
+        sfTaskPool_waitAll(pool);
+
+        for (size_t i = 0; i < count; ++i)
+            sfTask_release(tasks[i]);
+    }
+
+    sfTaskPool_destroy(pool);
+    state.setItemsPerIteration(count);
+}
+
+CSFML_BENCHMARK(benchTaskPoolDependencyChain, "System/TaskPool/dependencyChain")
+{
+    const size_t count = 64;
+
+    sfTaskPool* pool = sfTaskPool_create(0);
+    std::vector<sfTask*> tasks(count);
+
+    while (state.keepRunning())
+    {
+        tasks[0] = sfTaskPool_submit(pool, &emptyTask, NULL, NULL, 0);
+        for (size_t i = 1; i < count; ++i)
+            tasks[i] = sfTaskPool_submit(pool, &emptyTask, NULL, &tasks[i - 1], 1);
+
+        sfTask_wait(tasks[count - 1]);
+
+        for (size_t i = 0; i < count; ++i)
+            sfTask_release(tasks[i]);
+    }
+
+    sfTaskPool_destroy(pool);
+    state.setItemsPerIteration(count);
+}
+
+CSFML_BENCHMARK(benchTaskPoolParallelFor, "System/TaskPool/parallelFor")
+{
+    const size_t count = 1 << 20;
+
+    sfTaskPool* pool = sfTaskPool_create(0);
+    std::vector<float> values(count, 1.f);
+
+    while (state.keepRunning())
+        sfTaskPool_parallelFor(pool, 0, count, 4096, &fillRange, &values[0]);
+
+    sfTaskPool_destroy(pool);
+    state.setItemsPerIteration(count);
+}
+
+CSFML_BENCHMARK(benchTaskPoolSerialFor, "System/TaskPool/serialFor")
+{
+    // Same work as parallelFor on the calling thread, as a reference
+    const size_t count = 1 << 20;
+
+    std::vector<float> values(count, 1.f);
+
+    while (state.keepRunning())
+    {
+        fillRange(0, count, &values[0]);
+        bench::doNotOptimize(values[0]);
+    }
+
+    state.setItemsPerIteration(count);
+}
+
+
+////////////////////////////////////////////////////////////
+// Queues: latency and throughput
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchQueueSpscPushPop, "System/Queue/spscPushPop")
+{
+    sfQueue* queue = sfQueue_create(sfQueueSingleProducerSingleConsumer, sizeof(sfUint64), 1024);
+    sfUint64 element = 0;
+
+    while (state.keepRunning())
+    {
+        sfQueue_tryPush(queue, &element);
+        sfQueue_tryPop(queue, &element);
+    }
+
+    sfQueue_destroy(queue);
+}
+
+CSFML_BENCHMARK(benchQueueMpmcPushPop, "System/Queue/mpmcPushPop")
+{
+    sfQueue* queue = sfQueue_create(sfQueueMultiProducerMultiConsumer, sizeof(sfUint64), 1024);
+    sfUint64 element = 0;
+
+    while (state.keepRunning())
+    {
+        sfQueue_tryPush(queue, &element);
+        sfQueue_tryPop(queue, &element);
+    }
+
+    sfQueue_destroy(queue);
+}
+
+CSFML_BENCHMARK(benchQueueSpscThroughput, "System/Queue/spscThroughput")
+{
+    runQueueThroughput(state, sfQueueSingleProducerSingleConsumer, 1, false);
+}
+
+CSFML_BENCHMARK(benchQueueSpscBatchThroughput, "System/Queue/spscBatchThroughput")
+{
+    runQueueThroughput(state, sfQueueSingleProducerSingleConsumer, 1, true);
+}
+
+CSFML_BENCHMARK(benchQueueMpmcThroughput, "System/Queue/mpmcThroughput")
+{
+    runQueueThroughput(state, sfQueueMultiProducerMultiConsumer, 4, false);
+}
+
+
+////////////////////////////////////////////////////////////
+// Synchronization primitives, uncontended
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchAtomicFetchAdd, "System/Atomic/fetchAddInt32")
+{
+    volatile sfInt32 value = 0;
+    while (state.keepRunning())
+        sfAtomic_fetchAddInt32(&value, 1);
+}
+
+CSFML_BENCHMARK(benchMutexLockUnlock, "System/Mutex/lockUnlock")
+{
+    sfMutex* mutex = sfMutex_create();
+    while (state.keepRunning())
+    {
+        sfMutex_lock(mutex);
+        sfMutex_unlock(mutex);
+    }
+    sfMutex_destroy(mutex);
+}
+
+CSFML_BENCHMARK(benchFastMutexLockUnlock, "System/FastMutex/lockUnlock")
+{
+    sfFastMutex* mutex = sfFastMutex_create();
+    while (state.keepRunning())
+    {
+        sfFastMutex_lock(mutex);
+        sfFastMutex_unlock(mutex);
+    }
+    sfFastMutex_destroy(mutex);
+}
+
+CSFML_BENCHMARK(benchRwLockRead, "System/RwLock/lockUnlockRead")
+{
+    sfRwLock* lock = sfRwLock_create();
+    while (state.keepRunning())
+    {
+        sfRwLock_lockRead(lock);
+        sfRwLock_unlockRead(lock);
+    }
+    sfRwLock_destroy(lock);
+}
+
+
+////////////////////////////////////////////////////////////
+// Allocation
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchAllocatorMallocFree, "System/Allocator/mallocFree")
+{
+    while (state.keepRunning())
+    {
+        void* memory = sfMalloc(64);
+        bench::doNotOptimize(memory);
+        sfFree(memory);
+    }
+}
+
+CSFML_BENCHMARK(benchClockCreateDestroy, "System/Clock/createDestroy")
+{
+    while (state.keepRunning())
+    {
+        sfClock* clock = sfClock_create();
+        bench::doNotOptimize(clock);
+        sfClock_destroy(clock);
+    }
+}
+
+CSFML_BENCHMARK(benchClockGetElapsedTime, "System/Clock/getElapsedTime")
+{
+    sfClock* clock = sfClock_create();
+    while (state.keepRunning())
+        bench::doNotOptimize(sfClock_getElapsedTime(clock));
+    sfClock_destroy(clock);
+}
+
+
+////////////////////////////////////////////////////////////
+// Profiler zones
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchProfilerZoneDisabled, "System/Profiler/zoneDisabled")
+{
+    sfProfiler_setEnabled(sfFalse);
+    while (state.keepRunning())
+    {
+        sfProfiler_beginZone("bench");
+        sfProfiler_endZone();
+    }
+}
+
+CSFML_BENCHMARK(benchProfilerZoneEnabled, "System/Profiler/zoneEnabled")
+{
+    sfProfiler_setEnabled(sfTrue);
+    while (state.keepRunning())
+    {
+        sfProfiler_beginZone("bench");
+        sfProfiler_endZone();
+    }
+    sfProfiler_setEnabled(sfFalse);
+    sfProfiler_clear();
+}
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "Benchmark.hpp"
+#include <SFML/Window/InputSnapshot.h>
+#include <SFML/Window/Event.hpp>
+#include <SFML/ConvertEvent.h>
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Build a typical stream of events: mostly mouse moves, with keys, text and clicks
+    ////////////////////////////////////////////////////////////
+    std::vector<sf::Event> makeEvents(std::size_t count)
+    {
+        std::vector<sf::Event> events(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sf::Event& event = events[i];
+            switch (i % 8)
+            {
+                case 0 :
+                    event.type = sf::Event::KeyPressed;
+                    event.key.code = sf::Keyboard::A;
+                    event.key.alt = false;
+                    event.key.control = true;
+                    event.key.shift = false;
+                    event.key.system = false;
+                    break;
+
+                case 1 :
+                    event.type = sf::Event::TextEntered;
+                    event.text.unicode = 'a';
+                    break;
+
+                case 2 :
+                    event.type = sf::Event::MouseButtonPressed;
+                    event.mouseButton.button = sf::Mouse::Left;
+                    event.mouseButton.x = static_cast<int>(i);
+                    event.mouseButton.y = static_cast<int>(i);
+                    break;
+
+                default :
+                    event.type = sf::Event::MouseMoved;
+                    event.mouseMove.x = static_cast<int>(i);
+                    event.mouseMove.y = static_cast<int>(i / 2);
+                    break;
+            }
+        }
+
+        return events;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Conversion of SFML events to CSFML events
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchConvertEventMouseMoved, "Window/Event/convertMouseMoved")
+{
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+    event.mouseMove.x = 10;
+    event.mouseMove.y = 20;
+
+    sfEvent converted;
+    while (state.keepRunning())
+    {
+        convertEvent(event, &converted);
+        bench::doNotOptimize(converted);
+        ++event.mouseMove.x;
+    }
+}
+
+CSFML_BENCHMARK(benchConvertEventKeyPressed, "Window/Event/convertKeyPressed")
+{
+    sf::Event event;
+    event.type = sf::Event::KeyPressed;
+    event.key.code = sf::Keyboard::Space;
+    event.key.alt = false;
+    event.key.control = false;
+    event.key.shift = true;
+    event.key.system = false;
+
+    sfEvent converted;
+    while (state.keepRunning())
+    {
+        convertEvent(event, &converted);
+        bench::doNotOptimize(converted);
+    }
+}
+
+CSFML_BENCHMARK(benchConvertEventStream, "Window/Event/convertStream")
+{
+    std::vector<sf::Event> events = makeEvents(256);
+    std::vector<sfEvent> converted(events.size());
+
+    while (state.keepRunning())
+    {
+        for (std::size_t i = 0; i < events.size(); ++i)
+            convertEvent(events[i], &converted[i]);
+        bench::doNotOptimize(converted[0]);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(events.size()));
+}
+
+CSFML_BENCHMARK(benchCoalesceEventStream, "Window/Event/coalesceStream")
+{
+    // Same stream as convertStream, with the coalescing done by sfWindow_pollEventsCoalesced
+    std::vector<sf::Event> events = makeEvents(256);
+    std::vector<sfEvent> converted(events.size());
+
+    while (state.keepRunning())
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            convertEvent(events[i], &converted[count]);
+            if ((count > 0) && canCoalesceEvents(converted[count - 1], converted[count]))
+                converted[count - 1] = converted[count];
+            else
+                ++count;
+        }
+        bench::doNotOptimize(count);
+    }
+
+    state.setItemsPerIteration(static_cast<double>(events.size()));
+}
+
+
+////////////////////////////////////////////////////////////
+// Input snapshots
+////////////////////////////////////////////////////////////
+CSFML_BENCHMARK(benchInputSnapshotDiff, "Window/InputSnapshot/diff")
+{
+    sfInputSnapshot previous;
+    sfInputSnapshot current;
+    std::memset(&previous, 0, sizeof(previous));
+    std::memset(&current, 0, sizeof(current));
+    current.keys[sfKeyA] = sfTrue;
+    current.mouseButtons[sfMouseLeft] = sfTrue;
+    current.mousePosition.x = 100;
+
+    sfEvent changes[16];
+    while (state.keepRunning())
+        bench::doNotOptimize(sfInputSnapshot_diff(&previous, &current, changes, 16));
+}
@@ -30,9 +30,12 @@
 ////////////////////////////////////////////////////////////
 
 #include <SFML/System.h>
+#include <SFML/Audio/AudioAnalyzer.h>
+#include <SFML/Audio/AudioConverter.h>
 #include <SFML/Audio/Listener.h>
 #include <SFML/Audio/Music.h>
 #include <SFML/Audio/Sound.h>
+#include <SFML/Audio/SoundBank.h>
 #include <SFML/Audio/SoundBuffer.h>
 #include <SFML/Audio/SoundBufferRecorder.h>
 #include <SFML/Audio/SoundRecorder.h>
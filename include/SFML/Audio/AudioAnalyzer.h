@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_AUDIOANALYZER_H
+#define SFML_AUDIOANALYZER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.h>
+#include <SFML/Audio/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Window functions applied before computing a spectrum
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfAudioWindowRectangular, ///< No windowing
+    sfAudioWindowHann,        ///< Hann window, good general purpose choice
+    sfAudioWindowHamming,     ///< Hamming window
+    sfAudioWindowBlackman     ///< Blackman window, lowest leakage
+} sfAudioWindow;
+
+////////////////////////////////////////////////////////////
+/// \brief Levels measured by an audio analyzer
+///
+/// Peak and RMS levels are normalized so that 1 is full scale.
+/// Loudness values are in LUFS (ITU-R BS.1770); they are
+/// negative infinity when not enough audio has been analyzed
+/// or when the signal is silent.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float peak;               ///< Highest absolute sample value
+    float rms;                ///< Root mean square level of all the samples
+    float momentaryLoudness;  ///< Loudness of the last 400 ms, in LUFS
+    float integratedLoudness; ///< Gated loudness of everything analyzed so far, in LUFS
+} sfAudioLevels;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new audio analyzer
+///
+/// An audio analyzer measures the levels of a stream of
+/// interleaved 16 bits samples, and computes magnitude spectra
+/// of blocks of samples. It reads the samples in place, so it
+/// can be fed directly with the array of a sound buffer or with
+/// the chunks of a sound stream or a sound recorder.
+///
+/// \param channelCount Number of interleaved channels of the analyzed samples
+/// \param sampleRate   Sample rate of the analyzed samples
+/// \param fftSize      Number of samples per spectrum (power of two), or 0 if spectra are not needed
+/// \param window       Window function applied before each FFT
+///
+/// \return A new sfAudioAnalyzer object (NULL if a parameter is invalid)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfAudioAnalyzer* sfAudioAnalyzer_create(unsigned int channelCount, unsigned int sampleRate, unsigned int fftSize, sfAudioWindow window);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an audio analyzer
+///
+/// \param analyzer Audio analyzer to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioAnalyzer_destroy(sfAudioAnalyzer* analyzer);
+
+////////////////////////////////////////////////////////////
+/// \brief Feed a block of samples to the level meters of an audio analyzer
+///
+/// Consecutive calls are treated as a continuous stream;
+/// use sfAudioAnalyzer_reset to start a new measurement.
+///
+/// \param analyzer    Audio analyzer object
+/// \param samples     Interleaved samples to analyze
+/// \param sampleCount Number of samples in \a samples
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioAnalyzer_process(sfAudioAnalyzer* analyzer, const sfInt16* samples, size_t sampleCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the levels measured by an audio analyzer
+///
+/// \param analyzer Audio analyzer object
+///
+/// \return Levels of all the samples processed since the creation or the last reset
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfAudioLevels sfAudioAnalyzer_getLevels(const sfAudioAnalyzer* analyzer);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the level meters of an audio analyzer
+///
+/// \param analyzer Audio analyzer object
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioAnalyzer_reset(sfAudioAnalyzer* analyzer);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the magnitude spectrum of a block of samples
+///
+/// The channels are averaged to mono, and the first fftSize
+/// frames of \a samples are windowed and transformed (missing
+/// frames are treated as silence). \a magnitudes receives
+/// fftSize / 2 + 1 values, from DC to the Nyquist frequency;
+/// they are normalized so that a full scale sine wave has a
+/// magnitude of about 1.
+/// This function doesn't affect the level meters.
+///
+/// \param analyzer    Audio analyzer object
+/// \param samples     Interleaved samples to analyze
+/// \param sampleCount Number of samples in \a samples
+/// \param magnitudes  Array receiving fftSize / 2 + 1 magnitudes
+///
+/// \return sfTrue on success, sfFalse if the analyzer was created without FFT
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfBool sfAudioAnalyzer_computeSpectrum(sfAudioAnalyzer* analyzer, const sfInt16* samples, size_t sampleCount, float* magnitudes);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the FFT size of an audio analyzer
+///
+/// \param analyzer Audio analyzer object
+///
+/// \return Number of samples per spectrum, or 0 if spectra are disabled
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API unsigned int sfAudioAnalyzer_getFftSize(const sfAudioAnalyzer* analyzer);
+
+////////////////////////////////////////////////////////////
+/// \brief Measure the levels of many sound buffers in parallel
+///
+/// Each buffer is analyzed as a whole, and its levels are
+/// written to the corresponding entry of \a levels. The work is
+/// spread across \a threadCount threads; 0 or 1 processes all
+/// the buffers on the calling thread. NULL buffers get zero
+/// levels.
+///
+/// \param buffers     Array of sound buffers to analyze
+/// \param count       Number of elements in \a buffers and \a levels
+/// \param levels      Array receiving the levels of each buffer
+/// \param threadCount Number of threads to use
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioAnalyzer_analyzeBuffers(const sfSoundBuffer* const* buffers, size_t count, sfAudioLevels* levels, unsigned int threadCount);
+
+
+#endif // SFML_AUDIOANALYZER_H
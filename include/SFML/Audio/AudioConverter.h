@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_AUDIOCONVERTER_H
+#define SFML_AUDIOCONVERTER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.h>
+#include <SFML/Audio/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new audio converter
+///
+/// An audio converter transforms interleaved 16 bits samples
+/// from one channel count and sample rate to another. Channels
+/// are remixed first (mono is duplicated to every output
+/// channel, extra channels are averaged down), then the signal
+/// is resampled with a windowed-sinc polyphase filter. When
+/// both sample rates are equal the filter is bypassed.
+///
+/// The converter is stateful: feeding consecutive blocks of a
+/// stream produces the same output as converting the whole
+/// stream at once.
+///
+/// \param inputChannelCount  Number of channels of the input samples
+/// \param inputSampleRate    Sample rate of the input samples
+/// \param outputChannelCount Number of channels of the output samples
+/// \param outputSampleRate   Sample rate of the output samples
+///
+/// \return A new sfAudioConverter object (NULL if a parameter is invalid)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfAudioConverter* sfAudioConverter_create(unsigned int inputChannelCount,
+                                                          unsigned int inputSampleRate,
+                                                          unsigned int outputChannelCount,
+                                                          unsigned int outputSampleRate);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an audio converter
+///
+/// \param converter Audio converter to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioConverter_destroy(sfAudioConverter* converter);
+
+////////////////////////////////////////////////////////////
+/// \brief Convert a block of samples
+///
+/// All the input samples are consumed. If \a outputCapacity
+/// is too small to receive the converted samples, the remaining
+/// ones are kept by the converter and returned first by the
+/// next call to sfAudioConverter_convert or sfAudioConverter_flush.
+/// Use sfAudioConverter_getOutputSampleCount to size the output
+/// array so that this never happens.
+///
+/// \a inputSampleCount must be a multiple of the input channel count.
+///
+/// \param converter        Audio converter object
+/// \param input            Interleaved input samples
+/// \param inputSampleCount Number of samples in \a input
+/// \param output           Array receiving the interleaved output samples
+/// \param outputCapacity   Maximum number of samples to write to \a output
+///
+/// \return Number of samples written to \a output
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API size_t sfAudioConverter_convert(sfAudioConverter* converter, const sfInt16* input, size_t inputSampleCount, sfInt16* output, size_t outputCapacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Flush the samples still held by an audio converter
+///
+/// The resampling filter needs a few samples ahead of the
+/// current position, so the end of a stream stays in the
+/// converter until this function is called. After flushing,
+/// the converter is reset and can be used for a new stream.
+///
+/// \param converter      Audio converter object
+/// \param output         Array receiving the interleaved output samples
+/// \param outputCapacity Maximum number of samples to write to \a output
+///
+/// \return Number of samples written to \a output
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API size_t sfAudioConverter_flush(sfAudioConverter* converter, sfInt16* output, size_t outputCapacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset an audio converter
+///
+/// This function discards the filter history and the
+/// pending output samples; call it when seeking in a stream.
+///
+/// \param converter Audio converter object
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfAudioConverter_reset(sfAudioConverter* converter);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum number of samples that the next conversion can produce
+///
+/// Pass 0 as \a inputSampleCount to get the size required
+/// by sfAudioConverter_flush.
+///
+/// \param converter        Audio converter object
+/// \param inputSampleCount Number of input samples that will be converted
+///
+/// \return Maximum number of output samples
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API size_t sfAudioConverter_getOutputSampleCount(const sfAudioConverter* converter, size_t inputSampleCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of output channels of an audio converter
+///
+/// \param converter Audio converter object
+///
+/// \return Number of output channels
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API unsigned int sfAudioConverter_getChannelCount(const sfAudioConverter* converter);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the output sample rate of an audio converter
+///
+/// \param converter Audio converter object
+///
+/// \return Output sample rate, in samples per second
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API unsigned int sfAudioConverter_getSampleRate(const sfAudioConverter* converter);
+
+
+#endif // SFML_AUDIOCONVERTER_H
@@ -33,6 +33,20 @@
 #include <SFML/Audio/Types.h>
 #include <SFML/System/Time.h>
 #include <SFML/System/Vector3.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief 3D parameters of a sound, used for batch updates
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfVector3f position;           ///< Position of the sound in the scene
+    float      minDistance;        ///< Minimum distance of the sound (see sfSound_setMinDistance)
+    float      attenuation;        ///< Attenuation factor of the sound (see sfSound_setAttenuation)
+    sfBool     relativeToListener; ///< Whether the position is relative to the listener
+} sfSoundSpatialization;
 
 
 ////////////////////////////////////////////////////////////
@@ -244,6 +258,40 @@ CSFML_AUDIO_API void sfSound_setMinDistance(sfSound* sound, float distance);
 ////////////////////////////////////////////////////////////
 CSFML_AUDIO_API void sfSound_setAttenuation(sfSound* sound, float attenuation);
 
+////////////////////////////////////////////////////////////
+/// \brief Set the 3D positions of many sounds at once
+///
+/// This function is equivalent to calling sfSound_setPosition
+/// for each sound, except that positions which didn't change since
+/// the last update are not sent again to the audio driver. It is
+/// meant to be called once per frame, together with
+/// sfListener_setPosition, to move all the emitters of a scene.
+/// NULL entries in \a sounds are skipped.
+///
+/// \param sounds    Array of sound objects
+/// \param positions Array of new positions, one per sound
+/// \param count     Number of elements in \a sounds and \a positions
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfSound_setPositions(sfSound** sounds, const sfVector3f* positions, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Set all the 3D parameters of many sounds at once
+///
+/// This function applies the position, minimum distance,
+/// attenuation and relative-to-listener flag of every sound in a
+/// single call. Only the parameters which differ from the last
+/// values applied to each sound are sent to the audio driver,
+/// so static emitters cost almost nothing.
+/// NULL entries in \a sounds are skipped.
+///
+/// \param sounds     Array of sound objects
+/// \param parameters Array of new 3D parameters, one per sound
+/// \param count      Number of elements in \a sounds and \a parameters
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfSound_setSpatializations(sfSound** sounds, const sfSoundSpatialization* parameters, size_t count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Change the current playing position of a sound
 ///
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDBANK_H
+#define SFML_SOUNDBANK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/Export.h>
+#include <SFML/Audio/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Write a sound bank file from a list of audio files
+///
+/// A sound bank packs many audio files in a single indexed
+/// file. The clips are stored as-is (still compressed), so any
+/// format supported by sfSoundBuffer_createFromFile can be packed.
+/// Clip names must be unique; clip \a i of the bank has the
+/// identifier \a i.
+///
+/// \param filename   Path of the sound bank file to write
+/// \param clipNames  Name of each clip, used for lookups
+/// \param clipFiles  Path of the audio file of each clip
+/// \param clipCount  Number of elements in \a clipNames and \a clipFiles
+///
+/// \return sfTrue if saving succeeded, sfFalse if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfBool sfSoundBank_pack(const char* filename, const char* const* clipNames, const char* const* clipFiles, size_t clipCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Open a sound bank file
+///
+/// Only the index of the bank is read by this function; the
+/// clips are read and decoded on demand. If \a memoryMapped is
+/// sfTrue the whole file is mapped in memory and clips are
+/// decoded directly from the mapping, otherwise each clip is
+/// read from the file when it is first requested.
+///
+/// \param filename     Path of the sound bank file to open
+/// \param memoryMapped sfTrue to map the file in memory, sfFalse to read clips on demand
+///
+/// \return A new sfSoundBank object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfSoundBank* sfSoundBank_createFromFile(const char* filename, sfBool memoryMapped);
+
+////////////////////////////////////////////////////////////
+/// \brief Open a sound bank stored in memory
+///
+/// The data is not copied: it must remain valid and unchanged
+/// until the sound bank is destroyed.
+///
+/// \param data        Pointer to the sound bank data in memory
+/// \param sizeInBytes Size of the data, in bytes
+///
+/// \return A new sfSoundBank object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfSoundBank* sfSoundBank_createFromMemory(const void* data, size_t sizeInBytes);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a sound bank
+///
+/// All the sound buffers returned by sfSoundBank_getSoundBuffer
+/// are destroyed too, so sounds must no longer use them.
+///
+/// \param soundBank Sound bank to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfSoundBank_destroy(sfSoundBank* soundBank);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of clips in a sound bank
+///
+/// \param soundBank Sound bank object
+///
+/// \return Number of clips; valid identifiers are in [0, count - 1]
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API size_t sfSoundBank_getClipCount(const sfSoundBank* soundBank);
+
+////////////////////////////////////////////////////////////
+/// \brief Find the identifier of a clip from its name
+///
+/// The lookup is done with a hash table and takes constant time.
+///
+/// \param soundBank Sound bank object
+/// \param name      Name of the clip
+///
+/// \return Identifier of the clip, or -1 if there's no clip with this name
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API long sfSoundBank_findClip(const sfSoundBank* soundBank, const char* name);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the name of a clip
+///
+/// \param soundBank Sound bank object
+/// \param clip      Identifier of the clip
+///
+/// \return Name of the clip, or NULL if the identifier is invalid
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API const char* sfSoundBank_getClipName(const sfSoundBank* soundBank, size_t clip);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the decoded sound buffer of a clip
+///
+/// The clip is decoded the first time it is requested, and
+/// the sound buffer is then kept by the sound bank until it is
+/// unloaded or the bank is destroyed. This function can be
+/// called from several threads at the same time.
+///
+/// \param soundBank Sound bank object
+/// \param clip      Identifier of the clip
+///
+/// \return Sound buffer of the clip (NULL if the identifier is invalid or decoding failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API const sfSoundBuffer* sfSoundBank_getSoundBuffer(sfSoundBank* soundBank, size_t clip);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new sound buffer from a clip
+///
+/// Unlike sfSoundBank_getSoundBuffer, the clip is decoded
+/// on every call and the caller owns the returned sound buffer.
+///
+/// \param soundBank Sound bank object
+/// \param clip      Identifier of the clip
+///
+/// \return A new sfSoundBuffer object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfSoundBuffer* sfSoundBank_createSoundBuffer(sfSoundBank* soundBank, size_t clip);
+
+////////////////////////////////////////////////////////////
+/// \brief Release the decoded sound buffer of a clip
+///
+/// Sounds must no longer use the buffer returned by
+/// sfSoundBank_getSoundBuffer for this clip.
+///
+/// \param soundBank Sound bank object
+/// \param clip      Identifier of the clip
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API void sfSoundBank_unloadSoundBuffer(sfSoundBank* soundBank, size_t clip);
+
+
+#endif // SFML_SOUNDBANK_H
@@ -94,6 +94,23 @@ CSFML_AUDIO_API sfSoundBuffer* sfSoundBuffer_createFromStream(sfInputStream* str
 ////////////////////////////////////////////////////////////
 CSFML_AUDIO_API sfSoundBuffer* sfSoundBuffer_createFromSamples(const sfInt16* samples, sfUint64 sampleCount, unsigned int channelCount, unsigned int sampleRate);
 
+////////////////////////////////////////////////////////////
+/// \brief Create a new sound buffer by converting an existing one to another format
+///
+/// The samples of \a soundBuffer are remixed to \a channelCount
+/// channels and resampled to \a sampleRate with a sfAudioConverter,
+/// so that assets of heterogeneous formats can all be brought to
+/// the native format of the audio device at load time.
+///
+/// \param soundBuffer  Sound buffer to convert
+/// \param channelCount Number of channels of the new buffer (1 = mono, 2 = stereo, ...)
+/// \param sampleRate   Sample rate of the new buffer
+///
+/// \return A new sfSoundBuffer object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfSoundBuffer* sfSoundBuffer_createResampled(const sfSoundBuffer* soundBuffer, unsigned int channelCount, unsigned int sampleRate);
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new sound buffer by copying an existing one
 ///
@@ -67,6 +67,34 @@ CSFML_AUDIO_API sfSoundStream* sfSoundStream_create(sfSoundStreamGetDataCallback
                                               unsigned int                 sampleRate,
                                               void*                        userData);
 
+////////////////////////////////////////////////////////////
+/// \brief Create a new sound stream that converts its source data on the fly
+///
+/// This function works like sfSoundStream_create, except that
+/// the samples returned by \a onGetData are in the source format
+/// (\a sourceChannelCount, \a sourceSampleRate) and are converted
+/// to the stream format (\a channelCount, \a sampleRate) by an
+/// internal sfAudioConverter before being played.
+///
+/// \param onGetData          Function called when the stream needs more data (can't be NULL)
+/// \param onSeek             Function called when the stream seeks (can't be NULL)
+/// \param sourceChannelCount Number of channels of the samples returned by \a onGetData
+/// \param sourceSampleRate   Sample rate of the samples returned by \a onGetData
+/// \param channelCount       Number of channels to play (1 = mono, 2 = stereo)
+/// \param sampleRate         Sample rate to play (44100 = CD quality)
+/// \param userData           Data to pass to the callback functions
+///
+/// \return A new sfSoundStream object (NULL if a format is invalid)
+///
+////////////////////////////////////////////////////////////
+CSFML_AUDIO_API sfSoundStream* sfSoundStream_createConverted(sfSoundStreamGetDataCallback onGetData,
+                                                       sfSoundStreamSeekCallback    onSeek,
+                                                       unsigned int                 sourceChannelCount,
+                                                       unsigned int                 sourceSampleRate,
+                                                       unsigned int                 channelCount,
+                                                       unsigned int                 sampleRate,
+                                                       void*                        userData);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy a sound stream
 ///
@@ -26,8 +26,11 @@
 #define SFML_AUDIO_TYPES_H
 
 
+typedef struct sfAudioAnalyzer sfAudioAnalyzer;
+typedef struct sfAudioConverter sfAudioConverter;
 typedef struct sfMusic sfMusic;
 typedef struct sfSound sfSound;
+typedef struct sfSoundBank sfSoundBank;
 typedef struct sfSoundBuffer sfSoundBuffer;
 typedef struct sfSoundBufferRecorder sfSoundBufferRecorder;
 typedef struct sfSoundRecorder sfSoundRecorder;
@@ -147,6 +147,34 @@
 
 #endif
 
+////////////////////////////////////////////////////////////
+// Define a portable keyword for functions defined in headers
+//
+// Usage:
+// static CSFML_INLINE int headerFunc(int x) { return x; }
+////////////////////////////////////////////////////////////
+#if defined(__cplusplus) || (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
+
+    // C++ and C99 have a standard keyword
+    #define CSFML_INLINE inline
+
+#elif defined(_MSC_VER)
+
+    // Microsoft C compiler in C89 mode
+    #define CSFML_INLINE __inline
+
+#elif defined(__GNUC__)
+
+    // gcc and Clang in C89 mode
+    #define CSFML_INLINE __inline__
+
+#else
+
+    // Other C89 compilers: the functions are still static, just not necessarily inlined
+    #define CSFML_INLINE
+
+#endif
+
 ////////////////////////////////////////////////////////////
 // Define a portable boolean type
 ////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include <SFML/Graphics/BlendMode.h>
 #include <SFML/Graphics/CircleShape.h>
 #include <SFML/Graphics/Color.h>
+#include <SFML/Graphics/ColorInline.h>
 #include <SFML/Graphics/ConvexShape.h>
 #include <SFML/Graphics/Font.h>
 #include <SFML/Graphics/FontInfo.h>
@@ -40,15 +41,20 @@
 #include <SFML/Graphics/Image.h>
 #include <SFML/Graphics/PrimitiveType.h>
 #include <SFML/Graphics/Rect.h>
+#include <SFML/Graphics/RectInline.h>
 #include <SFML/Graphics/RectangleShape.h>
 #include <SFML/Graphics/RenderStates.h>
 #include <SFML/Graphics/RenderTexture.h>
+#include <SFML/Graphics/RenderTexturePool.h>
 #include <SFML/Graphics/RenderWindow.h>
 #include <SFML/Graphics/Shader.h>
+#include <SFML/Graphics/ShaderLibrary.h>
+#include <SFML/Graphics/ShaderUniformBlock.h>
 #include <SFML/Graphics/Shape.h>
 #include <SFML/Graphics/Sprite.h>
 #include <SFML/Graphics/Text.h>
 #include <SFML/Graphics/Texture.h>
+#include <SFML/Graphics/TextureReadback.h>
 #include <SFML/Graphics/Transform.h>
 #include <SFML/Graphics/Transformable.h>
 #include <SFML/Graphics/Vertex.h>
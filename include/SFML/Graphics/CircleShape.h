@@ -63,6 +63,51 @@ CSFML_GRAPHICS_API sfCircleShape* sfCircleShape_copy(const sfCircleShape* shape)
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfCircleShape_destroy(sfCircleShape* shape);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfCircleShape structure
+///
+/// Together with sfCircleShape_alignof, this allows to store
+/// circle shapes in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfCircleShape_init.
+///
+/// \return Size of a circle shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfCircleShape_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfCircleShape structure
+///
+/// \return Required alignment of the memory of a circle shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfCircleShape_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a circle shape in memory owned by the caller
+///
+/// The circle shape is the same as one returned by sfCircleShape_create,
+/// but it must be destroyed with sfCircleShape_deinit instead of
+/// sfCircleShape_destroy.
+///
+/// \param memory Pointer to at least sfCircleShape_sizeof() bytes, aligned on sfCircleShape_alignof()
+///
+/// \return Pointer to the new circle shape (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfCircleShape* sfCircleShape_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a circle shape constructed with sfCircleShape_init
+///
+/// The memory of the circle shape is not released, and can be used
+/// to construct another one.
+///
+/// \param shape Circle shape to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfCircleShape_deinit(sfCircleShape* shape);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a circle shape
 ///
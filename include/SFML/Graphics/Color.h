@@ -29,6 +29,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -131,5 +132,20 @@ CSFML_GRAPHICS_API sfColor sfColor_subtract(sfColor color1, sfColor color2);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfColor sfColor_modulate(sfColor color1, sfColor color2);
 
+////////////////////////////////////////////////////////////
+/// \brief Modulate an array of colors by a single color
+///
+/// This function gives exactly the same results as calling
+/// sfColor_modulate on each element of the array, but it
+/// processes several colors at once with SIMD instructions
+/// when they are available.
+///
+/// \param colors Array of colors to modulate, modified in place
+/// \param count  Number of elements in \a colors
+/// \param color  Color to multiply each element by
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfColor_modulateArray(sfColor* colors, size_t count, sfColor color);
+
 
 #endif // SFML_COLOR_H
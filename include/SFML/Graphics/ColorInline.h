@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_COLORINLINE_H
+#define SFML_COLORINLINE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.h>
+
+
+////////////////////////////////////////////////////////////
+/// \file
+///
+/// Header-only versions of the sfColor functions. They return
+/// exactly the same results as the exported functions, but
+/// the compiler can inline them instead of calling into the
+/// shared library, which matters in tight loops.
+///
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_fromRGBA
+///
+/// \param red   Red component   (0 .. 255)
+/// \param green Green component (0 .. 255)
+/// \param blue  Blue component  (0 .. 255)
+/// \param alpha Alpha component (0 .. 255)
+///
+/// \return sfColor constructed from the components
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_fromRGBAInline(sfUint8 red, sfUint8 green, sfUint8 blue, sfUint8 alpha)
+{
+    sfColor color;
+
+    color.r = red;
+    color.g = green;
+    color.b = blue;
+    color.a = alpha;
+
+    return color;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_fromRGB
+///
+/// \param red   Red component   (0 .. 255)
+/// \param green Green component (0 .. 255)
+/// \param blue  Blue component  (0 .. 255)
+///
+/// \return sfColor constructed from the components
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_fromRGBInline(sfUint8 red, sfUint8 green, sfUint8 blue)
+{
+    return sfColor_fromRGBAInline(red, green, blue, 255);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_fromInteger
+///
+/// \param color sfUint32 representation of the color
+///
+/// \return sfColor constructed from the 32-bit unsigned integer
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_fromIntegerInline(sfUint32 color)
+{
+    return sfColor_fromRGBAInline((sfUint8)((color & 0xff000000) >> 24),
+                                  (sfUint8)((color & 0x00ff0000) >> 16),
+                                  (sfUint8)((color & 0x0000ff00) >> 8),
+                                  (sfUint8)((color & 0x000000ff) >> 0));
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_toInteger
+///
+/// \param color sfColor object
+///
+/// \return Color represented as a 32-bit unsigned integer
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfUint32 sfColor_toIntegerInline(sfColor color)
+{
+    return ((sfUint32)color.r << 24) | ((sfUint32)color.g << 16) | ((sfUint32)color.b << 8) | (sfUint32)color.a;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_add
+///
+/// \param color1 First color
+/// \param color2 Second color
+///
+/// \return Component-wise saturated addition of the two colors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_addInline(sfColor color1, sfColor color2)
+{
+    int red   = color1.r + color2.r;
+    int green = color1.g + color2.g;
+    int blue  = color1.b + color2.b;
+    int alpha = color1.a + color2.a;
+
+    return sfColor_fromRGBAInline((sfUint8)(red   < 255 ? red   : 255),
+                                  (sfUint8)(green < 255 ? green : 255),
+                                  (sfUint8)(blue  < 255 ? blue  : 255),
+                                  (sfUint8)(alpha < 255 ? alpha : 255));
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_subtract
+///
+/// \param color1 First color
+/// \param color2 Second color
+///
+/// \return Component-wise saturated subtraction of the two colors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_subtractInline(sfColor color1, sfColor color2)
+{
+    int red   = color1.r - color2.r;
+    int green = color1.g - color2.g;
+    int blue  = color1.b - color2.b;
+    int alpha = color1.a - color2.a;
+
+    return sfColor_fromRGBAInline((sfUint8)(red   > 0 ? red   : 0),
+                                  (sfUint8)(green > 0 ? green : 0),
+                                  (sfUint8)(blue  > 0 ? blue  : 0),
+                                  (sfUint8)(alpha > 0 ? alpha : 0));
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfColor_modulate
+///
+/// \param color1 First color
+/// \param color2 Second color
+///
+/// \return Component-wise multiplication of the two colors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfColor sfColor_modulateInline(sfColor color1, sfColor color2)
+{
+    return sfColor_fromRGBAInline((sfUint8)(color1.r * color2.r / 255),
+                                  (sfUint8)(color1.g * color2.g / 255),
+                                  (sfUint8)(color1.b * color2.b / 255),
+                                  (sfUint8)(color1.a * color2.a / 255));
+}
+
+
+#endif // SFML_COLORINLINE_H
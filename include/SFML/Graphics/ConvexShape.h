@@ -63,6 +63,51 @@ CSFML_GRAPHICS_API sfConvexShape* sfConvexShape_copy(const sfConvexShape* shape)
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfConvexShape_destroy(sfConvexShape* shape);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfConvexShape structure
+///
+/// Together with sfConvexShape_alignof, this allows to store
+/// convex shapes in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfConvexShape_init.
+///
+/// \return Size of a convex shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfConvexShape_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfConvexShape structure
+///
+/// \return Required alignment of the memory of a convex shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfConvexShape_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a convex shape in memory owned by the caller
+///
+/// The convex shape is the same as one returned by sfConvexShape_create,
+/// but it must be destroyed with sfConvexShape_deinit instead of
+/// sfConvexShape_destroy.
+///
+/// \param memory Pointer to at least sfConvexShape_sizeof() bytes, aligned on sfConvexShape_alignof()
+///
+/// \return Pointer to the new convex shape (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfConvexShape* sfConvexShape_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a convex shape constructed with sfConvexShape_init
+///
+/// The memory of the convex shape is not released, and can be used
+/// to construct another one.
+///
+/// \param shape Convex shape to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfConvexShape_deinit(sfConvexShape* shape);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a convex shape
 ///
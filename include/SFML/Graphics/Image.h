@@ -33,10 +33,24 @@
 #include <SFML/Graphics/Rect.h>
 #include <SFML/Graphics/Types.h>
 #include <SFML/System/InputStream.h>
+#include <SFML/System/Types.h>
 #include <SFML/System/Vector2.h>
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Image file formats that CSFML can encode
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfImageFormatPng, ///< PNG, lossless, encoded in parallel with fast compression
+    sfImageFormatQoi, ///< QOI ("Quite OK Image"), lossless, much faster to encode and decode than PNG but larger
+    sfImageFormatBmp, ///< Uncompressed 32 bits BMP
+    sfImageFormatTga  ///< Uncompressed 32 bits TGA
+} sfImageFormat;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create an image
 ///
@@ -82,8 +96,8 @@ CSFML_GRAPHICS_API sfImage* sfImage_createFromPixels(unsigned int width, unsigne
 ////////////////////////////////////////////////////////////
 /// \brief Create an image from a file on disk
 ///
-/// The supported image formats are bmp, png, tga, jpg, gif,
-/// psd, hdr and pic. Some format options are not supported,
+/// The supported image formats are bmp, png, qoi, tga, jpg,
+/// gif, psd, hdr and pic. Some format options are not supported,
 /// like progressive jpeg.
 /// If this function fails, the image is left unchanged.
 ///
@@ -97,8 +111,8 @@ CSFML_GRAPHICS_API sfImage* sfImage_createFromFile(const char* filename);
 ////////////////////////////////////////////////////////////
 /// \brief Create an image from a file in memory
 ///
-/// The supported image formats are bmp, png, tga, jpg, gif,
-/// psd, hdr and pic. Some format options are not supported,
+/// The supported image formats are bmp, png, qoi, tga, jpg,
+/// gif, psd, hdr and pic. Some format options are not supported,
 /// like progressive jpeg.
 /// If this function fails, the image is left unchanged.
 ///
@@ -148,7 +162,7 @@ CSFML_GRAPHICS_API void sfImage_destroy(sfImage* image);
 ///
 /// The format of the image is automatically deduced from
 /// the extension. The supported image formats are bmp, png,
-/// tga and jpg. The destination file is overwritten
+/// qoi, tga and jpg. The destination file is overwritten
 /// if it already exists. This function fails if the image is empty.
 ///
 /// \param image    Image object
@@ -159,6 +173,44 @@ CSFML_GRAPHICS_API void sfImage_destroy(sfImage* image);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfBool sfImage_saveToFile(const sfImage* image, const char* filename);
 
+////////////////////////////////////////////////////////////
+/// \brief Save an image to a file on disk, in the background
+///
+/// The pixels are copied before this function returns, so the
+/// image can be modified or destroyed right away; the encoding
+/// and the writing of the file are done by a task of \a pool.
+/// The formats are the same as sfImage_saveToFile.
+///
+/// If \a success is not NULL, it receives the result of the
+/// save when the task finishes, so it must remain valid until
+/// then; read it after sfTask_wait or sfTask_isFinished.
+///
+/// \param image    Image object
+/// \param filename Path of the file to save
+/// \param pool     Task pool that runs the save, or NULL to use a pool shared by all images
+/// \param success  Receives sfTrue if saving was successful (can be NULL)
+///
+/// \return Task saving the image, to release with sfTask_release (NULL if the image is empty)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTask* sfImage_saveToFileAsync(const sfImage* image, const char* filename, sfTaskPool* pool, sfBool* success);
+
+////////////////////////////////////////////////////////////
+/// \brief Encode an image to memory
+///
+/// The returned buffer is allocated with sfMalloc and must be
+/// freed with sfFree. Large PNG images are filtered and
+/// compressed in parallel.
+///
+/// \param image       Image object
+/// \param format      Format of the encoded image
+/// \param sizeInBytes Receives the size of the returned buffer, in bytes
+///
+/// \return Encoded image (NULL if the image is empty or encoding failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void* sfImage_saveToMemory(const sfImage* image, sfImageFormat format, size_t* sizeInBytes);
+
 ////////////////////////////////////////////////////////////
 /// \brief Return the size of an image
 ///
@@ -29,6 +29,8 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.h>
+#include <SFML/System/Vector2.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -64,6 +66,24 @@ typedef struct
 CSFML_GRAPHICS_API sfBool sfFloatRect_contains(const sfFloatRect* rect, float x, float y);
 CSFML_GRAPHICS_API sfBool sfIntRect_contains(const sfIntRect* rect, int x, int y);
 
+////////////////////////////////////////////////////////////
+/// \brief Check which points of an array are inside a rectangle's area
+///
+/// This function gives exactly the same results as calling
+/// sfFloatRect_contains on each point of the array, but it
+/// processes several points at once with SIMD instructions
+/// when they are available.
+///
+/// \param rect    Rectangle to test
+/// \param points  Array of points to test
+/// \param count   Number of elements in \a points
+/// \param results Array of \a count elements, filled with sfTrue for each point that is inside
+///
+/// \return Number of points that are inside
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfFloatRect_containsPoints(const sfFloatRect* rect, const sfVector2f* points, size_t count, sfBool* results);
+
 ////////////////////////////////////////////////////////////
 /// \brief Check intersection between two rectangles
 ///
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RECTINLINE_H
+#define SFML_RECTINLINE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \file
+///
+/// Header-only versions of the sfFloatRect and sfIntRect
+/// functions. They return exactly the same results as the
+/// exported functions, but the compiler can inline them
+/// instead of calling into the shared library, which matters
+/// in tight loops. Unlike the exported functions, they don't
+/// check their rectangle arguments for NULL.
+///
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfFloatRect_contains
+///
+/// \param rect Rectangle to test
+/// \param x    X coordinate of the point to test
+/// \param y    Y coordinate of the point to test
+///
+/// \return sfTrue if the point is inside
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfBool sfFloatRect_containsInline(const sfFloatRect* rect, float x, float y)
+{
+    float right  = rect->left + rect->width;
+    float bottom = rect->top + rect->height;
+    float minX   = right < rect->left ? right : rect->left;
+    float maxX   = rect->left < right ? right : rect->left;
+    float minY   = bottom < rect->top ? bottom : rect->top;
+    float maxY   = rect->top < bottom ? bottom : rect->top;
+
+    return (x >= minX) && (x < maxX) && (y >= minY) && (y < maxY);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfIntRect_contains
+///
+/// \param rect Rectangle to test
+/// \param x    X coordinate of the point to test
+/// \param y    Y coordinate of the point to test
+///
+/// \return sfTrue if the point is inside
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfBool sfIntRect_containsInline(const sfIntRect* rect, int x, int y)
+{
+    int right  = rect->left + rect->width;
+    int bottom = rect->top + rect->height;
+    int minX   = right < rect->left ? right : rect->left;
+    int maxX   = rect->left < right ? right : rect->left;
+    int minY   = bottom < rect->top ? bottom : rect->top;
+    int maxY   = rect->top < bottom ? bottom : rect->top;
+
+    return (x >= minX) && (x < maxX) && (y >= minY) && (y < maxY);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfFloatRect_intersects
+///
+/// \param rect1        First rectangle to test
+/// \param rect2        Second rectangle to test
+/// \param intersection Rectangle to be filled with overlapping rect (can be NULL)
+///
+/// \return sfTrue if rectangles overlap
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfBool sfFloatRect_intersectsInline(const sfFloatRect* rect1, const sfFloatRect* rect2, sfFloatRect* intersection)
+{
+    float right1  = rect1->left + rect1->width;
+    float bottom1 = rect1->top + rect1->height;
+    float right2  = rect2->left + rect2->width;
+    float bottom2 = rect2->top + rect2->height;
+
+    float r1MinX = right1 < rect1->left ? right1 : rect1->left;
+    float r1MaxX = rect1->left < right1 ? right1 : rect1->left;
+    float r1MinY = bottom1 < rect1->top ? bottom1 : rect1->top;
+    float r1MaxY = rect1->top < bottom1 ? bottom1 : rect1->top;
+    float r2MinX = right2 < rect2->left ? right2 : rect2->left;
+    float r2MaxX = rect2->left < right2 ? right2 : rect2->left;
+    float r2MinY = bottom2 < rect2->top ? bottom2 : rect2->top;
+    float r2MaxY = rect2->top < bottom2 ? bottom2 : rect2->top;
+
+    float interLeft   = r1MinX < r2MinX ? r2MinX : r1MinX;
+    float interTop    = r1MinY < r2MinY ? r2MinY : r1MinY;
+    float interRight  = r2MaxX < r1MaxX ? r2MaxX : r1MaxX;
+    float interBottom = r2MaxY < r1MaxY ? r2MaxY : r1MaxY;
+
+    if ((interLeft < interRight) && (interTop < interBottom))
+    {
+        if (intersection)
+        {
+            intersection->left   = interLeft;
+            intersection->top    = interTop;
+            intersection->width  = interRight - interLeft;
+            intersection->height = interBottom - interTop;
+        }
+        return sfTrue;
+    }
+    else
+    {
+        if (intersection)
+        {
+            intersection->left   = 0;
+            intersection->top    = 0;
+            intersection->width  = 0;
+            intersection->height = 0;
+        }
+        return sfFalse;
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfIntRect_intersects
+///
+/// \param rect1        First rectangle to test
+/// \param rect2        Second rectangle to test
+/// \param intersection Rectangle to be filled with overlapping rect (can be NULL)
+///
+/// \return sfTrue if rectangles overlap
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfBool sfIntRect_intersectsInline(const sfIntRect* rect1, const sfIntRect* rect2, sfIntRect* intersection)
+{
+    int right1  = rect1->left + rect1->width;
+    int bottom1 = rect1->top + rect1->height;
+    int right2  = rect2->left + rect2->width;
+    int bottom2 = rect2->top + rect2->height;
+
+    int r1MinX = right1 < rect1->left ? right1 : rect1->left;
+    int r1MaxX = rect1->left < right1 ? right1 : rect1->left;
+    int r1MinY = bottom1 < rect1->top ? bottom1 : rect1->top;
+    int r1MaxY = rect1->top < bottom1 ? bottom1 : rect1->top;
+    int r2MinX = right2 < rect2->left ? right2 : rect2->left;
+    int r2MaxX = rect2->left < right2 ? right2 : rect2->left;
+    int r2MinY = bottom2 < rect2->top ? bottom2 : rect2->top;
+    int r2MaxY = rect2->top < bottom2 ? bottom2 : rect2->top;
+
+    int interLeft   = r1MinX < r2MinX ? r2MinX : r1MinX;
+    int interTop    = r1MinY < r2MinY ? r2MinY : r1MinY;
+    int interRight  = r2MaxX < r1MaxX ? r2MaxX : r1MaxX;
+    int interBottom = r2MaxY < r1MaxY ? r2MaxY : r1MaxY;
+
+    if ((interLeft < interRight) && (interTop < interBottom))
+    {
+        if (intersection)
+        {
+            intersection->left   = interLeft;
+            intersection->top    = interTop;
+            intersection->width  = interRight - interLeft;
+            intersection->height = interBottom - interTop;
+        }
+        return sfTrue;
+    }
+    else
+    {
+        if (intersection)
+        {
+            intersection->left   = 0;
+            intersection->top    = 0;
+            intersection->width  = 0;
+            intersection->height = 0;
+        }
+        return sfFalse;
+    }
+}
+
+
+#endif // SFML_RECTINLINE_H
@@ -63,6 +63,51 @@ CSFML_GRAPHICS_API sfRectangleShape* sfRectangleShape_copy(const sfRectangleShap
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfRectangleShape_destroy(sfRectangleShape* shape);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfRectangleShape structure
+///
+/// Together with sfRectangleShape_alignof, this allows to store
+/// rectangle shapes in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfRectangleShape_init.
+///
+/// \return Size of a rectangle shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRectangleShape_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfRectangleShape structure
+///
+/// \return Required alignment of the memory of a rectangle shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRectangleShape_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a rectangle shape in memory owned by the caller
+///
+/// The rectangle shape is the same as one returned by sfRectangleShape_create,
+/// but it must be destroyed with sfRectangleShape_deinit instead of
+/// sfRectangleShape_destroy.
+///
+/// \param memory Pointer to at least sfRectangleShape_sizeof() bytes, aligned on sfRectangleShape_alignof()
+///
+/// \return Pointer to the new rectangle shape (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRectangleShape* sfRectangleShape_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a rectangle shape constructed with sfRectangleShape_init
+///
+/// The memory of the rectangle shape is not released, and can be used
+/// to construct another one.
+///
+/// \param shape Rectangle shape to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRectangleShape_deinit(sfRectangleShape* shape);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a rectangle shape
 ///
@@ -295,6 +295,20 @@ CSFML_GRAPHICS_API void sfRenderTexture_resetGLStates(sfRenderTexture* renderTex
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfTexture* sfRenderTexture_getTexture(const sfRenderTexture* renderTexture);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying the contents of a render texture to an image, without waiting for the GPU
+///
+/// This function works like sfTexture_copyToImageAsync on the
+/// target texture: the contents are those of the last call to
+/// sfRenderTexture_display.
+///
+/// \param renderTexture Render texture object
+///
+/// \return A new sfTextureReadback object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureReadback* sfRenderTexture_readbackAsync(const sfRenderTexture* renderTexture);
+
 
 ////////////////////////////////////////////////////////////
 /// \brief Get the maximum anti-aliasing level supported by the system
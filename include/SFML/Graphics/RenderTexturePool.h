@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RENDERTEXTUREPOOL_H
+#define SFML_RENDERTEXTUREPOOL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+#include <SFML/Window/Window.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new render texture pool
+///
+/// A render texture pool recycles the render textures used as
+/// temporary targets, typically by post-processing effects,
+/// instead of creating and destroying them every frame or on
+/// every resize. Targets are matched by size and by the depth
+/// bits, stencil bits, antialiasing level and sRGB format of
+/// their settings.
+///
+/// \return A new sfRenderTexturePool object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderTexturePool* sfRenderTexturePool_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a render texture pool
+///
+/// All the render textures of the pool are destroyed, including
+/// the ones that are still acquired.
+///
+/// \param pool Render texture pool to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_destroy(sfRenderTexturePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Acquire a render texture from a pool
+///
+/// A free render texture with the same size and settings is
+/// returned if there's one, otherwise a new one is created.
+/// Its view is reset to the default view, but its contents are
+/// undefined: clear it before drawing. The render texture is
+/// owned by the pool and stays acquired until it is released or
+/// until the end of the frame.
+///
+/// \param pool     Render texture pool object
+/// \param width    Width of the render texture
+/// \param height   Height of the render texture
+/// \param settings Settings of the render texture, or NULL for the default settings (no depth buffer)
+///
+/// \return A render texture of the pool, or NULL if it couldn't be created
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderTexture* sfRenderTexturePool_acquire(sfRenderTexturePool* pool, unsigned int width, unsigned int height, const sfContextSettings* settings);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a render texture back to its pool before the end of the frame
+///
+/// The render texture can then be acquired again during the
+/// same frame, for example by the next pass of an effect. It
+/// must no longer be used by the caller.
+///
+/// \param pool          Render texture pool object
+/// \param renderTexture Render texture acquired from \a pool
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_release(sfRenderTexturePool* pool, sfRenderTexture* renderTexture);
+
+////////////////////////////////////////////////////////////
+/// \brief End the current frame
+///
+/// All the render textures acquired during the frame are
+/// released, and the transient targets declared with
+/// sfRenderTexturePool_addTransient are forgotten. The render
+/// textures that haven't been acquired for more frames than the
+/// limit set with sfRenderTexturePool_setMaxIdleFrames are
+/// destroyed, and then the least recently used ones until the
+/// memory budget is met.
+///
+/// \param pool Render texture pool object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_endFrame(sfRenderTexturePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy all the render textures of a pool that are not acquired
+///
+/// \param pool Render texture pool object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_trim(sfRenderTexturePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the number of frames a free render texture is kept
+///
+/// The default is 3 frames, which keeps the targets of
+/// effects that are skipped for a couple of frames but frees
+/// the targets of the old size soon after a resize.
+///
+/// \param pool      Render texture pool object
+/// \param maxFrames Number of frames without being acquired before a render texture is destroyed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_setMaxIdleFrames(sfRenderTexturePool* pool, unsigned int maxFrames);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the memory budget of a pool
+///
+/// At the end of each frame, free render textures are
+/// destroyed, least recently used first, until the memory used
+/// by the pool fits in the budget. Acquired render textures are
+/// never destroyed, so the budget can be exceeded during a
+/// frame.
+///
+/// \param pool   Render texture pool object
+/// \param budget Memory budget, in bytes (0 for no budget, the default)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexturePool_setMemoryBudget(sfRenderTexturePool* pool, size_t budget);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the video memory used by the render textures of a pool
+///
+/// The value is an estimate computed from the size and
+/// settings of the render textures: color texture, multisampled
+/// color buffer and depth-stencil buffer.
+///
+/// \param pool Render texture pool object
+///
+/// \return Estimated memory used by the pool, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRenderTexturePool_getMemoryUsage(const sfRenderTexturePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of render textures of a pool
+///
+/// \param pool Render texture pool object
+///
+/// \return Number of render textures, acquired or free
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRenderTexturePool_getTargetCount(const sfRenderTexturePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Declare a transient target of the current frame
+///
+/// Transient targets describe the intermediate targets of a
+/// chain of passes, numbered by the caller. A target is used
+/// from pass \a firstPass to pass \a lastPass included; targets
+/// with the same size and settings whose lifetimes don't
+/// overlap share the same render texture, which reduces the
+/// memory used by long effect chains.
+///
+/// All the transient targets of a frame must be declared before
+/// the first call to sfRenderTexturePool_getTransient.
+///
+/// \param pool      Render texture pool object
+/// \param width     Width of the target
+/// \param height    Height of the target
+/// \param settings  Settings of the target, or NULL for the default settings
+/// \param firstPass Index of the first pass that uses the target
+/// \param lastPass  Index of the last pass that uses the target
+///
+/// \return Identifier of the transient target, or -1 if the targets of the frame are already assigned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API int sfRenderTexturePool_addTransient(sfRenderTexturePool* pool, unsigned int width, unsigned int height, const sfContextSettings* settings, unsigned int firstPass, unsigned int lastPass);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the render texture of a transient target
+///
+/// The first call of a frame assigns render textures to all
+/// the transient targets declared during the frame, acquiring
+/// them from the pool. They are released at the end of the
+/// frame.
+///
+/// \param pool      Render texture pool object
+/// \param transient Identifier returned by sfRenderTexturePool_addTransient
+///
+/// \return Render texture of the target, or NULL if the identifier is invalid or the render texture couldn't be created
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderTexture* sfRenderTexturePool_getTransient(sfRenderTexturePool* pool, int transient);
+
+
+#endif // SFML_RENDERTEXTUREPOOL_H
@@ -74,6 +74,46 @@ CSFML_GRAPHICS_API sfRenderWindow* sfRenderWindow_createUnicode(sfVideoMode mode
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfRenderWindow* sfRenderWindow_createFromHandle(sfWindowHandle handle, const sfContextSettings* settings);
 
+////////////////////////////////////////////////////////////
+/// \brief Construct a new render window whose events are collected by an input thread
+///
+/// This function works like sfRenderWindow_create, except that the
+/// render window is created by a dedicated high priority thread, which
+/// then pulls its events from the system as they arrive (it
+/// checks for new ones every millisecond), stamps them with the
+/// time of sfClock_getCurrentTime and pushes them to a lock-free
+/// queue. The thread that renders to the render window consumes them
+/// with sfRenderWindow_pollEvent, sfRenderWindow_pollEvents,
+/// sfRenderWindow_waitEvent or sfRenderWindow_pollTimedEvent (no other
+/// thread may call these functions for this render window), and
+/// can compare the timestamps to the time a frame is displayed
+/// to measure input latency, or handle input in the middle of
+/// a frame.
+///
+/// The OpenGL context of the render window is left inactive by the
+/// input thread, so that the rendering thread can activate it.
+/// sfRenderWindow_close and sfRenderWindow_destroy are forwarded
+/// to the input thread, which owns the render window. The other
+/// functions that modify the render window (size, position, title,
+/// cursor, ...) are not synchronized with the input thread.
+/// A thread blocked in sfRenderWindow_waitEvent returns sfFalse
+/// when the window is closed or destroyed.
+///
+/// On Linux and FreeBSD, this function enables the thread
+/// support of Xlib: create the render window before any other
+/// window or context. This mode is not available on macOS,
+/// where windows can only be created by the main thread.
+///
+/// \param mode     Video mode to use (defines the width, height and depth of the rendering area of the window)
+/// \param title    Title of the window
+/// \param style    Window style
+/// \param settings Additional settings for the underlying OpenGL context
+///
+/// \return A new sfRenderWindow object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderWindow* sfRenderWindow_createWithEventQueue(sfVideoMode mode, const char* title, sfUint32 style, const sfContextSettings* settings);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy an existing render window
 ///
@@ -119,6 +159,42 @@ CSFML_GRAPHICS_API sfContextSettings sfRenderWindow_getSettings(const sfRenderWi
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfBool sfRenderWindow_pollEvent(sfRenderWindow* renderWindow, sfEvent* event);
 
+////////////////////////////////////////////////////////////
+/// \brief Pop many events from the event queue at once
+///
+/// This function works like sfRenderWindow_pollEvent called in a loop,
+/// but converts up to \a capacity events in a single call. Events
+/// that don't fit in \a events are left in the queue, so that
+/// nothing is lost: call it again while it returns \a capacity.
+///
+/// \param renderWindow Render window object
+/// \param events       Array receiving the events
+/// \param capacity     Maximum number of events to write to \a events
+///
+/// \return Number of events written to \a events (0 if the queue was empty)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRenderWindow_pollEvents(sfRenderWindow* renderWindow, sfEvent* events, size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Pop many events from the event queue at once, merging consecutive moves
+///
+/// This function works like sfRenderWindow_pollEvents, except that
+/// consecutive sfEvtMouseMoved events, consecutive sfEvtJoystickMoved
+/// events of the same joystick axis, and consecutive sfEvtTouchMoved
+/// events of the same finger are merged into the last one. This keeps
+/// high rate devices (such as 8 kHz mice) from flooding the buffer
+/// with intermediate positions.
+///
+/// \param renderWindow Render window object
+/// \param events       Array receiving the events
+/// \param capacity     Maximum number of events to write to \a events
+///
+/// \return Number of events written to \a events (0 if the queue was empty)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfRenderWindow_pollEventsCoalesced(sfRenderWindow* renderWindow, sfEvent* events, size_t capacity);
+
 ////////////////////////////////////////////////////////////
 /// \brief Wait for an event and return it
 ///
@@ -130,6 +206,22 @@ CSFML_GRAPHICS_API sfBool sfRenderWindow_pollEvent(sfRenderWindow* renderWindow,
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfBool sfRenderWindow_waitEvent(sfRenderWindow* renderWindow, sfEvent* event);
 
+////////////////////////////////////////////////////////////
+/// \brief Pop the event on top of event queue, if any, with its timestamp
+///
+/// This function works like sfRenderWindow_pollEvent. For windows
+/// created with sfRenderWindow_createWithEventQueue, the timestamp
+/// is the time at which the input thread received the event;
+/// otherwise it is the time of this call.
+///
+/// \param renderWindow Render window object
+/// \param event        Event to fill, if any
+///
+/// \return sfTrue if an event was returned, sfFalse if event queue was empty
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfRenderWindow_pollTimedEvent(sfRenderWindow* renderWindow, sfTimedEvent* event);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the position of a render window
 ///
@@ -555,6 +647,22 @@ CSFML_GRAPHICS_API void sfRenderWindow_resetGLStates(sfRenderWindow* renderWindo
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API CSFML_DEPRECATED sfImage* sfRenderWindow_capture(const sfRenderWindow* renderWindow);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying the contents of a render window to an image, without waiting for the GPU
+///
+/// The contents being drawn are read, so this function must
+/// be called before sfRenderWindow_display. Like
+/// sfTexture_copyToImageAsync, it only queues the transfer
+/// and returns immediately, which makes it suitable to record
+/// every frame of the window.
+///
+/// \param renderWindow Render window object
+///
+/// \return A new sfTextureReadback object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureReadback* sfRenderWindow_readbackAsync(sfRenderWindow* renderWindow);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the current position of the mouse relative to a render-window
 ///
@@ -398,6 +398,198 @@ CSFML_GRAPHICS_API void sfShader_setMat3UniformArray(sfShader* shader, const cha
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfShader_setMat4UniformArray(sfShader* shader, const char* name, const sfGlslMat4* matrixArray, size_t length);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the handle of a uniform variable
+///
+/// Looking a uniform up by name has a cost on every call of
+/// the sfShader_set*Uniform functions; get the handle once
+/// and pass it to the sfShader_set*UniformAt functions or to
+/// a sfShaderUniformBlock instead. The handle remains valid
+/// for the lifetime of the shader.
+/// Uniforms are best set by handle while the render target
+/// that draws with the shader is active; without an active
+/// context, every call has to create a temporary one.
+///
+/// \param shader Shader object
+/// \param name   Name of the uniform variable in GLSL
+///
+/// \return Handle of the uniform, or -1 if the shader has no active uniform with this name
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API int sfShader_getUniformLocation(sfShader* shader, const char* name);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p float uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the float scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setFloatUniformAt(sfShader* shader, int location, float x);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p vec2 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec2 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setVec2UniformAt(sfShader* shader, int location, sfGlslVec2 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p vec3 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec3 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setVec3UniformAt(sfShader* shader, int location, sfGlslVec3 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p vec4 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec4 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setVec4UniformAt(sfShader* shader, int location, sfGlslVec4 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p vec4 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param color    Value of the vec4 vector, normalized from the color
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setColorUniformAt(sfShader* shader, int location, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p int uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the int scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setIntUniformAt(sfShader* shader, int location, int x);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p ivec2 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec2 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setIvec2UniformAt(sfShader* shader, int location, sfGlslIvec2 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p ivec3 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec3 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setIvec3UniformAt(sfShader* shader, int location, sfGlslIvec3 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p ivec4 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec4 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setIvec4UniformAt(sfShader* shader, int location, sfGlslIvec4 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p bool uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the bool scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setBoolUniformAt(sfShader* shader, int location, sfBool x);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p mat3 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param matrix   Value of the mat3 matrix
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setMat3UniformAt(sfShader* shader, int location, const sfGlslMat3* matrix);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p mat4 uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param matrix   Value of the mat4 matrix
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setMat4UniformAt(sfShader* shader, int location, const sfGlslMat4* matrix);
+
+////////////////////////////////////////////////////////////
+/// \brief Specify value for \p sampler2D uniform, from its handle
+///
+/// Nothing happens if the value is the same as the last one
+/// set through this handle.
+///
+/// The texture unit is managed by SFML, like with
+/// sfShader_setTextureUniform.
+///
+/// \param shader   Shader object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param texture  Texture to assign
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setTextureUniformAt(sfShader* shader, int location, const sfTexture* texture);
+
 ////////////////////////////////////////////////////////////
 /// \brief Change a float parameter of a shader
 ///
@@ -713,4 +905,48 @@ CSFML_GRAPHICS_API sfBool sfShader_isAvailable(void);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfBool sfShader_isGeometryAvailable(void);
 
+////////////////////////////////////////////////////////////
+/// \brief Set the directory of the program binary cache
+///
+/// When a cache directory is set, the programs linked by the
+/// sfShader_createFrom* functions are saved to it with
+/// glGetProgramBinary, and later loads of the same sources
+/// with the same driver and GPU reuse the saved binaries
+/// instead of compiling the sources again. Shaders loaded
+/// from files or streams are read entirely first, since the
+/// cache is keyed by the shader sources.
+///
+/// Cached binaries that the driver rejects (after a driver
+/// update for instance) are deleted and the shader is compiled
+/// from its sources, so the cache never makes loading fail.
+/// Drivers that provide no binary format don't use the cache,
+/// and those that can't load their own binaries, like some
+/// Mesa software renderers, compile the sources every time.
+///
+/// The directory must exist and be writable. The cache is
+/// disabled by default.
+///
+/// \param directory Path of the cache directory, or NULL to disable the cache
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShader_setProgramCacheDirectory(const char* directory);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the driver can cache program binaries
+///
+/// \return sfTrue if program binaries can be saved and loaded, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfShader_isProgramCacheAvailable(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether a shader was loaded from the program binary cache
+///
+/// \param shader Shader object
+///
+/// \return sfTrue if the program was loaded from the cache, sfFalse if it was compiled
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfShader_isLoadedFromProgramCache(const sfShader* shader);
+
 #endif // SFML_SHADER_H
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SHADERLIBRARY_H
+#define SFML_SHADERLIBRARY_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Compilation status of a shader variant
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfShaderVariantPending, ///< The variant is waiting to be compiled, or being compiled
+    sfShaderVariantReady,   ///< The variant is compiled and can be used
+    sfShaderVariantFailed   ///< The variant failed to compile
+} sfShaderVariantStatus;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new shader library
+///
+/// A shader library generates variants of a shader from
+/// source templates and sets of preprocessor definitions, and
+/// compiles them in background threads. Each thread compiles
+/// on its own OpenGL context, which shares its objects with
+/// the contexts of the windows and render textures, so
+/// requesting a variant never stalls the render thread.
+///
+/// The templates follow the same rules as the sources of
+/// sfShader_createFromMemory: \a geometryTemplate can be NULL,
+/// and so can either \a vertexTemplate or \a fragmentTemplate
+/// (but not both).
+///
+/// \param vertexTemplate   Source of the vertex shader, or NULL
+/// \param geometryTemplate Source of the geometry shader, or NULL
+/// \param fragmentTemplate Source of the fragment shader, or NULL
+/// \param threadCount      Number of compilation threads (0 for one)
+///
+/// \return A new sfShaderLibrary object (NULL if all the templates are NULL)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShaderLibrary* sfShaderLibrary_create(const char* vertexTemplate, const char* geometryTemplate, const char* fragmentTemplate, unsigned int threadCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a shader library
+///
+/// Variants still waiting to be compiled are dropped. The
+/// shaders of all the variants are destroyed, so they must no
+/// longer be used.
+///
+/// \param library Shader library to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderLibrary_destroy(sfShaderLibrary* library);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a variant to a shader library
+///
+/// Each definition is either "NAME" or "NAME=VALUE", and
+/// becomes a "#define NAME VALUE" line inserted in every
+/// stage, after the \p #version directive if there's one.
+/// The order of the definitions doesn't matter: sets that
+/// contain the same definitions are the same variant, and
+/// adding it again only returns its identifier.
+///
+/// A new variant is queued for compilation and the function
+/// returns immediately.
+///
+/// \param library     Shader library object
+/// \param defines     Array of preprocessor definitions
+/// \param defineCount Number of elements in \a defines
+///
+/// \return Identifier of the variant, or -1 if a definition is invalid
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API int sfShaderLibrary_addVariant(sfShaderLibrary* library, const char* const* defines, size_t defineCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of variants of a shader library
+///
+/// \param library Shader library object
+///
+/// \return Number of variants; valid identifiers are in [0, count - 1]
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfShaderLibrary_getVariantCount(const sfShaderLibrary* library);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the compilation status of a variant
+///
+/// \param library Shader library object
+/// \param variant Identifier of the variant
+///
+/// \return Status of the variant (sfShaderVariantFailed if the identifier is invalid)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShaderVariantStatus sfShaderLibrary_getVariantStatus(const sfShaderLibrary* library, int variant);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the variant used while other variants are not ready
+///
+/// By default, the first variant added to the library is the
+/// default variant. Use sfShaderLibrary_waitVariant to make
+/// sure that it is compiled before drawing.
+///
+/// \param library Shader library object
+/// \param variant Identifier of the default variant
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderLibrary_setDefaultVariant(sfShaderLibrary* library, int variant);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the shader to use for a variant
+///
+/// If the variant is not compiled yet, or failed to compile,
+/// the shader of the default variant is returned instead.
+/// This function doesn't wait for any compilation.
+///
+/// The shader is owned by the library, it must not be
+/// destroyed.
+///
+/// \param library Shader library object
+/// \param variant Identifier of the variant
+///
+/// \return Shader of the variant or of the default variant, or NULL if neither is ready
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShader* sfShaderLibrary_getShader(sfShaderLibrary* library, int variant);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until a variant is compiled
+///
+/// If the variant is still waiting for a compilation thread,
+/// it is compiled by the calling thread right away.
+///
+/// \param library Shader library object
+/// \param variant Identifier of the variant
+///
+/// \return Status of the variant: sfShaderVariantReady or sfShaderVariantFailed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShaderVariantStatus sfShaderLibrary_waitVariant(sfShaderLibrary* library, int variant);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until all the variants of a library are compiled
+///
+/// \param library Shader library object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderLibrary_waitAll(sfShaderLibrary* library);
+
+
+#endif // SFML_SHADERLIBRARY_H
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SHADERUNIFORMBLOCK_H
+#define SFML_SHADERUNIFORMBLOCK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Color.h>
+#include <SFML/Graphics/Glsl.h>
+#include <SFML/Graphics/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new uniform block
+///
+/// A uniform block records the values of many uniforms of a
+/// shader, typically the parameters of a material, and sets
+/// them all with one call to sfShaderUniformBlock_apply. The
+/// uniforms are identified by the handles returned by
+/// sfShader_getUniformLocation, so a block must only be
+/// applied to the shader whose handles were used to fill it.
+///
+/// \return A new sfShaderUniformBlock object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShaderUniformBlock* sfShaderUniformBlock_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a uniform block
+///
+/// \param block Uniform block to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_destroy(sfShaderUniformBlock* block);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the values of a uniform block
+///
+/// \param block Uniform block object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_clear(sfShaderUniformBlock* block);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of values recorded in a uniform block
+///
+/// \param block Uniform block object
+///
+/// \return Number of uniforms that have a value in the block
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfShaderUniformBlock_getValueCount(const sfShaderUniformBlock* block);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p float uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the float scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setFloat(sfShaderUniformBlock* block, int location, float x);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p vec2 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec2 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setVec2(sfShaderUniformBlock* block, int location, sfGlslVec2 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p vec3 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec3 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setVec3(sfShaderUniformBlock* block, int location, sfGlslVec3 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p vec4 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the vec4 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setVec4(sfShaderUniformBlock* block, int location, sfGlslVec4 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p vec4 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param color    Value of the vec4 vector, normalized from the color
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setColor(sfShaderUniformBlock* block, int location, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p int uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the int scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setInt(sfShaderUniformBlock* block, int location, int x);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p ivec2 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec2 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setIvec2(sfShaderUniformBlock* block, int location, sfGlslIvec2 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p ivec3 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec3 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setIvec3(sfShaderUniformBlock* block, int location, sfGlslIvec3 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p ivec4 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param vector   Value of the ivec4 vector
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setIvec4(sfShaderUniformBlock* block, int location, sfGlslIvec4 vector);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p bool uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param x        Value of the bool scalar
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setBool(sfShaderUniformBlock* block, int location, sfBool x);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p mat3 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param matrix   Value of the mat3 matrix
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setMat3(sfShaderUniformBlock* block, int location, const sfGlslMat3* matrix);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p mat4 uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param matrix   Value of the mat4 matrix
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setMat4(sfShaderUniformBlock* block, int location, const sfGlslMat4* matrix);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the value of a \p sampler2D uniform in a uniform block
+///
+/// The value replaces any previous value of the same uniform.
+///
+/// \param block    Uniform block object
+/// \param location Handle of the uniform, returned by sfShader_getUniformLocation (-1 is ignored)
+/// \param texture  Texture to assign (must remain alive while the block uses it)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShaderUniformBlock_setTexture(sfShaderUniformBlock* block, int location, const sfTexture* texture);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the uniforms of a shader to the values of a uniform block
+///
+/// The program of the shader is bound once for all the values,
+/// and the values that are the same as the last ones set
+/// through the handles of the shader (by a block or by the
+/// sfShader_set*UniformAt functions) are skipped. Setting a
+/// uniform by name makes the shader forget the last values,
+/// so everything is set by the next call.
+///
+/// \param block  Uniform block object
+/// \param shader Shader whose handles were used to fill the block
+///
+/// \return Number of values that were actually set
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfShaderUniformBlock_apply(const sfShaderUniformBlock* block, sfShader* shader);
+
+
+#endif // SFML_SHADERUNIFORMBLOCK_H
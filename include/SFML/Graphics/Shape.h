@@ -62,6 +62,57 @@ CSFML_GRAPHICS_API sfShape* sfShape_create(sfShapeGetPointCountCallback getPoint
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfShape_destroy(sfShape* shape);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfShape structure
+///
+/// Together with sfShape_alignof, this allows to store
+/// shapes in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfShape_init.
+///
+/// \return Size of a shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfShape_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfShape structure
+///
+/// \return Required alignment of the memory of a shape, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfShape_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a shape in memory owned by the caller
+///
+/// The shape is the same as one returned by sfShape_create,
+/// but it must be destroyed with sfShape_deinit instead of
+/// sfShape_destroy.
+///
+/// \param memory        Pointer to at least sfShape_sizeof() bytes, aligned on sfShape_alignof()
+/// \param getPointCount Callback that provides the point count of the shape
+/// \param getPoint      Callback that provides the points of the shape
+/// \param userData      Data to pass to the callback functions
+///
+/// \return Pointer to the new shape (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfShape* sfShape_init(void* memory,
+                                         sfShapeGetPointCountCallback getPointCount,
+                                         sfShapeGetPointCallback getPoint,
+                                         void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a shape constructed with sfShape_init
+///
+/// The memory of the shape is not released, and can be used
+/// to construct another one.
+///
+/// \param shape Shape to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfShape_deinit(sfShape* shape);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a shape
 ///
@@ -35,6 +35,7 @@
 #include <SFML/Graphics/Transform.h>
 #include <SFML/Graphics/Types.h>
 #include <SFML/System/Vector2.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -63,6 +64,51 @@ CSFML_GRAPHICS_API sfSprite* sfSprite_copy(const sfSprite* sprite);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfSprite_destroy(sfSprite* sprite);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfSprite structure
+///
+/// Together with sfSprite_alignof, this allows to store
+/// sprites in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfSprite_init.
+///
+/// \return Size of a sprite, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfSprite_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfSprite structure
+///
+/// \return Required alignment of the memory of a sprite, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfSprite_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a sprite in memory owned by the caller
+///
+/// The sprite is the same as one returned by sfSprite_create,
+/// but it must be destroyed with sfSprite_deinit instead of
+/// sfSprite_destroy.
+///
+/// \param memory Pointer to at least sfSprite_sizeof() bytes, aligned on sfSprite_alignof()
+///
+/// \return Pointer to the new sprite (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfSprite* sfSprite_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a sprite constructed with sfSprite_init
+///
+/// The memory of the sprite is not released, and can be used
+/// to construct another one.
+///
+/// \param sprite Sprite to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSprite_deinit(sfSprite* sprite);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a sprite
 ///
@@ -76,6 +76,51 @@ CSFML_GRAPHICS_API sfText* sfText_copy(const sfText* text);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfText_destroy(sfText* text);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfText structure
+///
+/// Together with sfText_alignof, this allows to store
+/// texts in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfText_init.
+///
+/// \return Size of a text, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfText_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfText structure
+///
+/// \return Required alignment of the memory of a text, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfText_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a text in memory owned by the caller
+///
+/// The text is the same as one returned by sfText_create,
+/// but it must be destroyed with sfText_deinit instead of
+/// sfText_destroy.
+///
+/// \param memory Pointer to at least sfText_sizeof() bytes, aligned on sfText_alignof()
+///
+/// \return Pointer to the new text (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfText* sfText_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a text constructed with sfText_init
+///
+/// The memory of the text is not released, and can be used
+/// to construct another one.
+///
+/// \param text Text to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfText_deinit(sfText* text);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a text
 ///
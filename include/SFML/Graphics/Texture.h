@@ -37,6 +37,25 @@
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Formats of the pixels stored in KTX and DDS files
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfTextureFormatRgba8,    ///< Uncompressed 8 bits RGBA pixels
+    sfTextureFormatBc1,      ///< BC1 (DXT1), RGB with 1 bit alpha, 8 bytes per 4x4 block
+    sfTextureFormatBc2,      ///< BC2 (DXT3), RGB with explicit 4 bits alpha, 16 bytes per 4x4 block
+    sfTextureFormatBc3,      ///< BC3 (DXT5), RGB with interpolated alpha, 16 bytes per 4x4 block
+    sfTextureFormatBc4,      ///< BC4 (RGTC1), single red channel, 8 bytes per 4x4 block
+    sfTextureFormatBc5,      ///< BC5 (RGTC2), red and green channels, 16 bytes per 4x4 block
+    sfTextureFormatBc7,      ///< BC7 (BPTC), high quality RGBA, 16 bytes per 4x4 block
+    sfTextureFormatEtc2Rgb,  ///< ETC2 RGB (and ETC1), 8 bytes per 4x4 block
+    sfTextureFormatEtc2Rgba, ///< ETC2 RGBA with EAC alpha, 16 bytes per 4x4 block
+    sfTextureFormatAstc      ///< ASTC LDR, any block size from 4x4 to 12x12, 16 bytes per block
+} sfTextureFormat;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new texture
 ///
@@ -93,6 +112,92 @@ CSFML_GRAPHICS_API sfTexture* sfTexture_createFromStream(sfInputStream* stream,
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfTexture* sfTexture_createFromImage(const sfImage* image, const sfIntRect* area);
 
+////////////////////////////////////////////////////////////
+/// \brief Create a new texture from a KTX file
+///
+/// Both KTX 1 and KTX 2 (without supercompression) files are
+/// supported, in any of the formats of sfTextureFormat. The
+/// blocks of compressed formats are uploaded as they are when
+/// the graphics driver supports the format (see
+/// sfTexture_isFormatSupported), so the texture takes as much
+/// video memory as the file and nothing has to be decoded.
+/// Otherwise they are decoded to RGBA pixels on the CPU.
+///
+/// The mipmap levels stored in the file are uploaded too, and
+/// the texture then samples them when it is minified. Calling
+/// sfTexture_setSmooth on such a texture disables them, use
+/// sfTexture_generateMipmap to get them back (from the full
+/// size level).
+///
+/// Rows must be stored from top to bottom, like in an image.
+/// sRGB formats are loaded as linear ones, use sfTexture_setSrgb
+/// before loading other textures to keep things consistent.
+/// Compressed textures can't be updated with sfTexture_update*
+/// functions. Arrays, cubemaps and 3D textures are not
+/// supported.
+///
+/// \param filename Path of the KTX file to load
+///
+/// \return A new sfTexture object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTexture* sfTexture_createFromKTX(const char* filename);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new texture from a KTX file in memory
+///
+/// See sfTexture_createFromKTX for details.
+///
+/// \param data        Pointer to the file data in memory
+/// \param sizeInBytes Size of the data to load, in bytes
+///
+/// \return A new sfTexture object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTexture* sfTexture_createFromKTXMemory(const void* data, size_t sizeInBytes);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new texture from a DDS file
+///
+/// DDS files can contain BC1 to BC5 (DXT1 to DXT5, ATI1 and
+/// ATI2), BC7 with the DX10 header, or uncompressed pixels with
+/// 8, 16, 24 or 32 bits per pixel, which are converted to RGBA.
+/// Everything else works like sfTexture_createFromKTX.
+///
+/// \param filename Path of the DDS file to load
+///
+/// \return A new sfTexture object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTexture* sfTexture_createFromDDS(const char* filename);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new texture from a DDS file in memory
+///
+/// See sfTexture_createFromDDS for details.
+///
+/// \param data        Pointer to the file data in memory
+/// \param sizeInBytes Size of the data to load, in bytes
+///
+/// \return A new sfTexture object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTexture* sfTexture_createFromDDSMemory(const void* data, size_t sizeInBytes);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the graphics driver can sample a texture format directly
+///
+/// Textures in an unsupported format can still be loaded,
+/// they are decoded on the CPU and take 4 bytes per pixel.
+/// sfTextureFormatRgba8 is always supported.
+///
+/// \param format Texture format to check
+///
+/// \return sfTrue if textures in this format are uploaded without decoding them
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfTexture_isFormatSupported(sfTextureFormat format);
+
 ////////////////////////////////////////////////////////////
 /// \brief Copy an existing texture
 ///
@@ -131,6 +236,26 @@ CSFML_GRAPHICS_API sfVector2u sfTexture_getSize(const sfTexture* texture);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfImage* sfTexture_copyToImage(const sfTexture* texture);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying a texture's pixels to an image, without waiting for the GPU
+///
+/// Unlike sfTexture_copyToImage, this function doesn't stall
+/// until the GPU has finished rendering to the texture: it
+/// queues a transfer to a pixel buffer object and returns
+/// immediately. The image is usually available one or two
+/// frames later; see sfTextureReadback_isReady.
+///
+/// If the driver doesn't support pixel buffer objects, the
+/// pixels are copied synchronously and the readback is
+/// ready immediately.
+///
+/// \param texture Texture to copy
+///
+/// \return A new sfTextureReadback object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureReadback* sfTexture_copyToImageAsync(const sfTexture* texture);
+
 ////////////////////////////////////////////////////////////
 /// \brief Update a texture from an array of pixels
 ///
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREREADBACK_H
+#define SFML_TEXTUREREADBACK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+#include <SFML/System/Vector2.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a texture readback
+///
+/// The readback can be destroyed before it's ready, in which
+/// case its result is discarded. Its pixel buffer is kept to
+/// be reused by the next readbacks.
+///
+/// \param readback Texture readback to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureReadback_destroy(sfTextureReadback* readback);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the pixels of a readback have been transferred
+///
+/// When this function returns sfTrue, sfTextureReadback_getImage
+/// doesn't wait for the GPU. If the driver doesn't support sync
+/// objects, this function always returns sfTrue.
+///
+/// \param readback Texture readback object
+///
+/// \return sfTrue if the result is available, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfTextureReadback_isReady(const sfTextureReadback* readback);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the image of a readback
+///
+/// \param readback Texture readback object
+///
+/// \return Size of the image, in pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfVector2u sfTextureReadback_getSize(const sfTextureReadback* readback);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the pixels of a readback as a new image
+///
+/// If the readback is not ready yet, this function waits until
+/// the transfer is complete.
+///
+/// \param readback Texture readback object
+///
+/// \return A new sfImage object containing the pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfImage* sfTextureReadback_getImage(sfTextureReadback* readback);
+
+
+#endif // SFML_TEXTUREREADBACK_H
@@ -32,6 +32,7 @@
 #include <SFML/Graphics/Types.h>
 #include <SFML/Graphics/Transform.h>
 #include <SFML/System/Vector2.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -60,6 +61,51 @@ CSFML_GRAPHICS_API sfTransformable* sfTransformable_copy(const sfTransformable*
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfTransformable_destroy(sfTransformable* transformable);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfTransformable structure
+///
+/// Together with sfTransformable_alignof, this allows to store
+/// transformables in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfTransformable_init.
+///
+/// \return Size of a transformable, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfTransformable_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfTransformable structure
+///
+/// \return Required alignment of the memory of a transformable, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfTransformable_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a transformable in memory owned by the caller
+///
+/// The transformable is the same as one returned by sfTransformable_create,
+/// but it must be destroyed with sfTransformable_deinit instead of
+/// sfTransformable_destroy.
+///
+/// \param memory Pointer to at least sfTransformable_sizeof() bytes, aligned on sfTransformable_alignof()
+///
+/// \return Pointer to the new transformable (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTransformable* sfTransformable_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a transformable constructed with sfTransformable_init
+///
+/// The memory of the transformable is not released, and can be used
+/// to construct another one.
+///
+/// \param transformable Transformable to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformable_deinit(sfTransformable* transformable);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the position of a transformable
 ///
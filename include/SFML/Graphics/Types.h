@@ -31,13 +31,17 @@ typedef struct sfConvexShape sfConvexShape;
 typedef struct sfFont sfFont;
 typedef struct sfImage sfImage;
 typedef struct sfShader sfShader;
+typedef struct sfShaderLibrary sfShaderLibrary;
+typedef struct sfShaderUniformBlock sfShaderUniformBlock;
 typedef struct sfRectangleShape sfRectangleShape;
 typedef struct sfRenderTexture sfRenderTexture;
+typedef struct sfRenderTexturePool sfRenderTexturePool;
 typedef struct sfRenderWindow sfRenderWindow;
 typedef struct sfShape sfShape;
 typedef struct sfSprite sfSprite;
 typedef struct sfText sfText;
 typedef struct sfTexture sfTexture;
+typedef struct sfTextureReadback sfTextureReadback;
 typedef struct sfTransformable sfTransformable;
 typedef struct sfVertexArray sfVertexArray;
 typedef struct sfVertexBuffer sfVertexBuffer;
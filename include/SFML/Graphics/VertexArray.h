@@ -62,6 +62,51 @@ CSFML_GRAPHICS_API sfVertexArray* sfVertexArray_copy(const sfVertexArray* vertex
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfVertexArray_destroy(sfVertexArray* vertexArray);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the size of the sfVertexArray structure
+///
+/// Together with sfVertexArray_alignof, this allows to store
+/// vertex arrays in memory owned by the caller, for example in a
+/// contiguous array, and to construct them with sfVertexArray_init.
+///
+/// \return Size of a vertex array, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfVertexArray_sizeof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the alignment of the sfVertexArray structure
+///
+/// \return Required alignment of the memory of a vertex array, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfVertexArray_alignof(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Construct a vertex array in memory owned by the caller
+///
+/// The vertex array is the same as one returned by sfVertexArray_create,
+/// but it must be destroyed with sfVertexArray_deinit instead of
+/// sfVertexArray_destroy.
+///
+/// \param memory Pointer to at least sfVertexArray_sizeof() bytes, aligned on sfVertexArray_alignof()
+///
+/// \return Pointer to the new vertex array (at the address \a memory), or NULL if \a memory is NULL or misaligned
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfVertexArray* sfVertexArray_init(void* memory);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a vertex array constructed with sfVertexArray_init
+///
+/// The memory of the vertex array is not released, and can be used
+/// to construct another one.
+///
+/// \param vertexArray Vertex array to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_deinit(sfVertexArray* vertexArray);
+
 ////////////////////////////////////////////////////////////
 /// \brief Return the vertex count of a vertex array
 ///
@@ -30,14 +30,26 @@
 ////////////////////////////////////////////////////////////
 
 #include <SFML/Config.h>
+#include <SFML/System/Allocator.h>
+#include <SFML/System/Atomic.h>
 #include <SFML/System/Clock.h>
+#include <SFML/System/Condition.h>
+#include <SFML/System/Error.h>
+#include <SFML/System/FastMutex.h>
+#include <SFML/System/FramePacer.h>
 #include <SFML/System/InputStream.h>
 #include <SFML/System/Mutex.h>
+#include <SFML/System/Profiler.h>
+#include <SFML/System/Queue.h>
+#include <SFML/System/RwLock.h>
 #include <SFML/System/Sleep.h>
+#include <SFML/System/TaskPool.h>
 #include <SFML/System/Thread.h>
 #include <SFML/System/Time.h>
+#include <SFML/System/TimeInline.h>
 #include <SFML/System/Vector2.h>
 #include <SFML/System/Vector3.h>
+#include <SFML/System/VectorInline.h>
 
 
 #endif // SFML_SYSTEM_H
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_ALLOCATOR_H
+#define SFML_ALLOCATOR_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <stddef.h>
+
+
+typedef void* (*sfAllocateFunction)(size_t size, void* userData);           ///< Type of the function that allocates memory
+typedef void  (*sfDeallocateFunction)(void* pointer, void* userData);       ///< Type of the function that releases memory
+typedef void* (*sfReallocateFunction)(void* pointer, size_t size, void* userData); ///< Type of the function that resizes memory
+
+
+////////////////////////////////////////////////////////////
+/// \brief Change the functions that CSFML uses to allocate memory
+///
+/// The following allocations go through these functions:
+/// \li the CSFML objects themselves (sfSprite, sfPacket, sfTexture, ...)
+/// \li the slots and sequence numbers of sfQueue
+/// \li the buffers returned by sfImage_saveToMemory
+/// \li the encoding buffers of the image codecs, and the copies
+///     of the pixels saved by sfImage_saveToFileAsync
+/// \li the values of sfShaderUniformBlock
+/// \li the templates, sources and variants of sfShaderLibrary
+/// \li the bookkeeping of sfRenderTexturePool
+/// \li the index and name table of sfSoundBank
+/// \li the tables and buffers of sfAudioAnalyzer and sfAudioConverter
+///
+/// Everything else still uses the global operator new: memory
+/// allocated by SFML (pixels of images, samples of sound
+/// buffers, ...), and the other containers held by CSFML
+/// objects (string of sfText, uniform handles of sfShader,
+/// queues of sfTaskPool, ...).
+///
+/// The functions must behave like malloc, free and realloc,
+/// and return memory suitably aligned for any type. They may
+/// be called from any thread.
+///
+/// This function must be called before any CSFML object is
+/// created, since objects must be released with the functions
+/// that allocated them. Passing NULL for any of the functions
+/// restores the default ones (malloc, free and realloc).
+///
+/// Destroyed objects of the most frequently created types
+/// (sfSprite, sfText, sfPacket, ...) are not released right
+/// away but kept by CSFML for reuse. These blocks still belong
+/// to the allocator that was installed when they were created,
+/// and are released with the functions installed at program
+/// exit, during the destruction of static variables: the
+/// functions passed here must therefore stay valid until the
+/// very end of the program, and must not be replaced once
+/// CSFML objects have been created, not even by the defaults.
+///
+/// \param allocate   Function that allocates memory
+/// \param deallocate Function that releases memory
+/// \param reallocate Function that resizes memory
+/// \param userData   Custom data passed to the functions
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfSetAllocator(sfAllocateFunction allocate, sfDeallocateFunction deallocate, sfReallocateFunction reallocate, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory with the CSFML allocator
+///
+/// \param size Number of bytes to allocate
+///
+/// \return Pointer to the allocated memory (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfMalloc(size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Release memory allocated with the CSFML allocator
+///
+/// \param pointer Pointer to the memory to release (can be NULL)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFree(void* pointer);
+
+////////////////////////////////////////////////////////////
+/// \brief Resize memory allocated with the CSFML allocator
+///
+/// \param pointer Pointer to the memory to resize (NULL to allocate)
+/// \param size    New size, in bytes
+///
+/// \return Pointer to the resized memory (NULL if failed, in which case \a pointer is left untouched)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfRealloc(void* pointer, size_t size);
+
+
+#endif // SFML_ALLOCATOR_H
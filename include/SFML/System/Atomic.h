@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_ATOMIC_H
+#define SFML_ATOMIC_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically read a 32-bit integer
+///
+/// All the sfAtomic functions are sequentially consistent, and
+/// can be mixed freely on the same variable. The variable must
+/// be naturally aligned (which is the case by default), and
+/// must only be accessed through these functions while other
+/// threads may access it.
+///
+/// \param value Pointer to the variable
+///
+/// \return Current value of the variable
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt32 sfAtomic_loadInt32(const volatile sfInt32* value);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically write a 32-bit integer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfAtomic_storeInt32(volatile sfInt32* value, sfInt32 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically add to a 32-bit integer
+///
+/// \param value  Pointer to the variable
+/// \param amount Value to add (can be negative)
+///
+/// \return Value of the variable before the addition
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt32 sfAtomic_fetchAddInt32(volatile sfInt32* value, sfInt32 amount);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a 32-bit integer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+/// \return Value of the variable before the exchange
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt32 sfAtomic_exchangeInt32(volatile sfInt32* value, sfInt32 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a 32-bit integer if it has an expected value
+///
+/// If the variable is equal to \a *expected, it is set to
+/// \a newValue. Otherwise, its current value is written to
+/// \a *expected.
+///
+/// \param value    Pointer to the variable
+/// \param expected Pointer to the expected value
+/// \param newValue Value to write
+///
+/// \return sfTrue if the variable was replaced, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfAtomic_compareExchangeInt32(volatile sfInt32* value, sfInt32* expected, sfInt32 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically read a 64-bit integer
+///
+/// \param value Pointer to the variable
+///
+/// \return Current value of the variable
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt64 sfAtomic_loadInt64(const volatile sfInt64* value);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically write a 64-bit integer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfAtomic_storeInt64(volatile sfInt64* value, sfInt64 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically add to a 64-bit integer
+///
+/// \param value  Pointer to the variable
+/// \param amount Value to add (can be negative)
+///
+/// \return Value of the variable before the addition
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt64 sfAtomic_fetchAddInt64(volatile sfInt64* value, sfInt64 amount);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a 64-bit integer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+/// \return Value of the variable before the exchange
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInt64 sfAtomic_exchangeInt64(volatile sfInt64* value, sfInt64 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a 64-bit integer if it has an expected value
+///
+/// \param value    Pointer to the variable
+/// \param expected Pointer to the expected value, receives the current value on failure
+/// \param newValue Value to write
+///
+/// \return sfTrue if the variable was replaced, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfAtomic_compareExchangeInt64(volatile sfInt64* value, sfInt64* expected, sfInt64 newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically read a pointer
+///
+/// \param value Pointer to the variable
+///
+/// \return Current value of the variable
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfAtomic_loadPointer(void* const volatile* value);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically write a pointer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfAtomic_storePointer(void* volatile* value, void* newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a pointer
+///
+/// \param value    Pointer to the variable
+/// \param newValue Value to write
+///
+/// \return Value of the variable before the exchange
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void* sfAtomic_exchangePointer(void* volatile* value, void* newValue);
+
+////////////////////////////////////////////////////////////
+/// \brief Atomically replace a pointer if it has an expected value
+///
+/// \param value    Pointer to the variable
+/// \param expected Pointer to the expected value, receives the current value on failure
+/// \param newValue Value to write
+///
+/// \return sfTrue if the variable was replaced, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfAtomic_compareExchangePointer(void* volatile* value, void** expected, void* newValue);
+
+
+#endif // SFML_ATOMIC_H
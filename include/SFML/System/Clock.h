@@ -86,5 +86,18 @@ CSFML_SYSTEM_API sfTime sfClock_getElapsedTime(const sfClock* clock);
 ////////////////////////////////////////////////////////////
 CSFML_SYSTEM_API sfTime sfClock_restart(sfClock* clock);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the current time of the monotonic clock
+///
+/// This is the clock that sfClock measures time with. Its
+/// origin is unspecified, so the returned value is only
+/// meaningful compared to other values of this clock, like
+/// the timestamps of sfTimedEvent.
+///
+/// \return Current time of the monotonic clock
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfTime sfClock_getCurrentTime(void);
+
 
 #endif // SFML_CLOCK_H
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_CONDITION_H
+#define SFML_CONDITION_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Time.h>
+#include <SFML/System/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new condition variable
+///
+/// A condition variable lets threads sleep until another
+/// thread notifies them that some shared state has changed.
+/// The shared state must be protected by a sfFastMutex,
+/// which is passed to the wait functions.
+///
+/// \return A new sfCondition object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfCondition* sfCondition_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a condition variable
+///
+/// No thread must be waiting on the condition variable.
+///
+/// \param condition Condition variable to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfCondition_destroy(sfCondition* condition);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until a condition variable is notified
+///
+/// \a mutex must be locked by the calling thread. It is
+/// unlocked while waiting, and locked again before this
+/// function returns. The function may return without being
+/// notified (spurious wakeup), so the shared state must be
+/// checked again in a loop.
+///
+/// \param condition Condition variable object
+/// \param mutex     Locked mutex that protects the shared state
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfCondition_wait(sfCondition* condition, sfFastMutex* mutex);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until a condition variable is notified, or a timeout expires
+///
+/// This function behaves like sfCondition_wait, but returns
+/// after at most \a timeout.
+///
+/// \param condition Condition variable object
+/// \param mutex     Locked mutex that protects the shared state
+/// \param timeout   Maximum time to wait
+///
+/// \return sfFalse if the timeout expired, sfTrue otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfCondition_waitFor(sfCondition* condition, sfFastMutex* mutex, sfTime timeout);
+
+////////////////////////////////////////////////////////////
+/// \brief Wake up one of the threads waiting on a condition variable
+///
+/// \param condition Condition variable object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfCondition_notifyOne(sfCondition* condition);
+
+////////////////////////////////////////////////////////////
+/// \brief Wake up all the threads waiting on a condition variable
+///
+/// \param condition Condition variable object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfCondition_notifyAll(sfCondition* condition);
+
+
+#endif // SFML_CONDITION_H
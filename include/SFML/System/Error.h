@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_ERROR_H
+#define SFML_ERROR_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Errors detected by the CSFML functions
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfErrorNone,           ///< No error
+    sfErrorNullObject,     ///< A NULL pointer was passed instead of an object
+    sfErrorInvalidArgument ///< An argument is outside of the accepted values
+} sfErrorCode;
+
+typedef void (*sfErrorCallback)(sfErrorCode code, const char* message, void* userData); ///< Type of the function called when an error is detected
+
+
+////////////////////////////////////////////////////////////
+/// \brief Change the function called when CSFML detects an error
+///
+/// By default, errors are printed to the standard error
+/// output. The callback is called on the thread where the
+/// error happened, possibly from several threads at once.
+///
+/// Whether NULL objects are detected is chosen when CSFML is
+/// compiled, with the CSFML_CHECKS CMake option: by default,
+/// only debug builds check them.
+///
+/// \param callback Function to call, or NULL to restore the default one
+/// \param userData Custom data passed to the callback
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfSetErrorCallback(sfErrorCallback callback, void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the last error detected on the calling thread
+///
+/// Successful calls don't reset the error: use
+/// sfClearLastError before the calls to check.
+///
+/// \return Code of the last error, or sfErrorNone
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfErrorCode sfGetLastError(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the last error of the calling thread to sfErrorNone
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfClearLastError(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Report an error through the error callback
+///
+/// This is the function CSFML uses to report its errors; it
+/// sets the last error of the calling thread, then calls the
+/// error callback. Libraries built on top of CSFML can use it
+/// to report their own errors the same way.
+///
+/// \param code    Code of the error
+/// \param message Description of the error
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRaiseError(sfErrorCode code, const char* message);
+
+
+#endif // SFML_ERROR_H
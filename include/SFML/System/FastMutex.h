@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_FASTMUTEX_H
+#define SFML_FASTMUTEX_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new fast mutex
+///
+/// Unlike sfMutex, a fast mutex is not recursive: locking it
+/// twice from the same thread is a deadlock. When it's already
+/// locked, sfFastMutex_lock spins for a short time before
+/// blocking; the spin duration adapts to how long the mutex is
+/// usually held. A fast mutex can be used with sfCondition.
+///
+/// \return A new sfFastMutex object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfFastMutex* sfFastMutex_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a fast mutex
+///
+/// \param mutex Fast mutex to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFastMutex_destroy(sfFastMutex* mutex);
+
+////////////////////////////////////////////////////////////
+/// \brief Lock a fast mutex
+///
+/// \param mutex Fast mutex object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFastMutex_lock(sfFastMutex* mutex);
+
+////////////////////////////////////////////////////////////
+/// \brief Try to lock a fast mutex without waiting
+///
+/// \param mutex Fast mutex object
+///
+/// \return sfTrue if the mutex was locked, sfFalse if it is already locked
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfFastMutex_tryLock(sfFastMutex* mutex);
+
+////////////////////////////////////////////////////////////
+/// \brief Unlock a fast mutex
+///
+/// \param mutex Fast mutex object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFastMutex_unlock(sfFastMutex* mutex);
+
+
+#endif // SFML_FASTMUTEX_H
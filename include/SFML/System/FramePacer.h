@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMEPACER_H
+#define SFML_FRAMEPACER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Time.h>
+#include <SFML/System/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Timings of a frame measured by a frame pacer
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTime cpuTime;     ///< Time between the start of the frame and the start of its presentation
+    sfTime waitTime;    ///< Time spent by sfFramePacer_beginFrame waiting for the frame to start
+    sfTime presentTime; ///< Time spent presenting the frame (usually the display function of the window)
+    sfTime frameTime;   ///< Time between the start of the previous frame and the start of this one
+} sfFrameStats;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new frame pacer
+///
+/// A frame pacer limits the framerate more accurately than
+/// sfWindow_setFramerateLimit: it sleeps until shortly before
+/// the start of the next frame, then spins on the clock for
+/// the remaining time. The sleep margin is adjusted to the
+/// measured precision of the system's sleep.
+///
+/// It is used by bracketing the frames of the application:
+/// \code
+/// while (running)
+/// {
+///     sfFramePacer_beginFrame(pacer);
+///     // handle events, update and draw...
+///     sfFramePacer_beginPresent(pacer);
+///     sfRenderWindow_display(window);
+///     sfFramePacer_endFrame(pacer);
+/// }
+/// \endcode
+///
+/// The pacer doesn't depend on a window, so it also works
+/// without a display. A frame time of zero disables the limit,
+/// but frames are still measured.
+///
+/// \param frameTime Minimum time between the start of two frames (sfTime_Zero for no limit)
+///
+/// \return A new sfFramePacer object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfFramePacer* sfFramePacer_create(sfTime frameTime);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a frame pacer
+///
+/// \param pacer Frame pacer to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFramePacer_destroy(sfFramePacer* pacer);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the target frame time of a frame pacer
+///
+/// \param pacer     Frame pacer object
+/// \param frameTime Minimum time between the start of two frames (sfTime_Zero for no limit)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFramePacer_setFrameTime(sfFramePacer* pacer, sfTime frameTime);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the target frame time of a frame pacer
+///
+/// \param pacer Frame pacer object
+///
+/// \return Minimum time between the start of two frames
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfTime sfFramePacer_getFrameTime(const sfFramePacer* pacer);
+
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable the predictive start of frames
+///
+/// Without prediction, frames start as soon as the frame time
+/// has elapsed since the previous one, and whatever time is
+/// left at the end is spent waiting before the next frame:
+/// input is sampled up to a frame before it is displayed.
+///
+/// With prediction, the pacer estimates how long the frames
+/// take (CPU and presentation time) from the previous ones,
+/// and delays the start of each frame so that it ends just
+/// in time. Input is then sampled as late as possible, which
+/// reduces latency. The start is brought forward again as
+/// soon as frames become longer.
+///
+/// Prediction is disabled by default.
+///
+/// \param pacer   Frame pacer object
+/// \param enabled sfTrue to enable, sfFalse to disable
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFramePacer_setPredictive(sfFramePacer* pacer, sfBool enabled);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait for the start of the next frame
+///
+/// \param pacer Frame pacer object
+///
+/// \return Time spent waiting
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfTime sfFramePacer_beginFrame(sfFramePacer* pacer);
+
+////////////////////////////////////////////////////////////
+/// \brief Notify a frame pacer that the frame is about to be presented
+///
+/// This separates the CPU time of the frame from its
+/// presentation time; if it's not called, the presentation
+/// time is counted in the CPU time.
+///
+/// \param pacer Frame pacer object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFramePacer_beginPresent(sfFramePacer* pacer);
+
+////////////////////////////////////////////////////////////
+/// \brief Notify a frame pacer that the frame has been presented
+///
+/// \param pacer Frame pacer object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfFramePacer_endFrame(sfFramePacer* pacer);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the timings of the last complete frame
+///
+/// \param pacer Frame pacer object
+///
+/// \return Timings of the last frame ended with sfFramePacer_endFrame
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfFrameStats sfFramePacer_getFrameStats(const sfFramePacer* pacer);
+
+
+#endif // SFML_FRAMEPACER_H
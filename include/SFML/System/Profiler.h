@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_PROFILER_H
+#define SFML_PROFILER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable the profiler
+///
+/// The profiler records the beginning and end of named zones
+/// on every thread, with a nanosecond timestamp. It is disabled
+/// by default; while disabled, zones cost a single test.
+///
+/// Besides the zones of the application, CSFML records its own
+/// zones around drawing, display, event polling, texture
+/// uploads, socket transfers and audio decoding.
+///
+/// \param enabled sfTrue to start recording, sfFalse to stop
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfProfiler_setEnabled(sfBool enabled);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the profiler is enabled
+///
+/// \return sfTrue if zones are recorded, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfProfiler_isEnabled(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Begin a profiling zone on the calling thread
+///
+/// Zones can be nested, and each one must be ended on the
+/// same thread with sfProfiler_endZone. Only the pointer to
+/// the name is recorded: the string must remain valid and
+/// unchanged until the profile is saved or cleared, which is
+/// the case of string literals.
+///
+/// \param name Name of the zone
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfProfiler_beginZone(const char* name);
+
+////////////////////////////////////////////////////////////
+/// \brief End the last profiling zone begun on the calling thread
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfProfiler_endZone(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the name of the calling thread in the profile
+///
+/// Threads are numbered in the order they record their first
+/// zone if they are not named. The name is copied.
+///
+/// \param name Name of the thread
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfProfiler_setThreadName(const char* name);
+
+////////////////////////////////////////////////////////////
+/// \brief Discard all the zones recorded so far
+///
+/// Zones that are open on other threads are discarded too,
+/// and their end is ignored.
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfProfiler_clear(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Save the recorded zones to a trace file
+///
+/// The file uses the Chrome trace event format (JSON), which
+/// can be opened in chrome://tracing, Perfetto or Speedscope.
+/// Recording can continue while the profile is saved; zones
+/// that are still open are written without an end.
+///
+/// \param filename Path of the file to write
+///
+/// \return sfTrue if saving succeeded, sfFalse if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfProfiler_saveToFile(const char* filename);
+
+
+#endif // SFML_PROFILER_H
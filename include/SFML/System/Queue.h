@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_QUEUE_H
+#define SFML_QUEUE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Concurrency guarantees of a queue
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfQueueSingleProducerSingleConsumer, ///< Exactly one thread pushes and one thread pops; fastest
+    sfQueueMultiProducerMultiConsumer    ///< Any number of threads may push and pop concurrently
+} sfQueueMode;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new queue
+///
+/// A queue is a bounded ring buffer that transfers fixed-size
+/// elements between threads without locks. Elements are
+/// copied in and out of the queue byte by byte, so they must
+/// not need any construction or destruction.
+///
+/// \param mode        Concurrency guarantees of the queue
+/// \param elementSize Size of an element, in bytes
+/// \param capacity    Maximum number of elements in the queue, rounded up to a power of two
+///
+/// \return A new sfQueue object (NULL if failed or if the buffers would be too large)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfQueue* sfQueue_create(sfQueueMode mode, size_t elementSize, size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a queue
+///
+/// No thread must be using the queue anymore.
+///
+/// \param queue Queue to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfQueue_destroy(sfQueue* queue);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the maximum number of elements of a queue
+///
+/// \param queue Queue object
+///
+/// \return Capacity of the queue
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API size_t sfQueue_getCapacity(const sfQueue* queue);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of elements in a queue
+///
+/// Since other threads may push or pop at the same time,
+/// the result is only an estimate.
+///
+/// \param queue Queue object
+///
+/// \return Approximate number of elements in the queue
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API size_t sfQueue_getSize(const sfQueue* queue);
+
+////////////////////////////////////////////////////////////
+/// \brief Push an element to a queue if it is not full
+///
+/// \param queue   Queue object
+/// \param element Pointer to the element to copy into the queue
+///
+/// \return sfTrue if the element was pushed, sfFalse if the queue is full
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfQueue_tryPush(sfQueue* queue, const void* element);
+
+////////////////////////////////////////////////////////////
+/// \brief Pop an element from a queue if it is not empty
+///
+/// \param queue   Queue object
+/// \param element Pointer to the memory that receives the element
+///
+/// \return sfTrue if an element was popped, sfFalse if the queue is empty
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfQueue_tryPop(sfQueue* queue, void* element);
+
+////////////////////////////////////////////////////////////
+/// \brief Push an element to a queue, waiting while it is full
+///
+/// \param queue   Queue object
+/// \param element Pointer to the element to copy into the queue
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfQueue_push(sfQueue* queue, const void* element);
+
+////////////////////////////////////////////////////////////
+/// \brief Pop an element from a queue, waiting while it is empty
+///
+/// \param queue   Queue object
+/// \param element Pointer to the memory that receives the element
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfQueue_pop(sfQueue* queue, void* element);
+
+////////////////////////////////////////////////////////////
+/// \brief Push several elements to a queue, as many as fit
+///
+/// With a single producer and a single consumer, the elements
+/// are published all at once, which is much cheaper than
+/// pushing them one by one.
+///
+/// \param queue    Queue object
+/// \param elements Pointer to the array of elements to copy into the queue
+/// \param count    Number of elements in \a elements
+///
+/// \return Number of elements pushed (the first ones of \a elements)
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API size_t sfQueue_pushBatch(sfQueue* queue, const void* elements, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Pop several elements from a queue, as many as available
+///
+/// \param queue    Queue object
+/// \param elements Pointer to the array that receives the elements
+/// \param maxCount Maximum number of elements to pop
+///
+/// \return Number of elements popped
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API size_t sfQueue_popBatch(sfQueue* queue, void* elements, size_t maxCount);
+
+
+#endif // SFML_QUEUE_H
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_RWLOCK_H
+#define SFML_RWLOCK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new reader-writer lock
+///
+/// A reader-writer lock can be held by many readers at the
+/// same time, or by a single writer. It is not recursive:
+/// a thread must not lock it again, for reading or writing,
+/// while it already holds it.
+///
+/// \return A new sfRwLock object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfRwLock* sfRwLock_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a reader-writer lock
+///
+/// \param lock Reader-writer lock to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRwLock_destroy(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Lock a reader-writer lock for reading
+///
+/// This function waits while a writer holds the lock.
+///
+/// \param lock Reader-writer lock object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRwLock_lockRead(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Try to lock a reader-writer lock for reading without waiting
+///
+/// \param lock Reader-writer lock object
+///
+/// \return sfTrue if the lock was acquired, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfRwLock_tryLockRead(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Unlock a reader-writer lock locked for reading
+///
+/// \param lock Reader-writer lock object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRwLock_unlockRead(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Lock a reader-writer lock for writing
+///
+/// This function waits until no other thread holds the lock.
+///
+/// \param lock Reader-writer lock object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRwLock_lockWrite(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Try to lock a reader-writer lock for writing without waiting
+///
+/// \param lock Reader-writer lock object
+///
+/// \return sfTrue if the lock was acquired, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfRwLock_tryLockWrite(sfRwLock* lock);
+
+////////////////////////////////////////////////////////////
+/// \brief Unlock a reader-writer lock locked for writing
+///
+/// \param lock Reader-writer lock object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfRwLock_unlockWrite(sfRwLock* lock);
+
+
+#endif // SFML_RWLOCK_H
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TASKPOOL_H
+#define SFML_TASKPOOL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.h>
+#include <SFML/System/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new task pool
+///
+/// A task pool runs small functions (tasks) on a fixed set of
+/// worker threads. Each worker has its own queue of tasks, and
+/// idle workers steal tasks from the others, so that the load
+/// is balanced without a central bottleneck. Tasks submitted
+/// by a task go to the queue of its worker.
+///
+/// \param threadCount Number of worker threads (0 to use one per CPU core)
+///
+/// \return A new sfTaskPool object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfTaskPool* sfTaskPool_create(unsigned int threadCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a task pool
+///
+/// This function waits until all the submitted tasks are
+/// finished. Handles that were not released yet remain
+/// valid, and must still be released with sfTask_release.
+///
+/// \param pool Task pool to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfTaskPool_destroy(sfTaskPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of worker threads of a task pool
+///
+/// \param pool Task pool object
+///
+/// \return Number of worker threads
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API unsigned int sfTaskPool_getThreadCount(const sfTaskPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Submit a task to a task pool
+///
+/// The task runs once all its dependencies are finished; with
+/// no dependency, it may start before this function returns.
+/// The returned handle must be released with sfTask_release
+/// when it's no longer needed (this doesn't cancel the task).
+///
+/// \param pool            Task pool object
+/// \param function        Function to run
+/// \param userData        Custom data to pass to the function
+/// \param dependencies    Tasks that must finish before this one starts (can be NULL if \a dependencyCount is 0)
+/// \param dependencyCount Number of elements in \a dependencies
+///
+/// \return Handle to the task
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfTask* sfTaskPool_submit(sfTaskPool* pool, void (*function)(void*), void* userData, sfTask* const* dependencies, size_t dependencyCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Run a function over a range of indices in parallel
+///
+/// The range [begin, end) is split in chunks of \a grainSize
+/// indices, which are handed out to the workers and to the
+/// calling thread as they become free. \a function is called
+/// once per chunk, with the bounds of the chunk. This function
+/// returns when the whole range has been processed.
+///
+/// \param pool      Task pool object
+/// \param begin     First index of the range
+/// \param end       Index past the last one of the range
+/// \param grainSize Number of indices per chunk (0 to choose automatically)
+/// \param function  Function to call on each chunk
+/// \param userData  Custom data to pass to the function
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfTaskPool_parallelFor(sfTaskPool* pool, size_t begin, size_t end, size_t grainSize, void (*function)(size_t, size_t, void*), void* userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until all the tasks submitted to a task pool are finished
+///
+/// \param pool Task pool object
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfTaskPool_waitAll(sfTaskPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until a task is finished
+///
+/// While waiting, the calling thread runs other tasks of the
+/// pool, so that tasks can wait for other tasks without
+/// blocking a worker.
+///
+/// \param task Task to wait for
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfTask_wait(sfTask* task);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether a task is finished
+///
+/// \param task Task object
+///
+/// \return sfTrue if the task has run, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfBool sfTask_isFinished(const sfTask* task);
+
+////////////////////////////////////////////////////////////
+/// \brief Release the handle to a task
+///
+/// \param task Task to release
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfTask_release(sfTask* task);
+
+
+#endif // SFML_TASKPOOL_H
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TIMEINLINE_H
+#define SFML_TIMEINLINE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Time.h>
+
+
+////////////////////////////////////////////////////////////
+/// \file
+///
+/// Header-only versions of the sfTime functions. They return
+/// exactly the same results as the exported functions, but
+/// the compiler can inline them instead of calling into the
+/// shared library, which matters in tight loops.
+///
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfTime_asSeconds
+///
+/// \param time Time value
+///
+/// \return Time in seconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE float sfTime_asSecondsInline(sfTime time)
+{
+    return (float)time.microseconds / 1000000.f;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfTime_asMilliseconds
+///
+/// \param time Time value
+///
+/// \return Time in milliseconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfInt32 sfTime_asMillisecondsInline(sfTime time)
+{
+    return (sfInt32)(sfUint32)(time.microseconds / 1000);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfTime_asMicroseconds
+///
+/// \param time Time value
+///
+/// \return Time in microseconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfInt64 sfTime_asMicrosecondsInline(sfTime time)
+{
+    return time.microseconds;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfSeconds
+///
+/// \param amount Number of seconds
+///
+/// \return Time value constructed from the amount of seconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfTime sfSecondsInline(float amount)
+{
+    sfTime time;
+    time.microseconds = (sfInt64)(amount * 1000000);
+    return time;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfMilliseconds
+///
+/// \param amount Number of milliseconds
+///
+/// \return Time value constructed from the amount of milliseconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfTime sfMillisecondsInline(sfInt32 amount)
+{
+    sfTime time;
+    time.microseconds = (sfInt64)((sfUint64)amount * 1000);
+    return time;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Inline version of sfMicroseconds
+///
+/// \param amount Number of microseconds
+///
+/// \return Time value constructed from the amount of microseconds
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfTime sfMicrosecondsInline(sfInt64 amount)
+{
+    sfTime time;
+    time.microseconds = amount;
+    return time;
+}
+
+
+#endif // SFML_TIMEINLINE_H
@@ -27,7 +27,14 @@
 
 
 typedef struct sfClock sfClock;
+typedef struct sfCondition sfCondition;
+typedef struct sfFastMutex sfFastMutex;
+typedef struct sfFramePacer sfFramePacer;
 typedef struct sfMutex sfMutex;
+typedef struct sfQueue sfQueue;
+typedef struct sfRwLock sfRwLock;
+typedef struct sfTask sfTask;
+typedef struct sfTaskPool sfTaskPool;
 typedef struct sfThread sfThread;
 
 
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_VECTORINLINE_H
+#define SFML_VECTORINLINE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.h>
+#include <SFML/System/Vector3.h>
+
+
+////////////////////////////////////////////////////////////
+/// \file
+///
+/// Header-only arithmetic on the vector types. The vector
+/// types are plain structures, so these functions have no
+/// exported counterpart and are always inlined.
+///
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \brief Add two 2D vectors
+///
+/// \param left  First vector
+/// \param right Second vector
+///
+/// \return Component-wise sum of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector2f sfVector2f_addInline(sfVector2f left, sfVector2f right)
+{
+    sfVector2f result;
+    result.x = left.x + right.x;
+    result.y = left.y + right.y;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Subtract two 2D vectors
+///
+/// \param left  First vector
+/// \param right Vector to subtract from \a left
+///
+/// \return Component-wise difference of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector2f sfVector2f_subtractInline(sfVector2f left, sfVector2f right)
+{
+    sfVector2f result;
+    result.x = left.x - right.x;
+    result.y = left.y - right.y;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Multiply a 2D vector by a scalar
+///
+/// \param vector Vector to scale
+/// \param factor Scale factor
+///
+/// \return Scaled vector
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector2f sfVector2f_multiplyInline(sfVector2f vector, float factor)
+{
+    sfVector2f result;
+    result.x = vector.x * factor;
+    result.y = vector.y * factor;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Add two 2D integer vectors
+///
+/// \param left  First vector
+/// \param right Second vector
+///
+/// \return Component-wise sum of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector2i sfVector2i_addInline(sfVector2i left, sfVector2i right)
+{
+    sfVector2i result;
+    result.x = left.x + right.x;
+    result.y = left.y + right.y;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Subtract two 2D integer vectors
+///
+/// \param left  First vector
+/// \param right Vector to subtract from \a left
+///
+/// \return Component-wise difference of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector2i sfVector2i_subtractInline(sfVector2i left, sfVector2i right)
+{
+    sfVector2i result;
+    result.x = left.x - right.x;
+    result.y = left.y - right.y;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Add two 3D vectors
+///
+/// \param left  First vector
+/// \param right Second vector
+///
+/// \return Component-wise sum of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector3f sfVector3f_addInline(sfVector3f left, sfVector3f right)
+{
+    sfVector3f result;
+    result.x = left.x + right.x;
+    result.y = left.y + right.y;
+    result.z = left.z + right.z;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Subtract two 3D vectors
+///
+/// \param left  First vector
+/// \param right Vector to subtract from \a left
+///
+/// \return Component-wise difference of the two vectors
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector3f sfVector3f_subtractInline(sfVector3f left, sfVector3f right)
+{
+    sfVector3f result;
+    result.x = left.x - right.x;
+    result.y = left.y - right.y;
+    result.z = left.z - right.z;
+    return result;
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Multiply a 3D vector by a scalar
+///
+/// \param vector Vector to scale
+/// \param factor Scale factor
+///
+/// \return Scaled vector
+///
+////////////////////////////////////////////////////////////
+static CSFML_INLINE sfVector3f sfVector3f_multiplyInline(sfVector3f vector, float factor)
+{
+    sfVector3f result;
+    result.x = vector.x * factor;
+    result.y = vector.y * factor;
+    result.z = vector.z * factor;
+    return result;
+}
+
+
+#endif // SFML_VECTORINLINE_H
@@ -34,6 +34,7 @@
 #include <SFML/Window/Context.h>
 #include <SFML/Window/Cursor.h>
 #include <SFML/Window/Event.h>
+#include <SFML/Window/InputSnapshot.h>
 #include <SFML/Window/Joystick.h>
 #include <SFML/Window/JoystickIdentification.h>
 #include <SFML/Window/Keyboard.h>
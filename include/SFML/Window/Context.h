@@ -42,6 +42,26 @@
 ////////////////////////////////////////////////////////////
 CSFML_WINDOW_API sfContext* sfContext_create(void);
 
+////////////////////////////////////////////////////////////
+/// \brief Create a new offscreen context with custom settings
+///
+/// The context renders to an internal surface of the given
+/// size rather than to a window, so it is suited to batch
+/// rendering (in sfRenderTexture objects for example). Several
+/// contexts can be created and used in parallel, each one
+/// being active in a different thread.
+///
+/// This function activates the new context.
+///
+/// \param settings Settings of the context (NULL for default settings)
+/// \param width    Width of the offscreen surface
+/// \param height   Height of the offscreen surface
+///
+/// \return New sfContext object
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API sfContext* sfContext_createOffscreen(const sfContextSettings* settings, unsigned int width, unsigned int height);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy a context
 ///
@@ -84,4 +104,24 @@ CSFML_WINDOW_API sfContextSettings sfContext_getSettings(const sfContext* contex
 ////////////////////////////////////////////////////////////
 CSFML_WINDOW_API sfUint64 sfContext_getActiveContextId();
 
+////////////////////////////////////////////////////////////
+/// \brief Tell whether OpenGL contexts can be created
+///
+/// On Linux and FreeBSD, SFML creates its contexts through
+/// the X server, even offscreen ones, and terminates the
+/// program if it can't connect to it. This function opens
+/// (and immediately closes) a connection to the X server
+/// named by the DISPLAY environment variable, so that servers
+/// and CI jobs can skip rendering (or report an error) instead.
+/// The result of the first call is cached.
+/// On machines without GPU, a virtual X server such as Xvfb
+/// with Mesa's software rasterizer (llvmpipe) is enough.
+///
+/// On other systems this function always returns sfTrue.
+///
+/// \return sfTrue if contexts can be created, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API sfBool sfContext_isAvailable(void);
+
 #endif // SFML_CONTEXT_H
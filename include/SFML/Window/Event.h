@@ -33,6 +33,7 @@
 #include <SFML/Window/Keyboard.h>
 #include <SFML/Window/Mouse.h>
 #include <SFML/Window/Sensor.h>
+#include <SFML/System/Time.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -234,5 +235,18 @@ typedef union
     sfSensorEvent           sensor;           ///< Sensor event parameters
 } sfEvent;
 
+////////////////////////////////////////////////////////////
+/// \brief Event with the time at which it was received
+///
+/// The timestamp is read from the monotonic clock used by
+/// sfClock; see sfClock_getCurrentTime.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfEvent event;     ///< The event
+    sfTime  timestamp; ///< Time at which the event was pulled from the system
+} sfTimedEvent;
+
 
 #endif // SFML_EVENT_H
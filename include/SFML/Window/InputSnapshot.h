@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_INPUTSNAPSHOT_H
+#define SFML_INPUTSNAPSHOT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Export.h>
+#include <SFML/Window/Event.h>
+#include <SFML/Window/Joystick.h>
+#include <SFML/Window/Keyboard.h>
+#include <SFML/Window/Mouse.h>
+#include <SFML/Window/Types.h>
+#include <SFML/System/Vector2.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Capacities of input snapshots
+///
+////////////////////////////////////////////////////////////
+enum
+{
+    sfInputSnapshotFingerCount = 10 ///< Number of touch fingers recorded in a snapshot
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Input devices that can be recorded in a snapshot
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfInputKeyboard = 1 << 0, ///< State of every keyboard key
+    sfInputMouse    = 1 << 1, ///< Mouse buttons and position
+    sfInputJoystick = 1 << 2, ///< Connection, buttons and axes of every joystick
+    sfInputTouch    = 1 << 3, ///< Touch fingers and their positions
+    sfInputAll      = sfInputKeyboard | sfInputMouse | sfInputJoystick | sfInputTouch ///< All the devices
+} sfInputDevice;
+
+////////////////////////////////////////////////////////////
+/// \brief State of all the input devices at a given time
+///
+/// Devices that were not requested when the snapshot was
+/// captured are filled with zeros (released, disconnected).
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBool     keys[sfKeyCount];                                        ///< Whether each key is pressed
+    sfBool     mouseButtons[sfMouseButtonCount];                        ///< Whether each mouse button is pressed
+    sfVector2i mousePosition;                                           ///< Position of the mouse
+    sfBool     joystickConnected[sfJoystickCount];                      ///< Whether each joystick is connected
+    sfBool     joystickButtons[sfJoystickCount][sfJoystickButtonCount]; ///< Whether each button of each joystick is pressed
+    float      joystickAxes[sfJoystickCount][sfJoystickAxisCount];      ///< Position of each axis of each joystick, in range [-100, 100] (0 if not supported)
+    sfBool     touchDown[sfInputSnapshotFingerCount];                   ///< Whether each finger is touching the screen
+    sfVector2i touchPositions[sfInputSnapshotFingerCount];              ///< Position of each finger (0, 0 if not down)
+} sfInputSnapshot;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Record the state of the input devices
+///
+/// This function fills \a snapshot in a single call. Only the
+/// devices in \a devices are recorded, so that applications
+/// don't pay for the ones they don't use. The cost depends on
+/// the device:
+/// \li Keyboard: if \a relativeTo is not NULL, the state of the
+///     keys is built from the sfEvtKeyPressed, sfEvtKeyReleased
+///     and sfEvtLostFocus events that the window returned so far,
+///     which costs nothing. Keys pressed while the window doesn't
+///     have the focus are not reported. For windows created with
+///     sfWindow_createWithEventQueue, call this function from the
+///     thread that consumes the events. Otherwise every key is
+///     queried like sfKeyboard_isKeyPressed, which is a round-trip
+///     to the X server per key on Linux: use
+///     sfInputSnapshot_captureKeys to query only the keys you need.
+/// \li Mouse: one query per button, plus one for the position.
+/// \li Joystick: cheap, states are cached by SFML and updated by
+///     the event loop of windows; if no window is open, call
+///     sfJoystick_update first.
+/// \li Touch: one query per finger.
+///
+/// \param snapshot   Snapshot to fill
+/// \param devices    Combination of sfInputDevice flags
+/// \param relativeTo Window whose events give the state of the keyboard, and to which mouse and touch positions are relative, or NULL
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API void sfInputSnapshot_capture(sfInputSnapshot* snapshot, sfUint32 devices, const sfWindow* relativeTo);
+
+////////////////////////////////////////////////////////////
+/// \brief Query the state of some keys and record it in a snapshot
+///
+/// Each key is queried like sfKeyboard_isKeyPressed (a round-trip
+/// to the X server on Linux), so pass only the keys that the
+/// application uses. The other keys of \a snapshot are left
+/// unchanged. If \a keys is NULL, the first \a keyCount key
+/// codes are queried.
+///
+/// \param snapshot Snapshot to update
+/// \param keys     Keys to query
+/// \param keyCount Number of keys in \a keys
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API void sfInputSnapshot_captureKeys(sfInputSnapshot* snapshot, const sfKeyCode* keys, size_t keyCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute what changed between two snapshots
+///
+/// Each change is written to \a changes as the event that
+/// reports it: sfEvtKeyPressed / sfEvtKeyReleased,
+/// sfEvtMouseButtonPressed / sfEvtMouseButtonReleased,
+/// sfEvtMouseMoved, sfEvtJoystickConnected / sfEvtJoystickDisconnected,
+/// sfEvtJoystickButtonPressed / sfEvtJoystickButtonReleased,
+/// sfEvtJoystickMoved and sfEvtTouchBegan / sfEvtTouchMoved /
+/// sfEvtTouchEnded. The modifier fields of key events are
+/// taken from \a current.
+///
+/// At most \a capacity changes are written, but the returned
+/// count includes all of them, so that a larger array can be
+/// allocated if it exceeds \a capacity. \a changes can be NULL
+/// if \a capacity is 0.
+///
+/// \param previous Older snapshot
+/// \param current  Newer snapshot
+/// \param changes  Array receiving the changes
+/// \param capacity Maximum number of changes to write to \a changes
+///
+/// \return Total number of changes between the snapshots
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API size_t sfInputSnapshot_diff(const sfInputSnapshot* previous, const sfInputSnapshot* current, sfEvent* changes, size_t capacity);
+
+
+#endif // SFML_INPUTSNAPSHOT_H
@@ -34,6 +34,7 @@
 #include <SFML/Window/WindowHandle.h>
 #include <SFML/Window/Types.h>
 #include <SFML/System/Vector2.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -143,6 +144,46 @@ CSFML_WINDOW_API sfWindow* sfWindow_createUnicode(sfVideoMode mode, const sfUint
 ////////////////////////////////////////////////////////////
 CSFML_WINDOW_API sfWindow* sfWindow_createFromHandle(sfWindowHandle handle, const sfContextSettings* settings);
 
+////////////////////////////////////////////////////////////
+/// \brief Construct a new window whose events are collected by an input thread
+///
+/// This function works like sfWindow_create, except that the
+/// window is created by a dedicated high priority thread, which
+/// then pulls its events from the system as they arrive (it
+/// checks for new ones every millisecond), stamps them with the
+/// time of sfClock_getCurrentTime and pushes them to a lock-free
+/// queue. The thread that renders to the window consumes them
+/// with sfWindow_pollEvent, sfWindow_pollEvents,
+/// sfWindow_waitEvent or sfWindow_pollTimedEvent (no other
+/// thread may call these functions for this window), and
+/// can compare the timestamps to the time a frame is displayed
+/// to measure input latency, or handle input in the middle of
+/// a frame.
+///
+/// The OpenGL context of the window is left inactive by the
+/// input thread, so that the rendering thread can activate it.
+/// sfWindow_close and sfWindow_destroy are forwarded
+/// to the input thread, which owns the window. The other
+/// functions that modify the window (size, position, title,
+/// cursor, ...) are not synchronized with the input thread.
+/// A thread blocked in sfWindow_waitEvent returns sfFalse
+/// when the window is closed or destroyed.
+///
+/// On Linux and FreeBSD, this function enables the thread
+/// support of Xlib: create the window before any other
+/// window or context. This mode is not available on macOS,
+/// where windows can only be created by the main thread.
+///
+/// \param mode     Video mode to use (defines the width, height and depth of the rendering area of the window)
+/// \param title    Title of the window
+/// \param style    Window style
+/// \param settings Additional settings for the underlying OpenGL context
+///
+/// \return A new sfWindow object (NULL if failed)
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API sfWindow* sfWindow_createWithEventQueue(sfVideoMode mode, const char* title, sfUint32 style, const sfContextSettings* settings);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy a window
 ///
@@ -211,6 +252,42 @@ CSFML_WINDOW_API sfContextSettings sfWindow_getSettings(const sfWindow* window);
 ////////////////////////////////////////////////////////////
 CSFML_WINDOW_API sfBool sfWindow_pollEvent(sfWindow* window, sfEvent* event);
 
+////////////////////////////////////////////////////////////
+/// \brief Pop many events from the event queue at once
+///
+/// This function works like sfWindow_pollEvent called in a loop,
+/// but converts up to \a capacity events in a single call. Events
+/// that don't fit in \a events are left in the queue, so that
+/// nothing is lost: call it again while it returns \a capacity.
+///
+/// \param window   Window object
+/// \param events   Array receiving the events
+/// \param capacity Maximum number of events to write to \a events
+///
+/// \return Number of events written to \a events (0 if the queue was empty)
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API size_t sfWindow_pollEvents(sfWindow* window, sfEvent* events, size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Pop many events from the event queue at once, merging consecutive moves
+///
+/// This function works like sfWindow_pollEvents, except that
+/// consecutive sfEvtMouseMoved events, consecutive sfEvtJoystickMoved
+/// events of the same joystick axis, and consecutive sfEvtTouchMoved
+/// events of the same finger are merged into the last one. This keeps
+/// high rate devices (such as 8 kHz mice) from flooding the buffer
+/// with intermediate positions.
+///
+/// \param window   Window object
+/// \param events   Array receiving the events
+/// \param capacity Maximum number of events to write to \a events
+///
+/// \return Number of events written to \a events (0 if the queue was empty)
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API size_t sfWindow_pollEventsCoalesced(sfWindow* window, sfEvent* events, size_t capacity);
+
 ////////////////////////////////////////////////////////////
 /// \brief Wait for an event and return it
 ///
@@ -230,6 +307,22 @@ CSFML_WINDOW_API sfBool sfWindow_pollEvent(sfWindow* window, sfEvent* event);
 ////////////////////////////////////////////////////////////
 CSFML_WINDOW_API sfBool sfWindow_waitEvent(sfWindow* window, sfEvent* event);
 
+////////////////////////////////////////////////////////////
+/// \brief Pop the event on top of event queue, if any, with its timestamp
+///
+/// This function works like sfWindow_pollEvent. For windows
+/// created with sfWindow_createWithEventQueue, the timestamp
+/// is the time at which the input thread received the event;
+/// otherwise it is the time of this call.
+///
+/// \param window Window object
+/// \param event  Event to be returned
+///
+/// \return sfTrue if an event was returned, or sfFalse if the event queue was empty
+///
+////////////////////////////////////////////////////////////
+CSFML_WINDOW_API sfBool sfWindow_pollTimedEvent(sfWindow* window, sfTimedEvent* event);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the position of a window
 ///
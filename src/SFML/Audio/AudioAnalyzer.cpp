@@ -0,0 +1,623 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioAnalyzer.h>
+#include <SFML/Audio/AudioAnalyzerStruct.h>
+#include <SFML/Audio/SoundBufferStruct.h>
+#include <SFML/System/Thread.hpp>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define CSFML_AUDIOANALYZER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define CSFML_AUDIOANALYZER_NEON
+#endif
+
+
+namespace
+{
+    const double pi = 3.14159265358979323846;
+
+
+    ////////////////////////////////////////////////////////////
+    bool isPowerOfTwo(unsigned int value)
+    {
+        return (value != 0) && ((value & (value - 1)) == 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setupSpectrum(sfAudioAnalyzer& analyzer, sfAudioWindow window)
+    {
+        unsigned int size = analyzer.FftSize;
+        unsigned int half = size / 2;
+
+        // Window
+        analyzer.Window.resize(size);
+        analyzer.WindowSum = 0.f;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            double phase = 2.0 * pi * i / size;
+            double value = 1.0;
+            switch (window)
+            {
+                case sfAudioWindowHann:     value = 0.5 - 0.5 * std::cos(phase); break;
+                case sfAudioWindowHamming:  value = 0.54 - 0.46 * std::cos(phase); break;
+                case sfAudioWindowBlackman: value = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase); break;
+                default:                    break;
+            }
+            analyzer.Window[i] = static_cast<float>(value);
+            analyzer.WindowSum += analyzer.Window[i];
+        }
+
+        // Bit-reversal permutation of the half-size complex FFT
+        unsigned int bits = 0;
+        while ((1u << bits) < half)
+            ++bits;
+        analyzer.BitReverse.resize(half);
+        for (unsigned int i = 0; i < half; ++i)
+        {
+            unsigned int reversed = 0;
+            for (unsigned int bit = 0; bit < bits; ++bit)
+                reversed |= ((i >> bit) & 1u) << (bits - 1 - bit);
+            analyzer.BitReverse[i] = reversed;
+        }
+
+        // Twiddle factors of the half-size complex FFT, stored stage by stage so
+        // that the butterflies read them contiguously: the stage merging blocks
+        // of 2 * n values uses the n factors that start at index n - 1
+        analyzer.TwiddleReal.resize(std::max(half, 2u) - 1);
+        analyzer.TwiddleImag.resize(std::max(half, 2u) - 1);
+        for (unsigned int n = 1; n < half; n *= 2)
+        {
+            for (unsigned int i = 0; i < n; ++i)
+            {
+                analyzer.TwiddleReal[n - 1 + i] = static_cast<float>(std::cos(pi * i / n));
+                analyzer.TwiddleImag[n - 1 + i] = static_cast<float>(-std::sin(pi * i / n));
+            }
+        }
+
+        // Twiddle factors recombining the complex FFT into the real one
+        analyzer.SplitReal.resize(half);
+        analyzer.SplitImag.resize(half);
+        for (unsigned int i = 0; i < half; ++i)
+        {
+            analyzer.SplitReal[i] = static_cast<float>(std::cos(2.0 * pi * i / size));
+            analyzer.SplitImag[i] = static_cast<float>(-std::sin(2.0 * pi * i / size));
+        }
+
+        analyzer.Real.resize(half);
+        analyzer.Imag.resize(half);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setupLoudness(sfAudioAnalyzer& analyzer)
+    {
+        // K-weighting filter of ITU-R BS.1770, computed for the actual sample rate
+        double rate = analyzer.SampleRate;
+
+        double k      = std::tan(pi * 1681.974450955533 / rate);
+        double q      = 0.7071752369554196;
+        double vh     = std::pow(10.0, 3.999843853973347 / 20.0);
+        double vb     = std::pow(vh, 0.4996667741545416);
+        double a0     = 1.0 + k / q + k * k;
+        analyzer.Shelf.b0 = (vh + vb * k / q + k * k) / a0;
+        analyzer.Shelf.b1 = 2.0 * (k * k - vh) / a0;
+        analyzer.Shelf.b2 = (vh - vb * k / q + k * k) / a0;
+        analyzer.Shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+        analyzer.Shelf.a2 = (1.0 - k / q + k * k) / a0;
+
+        k  = std::tan(pi * 38.13547087602444 / rate);
+        q  = 0.5003270373238773;
+        a0 = 1.0 + k / q + k * k;
+        analyzer.HighPass.b0 = 1.0;
+        analyzer.HighPass.b1 = -2.0;
+        analyzer.HighPass.b2 = 1.0;
+        analyzer.HighPass.a1 = 2.0 * (k * k - 1.0) / a0;
+        analyzer.HighPass.a2 = (1.0 - k / q + k * k) / a0;
+
+        // Surround channels are weighted up, LFE is ignored
+        analyzer.ChannelWeights.assign(analyzer.ChannelCount, 1.0);
+        if (analyzer.ChannelCount == 5)
+        {
+            analyzer.ChannelWeights[3] = 1.41;
+            analyzer.ChannelWeights[4] = 1.41;
+        }
+        else if (analyzer.ChannelCount == 6)
+        {
+            analyzer.ChannelWeights[3] = 0.0;
+            analyzer.ChannelWeights[4] = 1.41;
+            analyzer.ChannelWeights[5] = 1.41;
+        }
+
+        analyzer.FramesPerBlock = std::max(analyzer.SampleRate / 10, 1u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void resetMeters(sfAudioAnalyzer& analyzer)
+    {
+        analyzer.Peak         = 0;
+        analyzer.SumOfSquares = 0;
+        analyzer.SampleTotal  = 0;
+        analyzer.FilterState.assign(analyzer.ChannelCount * 4, 0.0);
+        analyzer.Blocks.clear();
+        analyzer.BlockEnergy  = 0.0;
+        analyzer.BlockFrames  = 0;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void measurePeakAndPower(sfAudioAnalyzer& analyzer, const sfInt16* samples, std::size_t count)
+    {
+        sfInt32     maximum = 0;
+        sfInt32     minimum = 0;
+        sfUint64    sum     = 0;
+        std::size_t i       = 0;
+
+    #ifdef CSFML_AUDIOANALYZER_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        __m128i vmax = zero;
+        __m128i vmin = zero;
+        __m128i vsum = zero;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+            vmax = _mm_max_epi16(vmax, values);
+            vmin = _mm_min_epi16(vmin, values);
+
+            // Each pair of squares fits in 32 unsigned bits, widen them before accumulating
+            __m128i squares = _mm_madd_epi16(values, values);
+            vsum = _mm_add_epi64(vsum, _mm_unpacklo_epi32(squares, zero));
+            vsum = _mm_add_epi64(vsum, _mm_unpackhi_epi32(squares, zero));
+        }
+
+        sfInt16  maxLanes[8];
+        sfInt16  minLanes[8];
+        sfUint64 sumLanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), vmax);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sumLanes), vsum);
+        for (int lane = 0; lane < 8; ++lane)
+        {
+            maximum = std::max<sfInt32>(maximum, maxLanes[lane]);
+            minimum = std::min<sfInt32>(minimum, minLanes[lane]);
+        }
+        sum = sumLanes[0] + sumLanes[1];
+    #endif
+
+        for (; i < count; ++i)
+        {
+            sfInt32 value = samples[i];
+            maximum = std::max(maximum, value);
+            minimum = std::min(minimum, value);
+            sum += static_cast<sfUint64>(value * value);
+        }
+
+        analyzer.Peak          = std::max(analyzer.Peak, std::max(maximum, -minimum));
+        analyzer.SumOfSquares += sum;
+        analyzer.SampleTotal  += count;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    double filter(const sfAudioBiquad& biquad, double* state, double input)
+    {
+        double output = biquad.b0 * input + state[0];
+        state[0] = biquad.b1 * input - biquad.a1 * output + state[1];
+        state[1] = biquad.b2 * input - biquad.a2 * output;
+        return output;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void measureLoudness(sfAudioAnalyzer& analyzer, const sfInt16* samples, std::size_t frameCount)
+    {
+        unsigned int channels = analyzer.ChannelCount;
+
+        for (std::size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const sfInt16* in = samples + frame * channels;
+            for (unsigned int channel = 0; channel < channels; ++channel)
+            {
+                double* state = &analyzer.FilterState[channel * 4];
+                double  value = filter(analyzer.Shelf, state, in[channel] / 32768.0);
+                value = filter(analyzer.HighPass, state + 2, value);
+                analyzer.BlockEnergy += analyzer.ChannelWeights[channel] * value * value;
+            }
+
+            if (++analyzer.BlockFrames == analyzer.FramesPerBlock)
+            {
+                analyzer.Blocks.push_back(analyzer.BlockEnergy / analyzer.FramesPerBlock);
+                analyzer.BlockEnergy = 0.0;
+                analyzer.BlockFrames = 0;
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    float toLoudness(double energy)
+    {
+        if (energy <= 0.0)
+            return -std::numeric_limits<float>::infinity();
+
+        return static_cast<float>(-0.691 + 10.0 * std::log10(energy));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    float integratedLoudness(const std::vector<double, priv::Allocator<double> >& blocks)
+    {
+        // Gating blocks are 400 ms long and overlap by 75%, i.e. 4 consecutive 100 ms blocks
+        if (blocks.size() < 4)
+            return -std::numeric_limits<float>::infinity();
+
+        std::vector<double> energies(blocks.size() - 3);
+        for (std::size_t i = 0; i < energies.size(); ++i)
+            energies[i] = (blocks[i] + blocks[i + 1] + blocks[i + 2] + blocks[i + 3]) / 4.0;
+
+        // Absolute gate at -70 LUFS
+        const double absoluteGate = std::pow(10.0, (-70.0 + 0.691) / 10.0);
+        double sum = 0.0;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < energies.size(); ++i)
+        {
+            if (energies[i] > absoluteGate)
+            {
+                sum += energies[i];
+                ++count;
+            }
+        }
+        if (count == 0)
+            return -std::numeric_limits<float>::infinity();
+
+        // Relative gate 10 LU below the absolute-gated loudness
+        const double relativeGate = std::max(absoluteGate, (sum / count) * std::pow(10.0, -1.0));
+        sum = 0.0;
+        count = 0;
+        for (std::size_t i = 0; i < energies.size(); ++i)
+        {
+            if (energies[i] > relativeGate)
+            {
+                sum += energies[i];
+                ++count;
+            }
+        }
+
+        return count > 0 ? toLoudness(sum / count) : -std::numeric_limits<float>::infinity();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void transform(sfAudioAnalyzer& analyzer)
+    {
+        // Iterative radix-2 decimation in time; the input is already in bit-reversed order
+        unsigned int count = analyzer.FftSize / 2;
+        float* re = &analyzer.Real[0];
+        float* im = &analyzer.Imag[0];
+
+        for (unsigned int half = 1; half < count; half *= 2)
+        {
+            const float* twiddleRe = &analyzer.TwiddleReal[half - 1];
+            const float* twiddleIm = &analyzer.TwiddleImag[half - 1];
+
+            for (unsigned int start = 0; start < count; start += 2 * half)
+            {
+                float* aRe = re + start;
+                float* aIm = im + start;
+                float* bRe = aRe + half;
+                float* bIm = aIm + half;
+                unsigned int k = 0;
+
+            #if defined(CSFML_AUDIOANALYZER_SSE2)
+
+                // Four butterflies at once, from the stage that merges blocks of 4 values
+                for (; k + 4 <= half; k += 4)
+                {
+                    __m128 wr = _mm_loadu_ps(twiddleRe + k);
+                    __m128 wi = _mm_loadu_ps(twiddleIm + k);
+                    __m128 br = _mm_loadu_ps(bRe + k);
+                    __m128 bi = _mm_loadu_ps(bIm + k);
+                    __m128 ar = _mm_loadu_ps(aRe + k);
+                    __m128 ai = _mm_loadu_ps(aIm + k);
+
+                    __m128 tr = _mm_sub_ps(_mm_mul_ps(wr, br), _mm_mul_ps(wi, bi));
+                    __m128 ti = _mm_add_ps(_mm_mul_ps(wr, bi), _mm_mul_ps(wi, br));
+                    _mm_storeu_ps(bRe + k, _mm_sub_ps(ar, tr));
+                    _mm_storeu_ps(bIm + k, _mm_sub_ps(ai, ti));
+                    _mm_storeu_ps(aRe + k, _mm_add_ps(ar, tr));
+                    _mm_storeu_ps(aIm + k, _mm_add_ps(ai, ti));
+                }
+
+            #elif defined(CSFML_AUDIOANALYZER_NEON)
+
+                for (; k + 4 <= half; k += 4)
+                {
+                    float32x4_t wr = vld1q_f32(twiddleRe + k);
+                    float32x4_t wi = vld1q_f32(twiddleIm + k);
+                    float32x4_t br = vld1q_f32(bRe + k);
+                    float32x4_t bi = vld1q_f32(bIm + k);
+                    float32x4_t ar = vld1q_f32(aRe + k);
+                    float32x4_t ai = vld1q_f32(aIm + k);
+
+                    float32x4_t tr = vmlsq_f32(vmulq_f32(wr, br), wi, bi);
+                    float32x4_t ti = vmlaq_f32(vmulq_f32(wr, bi), wi, br);
+                    vst1q_f32(bRe + k, vsubq_f32(ar, tr));
+                    vst1q_f32(bIm + k, vsubq_f32(ai, ti));
+                    vst1q_f32(aRe + k, vaddq_f32(ar, tr));
+                    vst1q_f32(aIm + k, vaddq_f32(ai, ti));
+                }
+
+            #endif
+
+                // First two stages, and the remaining butterflies without SIMD
+                for (; k < half; ++k)
+                {
+                    float tr = twiddleRe[k] * bRe[k] - twiddleIm[k] * bIm[k];
+                    float ti = twiddleRe[k] * bIm[k] + twiddleIm[k] * bRe[k];
+                    bRe[k] = aRe[k] - tr;
+                    bIm[k] = aIm[k] - ti;
+                    aRe[k] += tr;
+                    aIm[k] += ti;
+                }
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    struct BatchTask
+    {
+        const sfSoundBuffer* const* buffers;
+        sfAudioLevels*              levels;
+        std::size_t                 count;
+        std::size_t                 first;
+        std::size_t                 stride;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void analyzeBatch(BatchTask* task)
+    {
+        for (std::size_t i = task->first; i < task->count; i += task->stride)
+        {
+            sfAudioLevels levels = {0.f, 0.f, -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+
+            if (task->buffers[i])
+            {
+                const sf::SoundBuffer& buffer = task->buffers[i]->This;
+                sfAudioAnalyzer* analyzer = sfAudioAnalyzer_create(buffer.getChannelCount(), buffer.getSampleRate(), 0, sfAudioWindowRectangular);
+                if (analyzer)
+                {
+                    sfAudioAnalyzer_process(analyzer, buffer.getSamples(), static_cast<std::size_t>(buffer.getSampleCount()));
+                    levels = sfAudioAnalyzer_getLevels(analyzer);
+                    sfAudioAnalyzer_destroy(analyzer);
+                }
+            }
+
+            task->levels[i] = levels;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfAudioAnalyzer* sfAudioAnalyzer_create(unsigned int channelCount, unsigned int sampleRate, unsigned int fftSize, sfAudioWindow window)
+{
+    if ((channelCount == 0) || (sampleRate == 0))
+        return NULL;
+    if ((fftSize != 0) && (!isPowerOfTwo(fftSize) || (fftSize < 2)))
+        return NULL;
+
+    sfAudioAnalyzer* analyzer = new sfAudioAnalyzer;
+    analyzer->ChannelCount = channelCount;
+    analyzer->SampleRate   = sampleRate;
+    analyzer->FftSize      = fftSize;
+    analyzer->WindowSum    = 0.f;
+
+    if (fftSize > 0)
+        setupSpectrum(*analyzer, window);
+    setupLoudness(*analyzer);
+    resetMeters(*analyzer);
+
+    return analyzer;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioAnalyzer_destroy(sfAudioAnalyzer* analyzer)
+{
+    delete analyzer;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioAnalyzer_process(sfAudioAnalyzer* analyzer, const sfInt16* samples, size_t sampleCount)
+{
+    CSFML_CHECK(analyzer);
+
+    std::size_t frameCount = sampleCount / analyzer->ChannelCount;
+    if (!samples || (frameCount == 0))
+        return;
+
+    measurePeakAndPower(*analyzer, samples, frameCount * analyzer->ChannelCount);
+    measureLoudness(*analyzer, samples, frameCount);
+}
+
+
+////////////////////////////////////////////////////////////
+sfAudioLevels sfAudioAnalyzer_getLevels(const sfAudioAnalyzer* analyzer)
+{
+    sfAudioLevels levels = {0.f, 0.f, -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+    CSFML_CHECK_RETURN(analyzer, levels);
+
+    if (analyzer->SampleTotal > 0)
+    {
+        levels.peak = analyzer->Peak / 32768.f;
+        levels.rms  = static_cast<float>(std::sqrt(static_cast<double>(analyzer->SumOfSquares) / analyzer->SampleTotal) / 32768.0);
+    }
+
+    std::size_t blockCount = analyzer->Blocks.size();
+    if (blockCount >= 4)
+    {
+        const double* last = &analyzer->Blocks[blockCount - 4];
+        levels.momentaryLoudness = toLoudness((last[0] + last[1] + last[2] + last[3]) / 4.0);
+    }
+
+    levels.integratedLoudness = integratedLoudness(analyzer->Blocks);
+
+    return levels;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioAnalyzer_reset(sfAudioAnalyzer* analyzer)
+{
+    CSFML_CHECK(analyzer);
+
+    resetMeters(*analyzer);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAudioAnalyzer_computeSpectrum(sfAudioAnalyzer* analyzer, const sfInt16* samples, size_t sampleCount, float* magnitudes)
+{
+    CSFML_CHECK_RETURN(analyzer, sfFalse);
+    CSFML_CHECK_RETURN(magnitudes, sfFalse);
+
+    if (analyzer->FftSize == 0)
+        return sfFalse;
+
+    unsigned int channels   = analyzer->ChannelCount;
+    unsigned int half       = analyzer->FftSize / 2;
+    std::size_t  frameCount = samples ? std::min<std::size_t>(sampleCount / channels, analyzer->FftSize) : 0;
+    const float  average    = 1.f / channels;
+
+    // Pack the windowed mono signal as half as many complex values, in bit-reversed order
+    for (unsigned int i = 0; i < analyzer->FftSize; ++i)
+    {
+        float value = 0.f;
+        if (i < frameCount)
+        {
+            const sfInt16* frame = samples + i * channels;
+            for (unsigned int channel = 0; channel < channels; ++channel)
+                value += frame[channel];
+            value *= average * analyzer->Window[i];
+        }
+
+        unsigned int index = analyzer->BitReverse[i / 2];
+        if (i % 2 == 0)
+            analyzer->Real[index] = value;
+        else
+            analyzer->Imag[index] = value;
+    }
+
+    transform(*analyzer);
+
+    // Split the complex spectrum into the spectrum of the real signal
+    const float* re = &analyzer->Real[0];
+    const float* im = &analyzer->Imag[0];
+    const float  scale = 2.f / (analyzer->WindowSum * 32768.f);
+    for (unsigned int k = 0; k <= half; ++k)
+    {
+        unsigned int a = k % half;
+        unsigned int b = (half - k) % half;
+
+        float evenReal = 0.5f * (re[a] + re[b]);
+        float evenImag = 0.5f * (im[a] - im[b]);
+        float oddReal  = 0.5f * (im[a] + im[b]);
+        float oddImag  = -0.5f * (re[a] - re[b]);
+
+        float wr = (k < half) ? analyzer->SplitReal[k] : -1.f;
+        float wi = (k < half) ? analyzer->SplitImag[k] : 0.f;
+
+        float real = evenReal + wr * oddReal - wi * oddImag;
+        float imag = evenImag + wr * oddImag + wi * oddReal;
+
+        // DC and Nyquist bins have no mirrored half, don't double them
+        float binScale = ((k == 0) || (k == half)) ? scale * 0.5f : scale;
+        magnitudes[k] = std::sqrt(real * real + imag * imag) * binScale;
+    }
+
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfAudioAnalyzer_getFftSize(const sfAudioAnalyzer* analyzer)
+{
+    CSFML_CHECK_RETURN(analyzer, 0);
+
+    return analyzer->FftSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioAnalyzer_analyzeBuffers(const sfSoundBuffer* const* buffers, size_t count, sfAudioLevels* levels, unsigned int threadCount)
+{
+    CSFML_CHECK(buffers);
+    CSFML_CHECK(levels);
+
+    std::size_t workers = std::min<std::size_t>(std::max(threadCount, 1u), count);
+    if (workers <= 1)
+    {
+        BatchTask task = {buffers, levels, count, 0, 1};
+        analyzeBatch(&task);
+        return;
+    }
+
+    // Interleave the buffers between the threads, so that a bank sorted
+    // by size doesn't give all the long sounds to the same thread
+    std::vector<BatchTask>   tasks(workers);
+    std::vector<sf::Thread*> threads(workers, NULL);
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+        BatchTask task = {buffers, levels, count, i, workers};
+        tasks[i] = task;
+    }
+
+    for (std::size_t i = 1; i < workers; ++i)
+    {
+        threads[i] = new sf::Thread(&analyzeBatch, &tasks[i]);
+        threads[i]->launch();
+    }
+
+    analyzeBatch(&tasks[0]);
+
+    for (std::size_t i = 1; i < workers; ++i)
+    {
+        threads[i]->wait();
+        delete threads[i];
+    }
+}
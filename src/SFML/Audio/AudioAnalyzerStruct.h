@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_AUDIOANALYZERSTRUCT_H
+#define SFML_AUDIOANALYZERSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Coefficients and state of a biquad filter (transposed direct form II)
+////////////////////////////////////////////////////////////
+struct sfAudioBiquad
+{
+    double b0, b1, b2, a1, a2;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfAudioAnalyzer
+////////////////////////////////////////////////////////////
+struct sfAudioAnalyzer : public priv::Allocated
+{
+    unsigned int                                              ChannelCount;   ///< Number of interleaved channels
+    unsigned int                                              SampleRate;     ///< Sample rate of the analyzed samples
+
+    // Spectrum
+    unsigned int                                              FftSize;        ///< Number of real samples per FFT (0 if disabled)
+    std::vector<float, priv::Allocator<float> >               Window;         ///< Window coefficients, one per FFT sample
+    float                                                     WindowSum;      ///< Sum of the window coefficients, for normalization
+    std::vector<unsigned int, priv::Allocator<unsigned int> > BitReverse;     ///< Bit-reversal permutation of the half-size complex FFT
+    std::vector<float, priv::Allocator<float> >               TwiddleReal;    ///< Twiddle factors of the half-size complex FFT, stage by stage
+    std::vector<float, priv::Allocator<float> >               TwiddleImag;
+    std::vector<float, priv::Allocator<float> >               SplitReal;      ///< Twiddle factors used to split the complex FFT into a real one
+    std::vector<float, priv::Allocator<float> >               SplitImag;
+    std::vector<float, priv::Allocator<float> >               Real;           ///< Scratch buffers of the complex FFT
+    std::vector<float, priv::Allocator<float> >               Imag;
+
+    // Peak and RMS meters
+    sfInt32                                                   Peak;           ///< Highest absolute sample value
+    sfUint64                                                  SumOfSquares;   ///< Sum of the squared samples
+    sfUint64                                                  SampleTotal;    ///< Number of samples measured
+
+    // Loudness meter (ITU-R BS.1770)
+    sfAudioBiquad                                             Shelf;          ///< First stage of the K-weighting filter
+    sfAudioBiquad                                             HighPass;       ///< Second stage of the K-weighting filter
+    std::vector<double, priv::Allocator<double> >             FilterState;    ///< Four state values per channel
+    std::vector<double, priv::Allocator<double> >             ChannelWeights; ///< Weight of each channel in the loudness sum
+    std::vector<double, priv::Allocator<double> >             Blocks;         ///< Weighted energy of every complete 100 ms block
+    double                                                    BlockEnergy;    ///< Weighted energy of the current 100 ms block
+    unsigned int                                              BlockFrames;    ///< Number of frames in the current 100 ms block
+    unsigned int                                              FramesPerBlock; ///< Number of frames in a 100 ms block
+};
+
+
+#endif // SFML_AUDIOANALYZERSTRUCT_H
@@ -0,0 +1,452 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/AudioConverter.h>
+#include <SFML/Audio/AudioConverterStruct.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>
+    #define CSFML_AUDIOCONVERTER_SSE
+#endif
+
+
+namespace
+{
+    // Number of filter phases stored in the polyphase table
+    const std::size_t phaseCount = 256;
+
+    // Number of zero crossings of the filter on each side, at full bandwidth
+    const std::size_t zeroCrossings = 16;
+
+    // Fraction of the Nyquist frequency kept by the anti-aliasing filter
+    const double passBand = 0.95;
+
+    const double pi = 3.14159265358979323846;
+
+
+    ////////////////////////////////////////////////////////////
+    float dotProduct(const float* samples, const float* coefficients, std::size_t count)
+    {
+        // count is always a multiple of 4
+    #ifdef CSFML_AUDIOCONVERTER_SSE
+        __m128 sum = _mm_setzero_ps();
+        for (std::size_t i = 0; i < count; i += 4)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_loadu_ps(coefficients + i)));
+
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+        return _mm_cvtss_f32(sum);
+    #else
+        float sum0 = 0.f, sum1 = 0.f, sum2 = 0.f, sum3 = 0.f;
+        for (std::size_t i = 0; i < count; i += 4)
+        {
+            sum0 += samples[i + 0] * coefficients[i + 0];
+            sum1 += samples[i + 1] * coefficients[i + 1];
+            sum2 += samples[i + 2] * coefficients[i + 2];
+            sum3 += samples[i + 3] * coefficients[i + 3];
+        }
+        return (sum0 + sum1) + (sum2 + sum3);
+    #endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfInt16 toSample(float value)
+    {
+        if (value >= 32767.f)
+            return 32767;
+        if (value <= -32768.f)
+            return -32768;
+        return static_cast<sfInt16>(std::floor(value + 0.5f));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void buildMixMatrix(sfAudioConverter& converter)
+    {
+        unsigned int inputs  = converter.InputChannelCount;
+        unsigned int outputs = converter.OutputChannelCount;
+        converter.Mix.assign(inputs * outputs, 0.f);
+
+        for (unsigned int out = 0; out < outputs; ++out)
+        {
+            float* row = &converter.Mix[out * inputs];
+
+            if (outputs >= inputs)
+            {
+                // Same layout, or upmix: every output copies one input
+                row[out % inputs] = 1.f;
+            }
+            else
+            {
+                // Downmix: every output averages the inputs folded onto it
+                unsigned int count = 0;
+                for (unsigned int in = out; in < inputs; in += outputs)
+                    ++count;
+                for (unsigned int in = out; in < inputs; in += outputs)
+                    row[in] = 1.f / count;
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void buildFilter(sfAudioConverter& converter)
+    {
+        // Narrow the pass band when downsampling, and widen the
+        // filter accordingly so that its quality doesn't degrade
+        double scale = std::min(1.0, static_cast<double>(converter.OutputSampleRate) / converter.InputSampleRate);
+        double band  = scale * passBand;
+
+        converter.HalfTaps = std::min<std::size_t>(static_cast<std::size_t>(std::ceil(zeroCrossings / scale)), 256);
+        converter.Taps     = (converter.HalfTaps * 2 + 3) & ~static_cast<std::size_t>(3);
+        converter.Filter.assign((phaseCount + 1) * converter.Taps, 0.f);
+        converter.Coefficients.assign(converter.Taps, 0.f);
+
+        double halfWidth = static_cast<double>(converter.HalfTaps);
+        for (std::size_t phase = 0; phase <= phaseCount; ++phase)
+        {
+            float* row = &converter.Filter[phase * converter.Taps];
+            double fraction = static_cast<double>(phase) / phaseCount;
+            double sum = 0.0;
+
+            for (std::size_t tap = 0; tap < converter.HalfTaps * 2; ++tap)
+            {
+                // Distance between this tap and the interpolated position, in input samples
+                double x = static_cast<double>(tap) - halfWidth + 1.0 - fraction;
+                if (std::fabs(x) >= halfWidth)
+                    continue;
+
+                double sinc   = (x == 0.0) ? 1.0 : std::sin(pi * band * x) / (pi * band * x);
+                double window = 0.42 + 0.5 * std::cos(pi * x / halfWidth) + 0.08 * std::cos(2.0 * pi * x / halfWidth);
+                double value  = band * sinc * window;
+
+                row[tap] = static_cast<float>(value);
+                sum += value;
+            }
+
+            // Normalize every phase to unity gain so that DC goes through unchanged
+            for (std::size_t tap = 0; tap < converter.Taps; ++tap)
+                row[tap] = static_cast<float>(row[tap] / sum);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void resetHistory(sfAudioConverter& converter)
+    {
+        // Prime the filter with silence so that the first output
+        // sample is aligned with the first input sample
+        converter.History.assign(converter.OutputChannelCount, priv::FloatBuffer(converter.HalfTaps - 1, 0.f));
+        converter.Position = converter.HalfTaps - 1;
+        converter.Fraction = 0;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isBypassed(const sfAudioConverter& converter)
+    {
+        return converter.InputSampleRate == converter.OutputSampleRate;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void compactPending(sfAudioConverter& converter)
+    {
+        if (converter.PendingOffset > 0)
+        {
+            converter.Pending.erase(converter.Pending.begin(), converter.Pending.begin() + converter.PendingOffset);
+            converter.PendingOffset = 0;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::size_t drainPending(sfAudioConverter& converter, sfInt16* output, std::size_t outputCapacity)
+    {
+        std::size_t count = std::min(outputCapacity, converter.Pending.size() - converter.PendingOffset);
+        if (count > 0)
+        {
+            std::memcpy(output, &converter.Pending[converter.PendingOffset], count * sizeof(sfInt16));
+            converter.PendingOffset += count;
+        }
+
+        if (converter.PendingOffset == converter.Pending.size())
+        {
+            converter.Pending.clear();
+            converter.PendingOffset = 0;
+        }
+
+        return count;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void mixDirect(sfAudioConverter& converter, const sfInt16* input, std::size_t frameCount)
+    {
+        unsigned int inputs  = converter.InputChannelCount;
+        unsigned int outputs = converter.OutputChannelCount;
+        std::size_t  offset  = converter.Pending.size();
+
+        converter.Pending.resize(offset + frameCount * outputs);
+        sfInt16* output = &converter.Pending[offset];
+
+        if (inputs == outputs)
+        {
+            std::memcpy(output, input, frameCount * outputs * sizeof(sfInt16));
+            return;
+        }
+
+        for (std::size_t frame = 0; frame < frameCount; ++frame)
+        {
+            const sfInt16* in = input + frame * inputs;
+            for (unsigned int out = 0; out < outputs; ++out)
+            {
+                const float* gains = &converter.Mix[out * inputs];
+                float value = 0.f;
+                for (unsigned int channel = 0; channel < inputs; ++channel)
+                    value += gains[channel] * in[channel];
+                *output++ = toSample(value);
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void appendFrames(sfAudioConverter& converter, const sfInt16* input, std::size_t frameCount)
+    {
+        unsigned int inputs  = converter.InputChannelCount;
+        unsigned int outputs = converter.OutputChannelCount;
+        std::size_t  offset  = converter.History[0].size();
+
+        for (unsigned int out = 0; out < outputs; ++out)
+        {
+            priv::FloatBuffer& history = converter.History[out];
+            history.resize(offset + frameCount);
+
+            float*       dest  = &history[offset];
+            const float* gains = &converter.Mix[out * inputs];
+
+            if (input == NULL)
+            {
+                std::fill(dest, dest + frameCount, 0.f);
+            }
+            else if (inputs == outputs)
+            {
+                for (std::size_t frame = 0; frame < frameCount; ++frame)
+                    dest[frame] = input[frame * inputs + out];
+            }
+            else
+            {
+                for (std::size_t frame = 0; frame < frameCount; ++frame)
+                {
+                    const sfInt16* in = input + frame * inputs;
+                    float value = 0.f;
+                    for (unsigned int channel = 0; channel < inputs; ++channel)
+                        value += gains[channel] * in[channel];
+                    dest[frame] = value;
+                }
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void resample(sfAudioConverter& converter)
+    {
+        unsigned int outputs    = converter.OutputChannelCount;
+        std::size_t  frameCount = converter.History[0].size();
+        std::size_t  taps       = converter.Taps;
+        std::size_t  reach      = taps - converter.HalfTaps + 1;
+
+        if (converter.Position + reach <= frameCount)
+        {
+            // Reserve room for all the frames that can be produced from the current history
+            std::size_t available = frameCount - reach - converter.Position + 1;
+            sfUint64 estimate = (static_cast<sfUint64>(available) * converter.OutputSampleRate) / converter.InputSampleRate + 1;
+            converter.Pending.reserve(converter.Pending.size() + static_cast<std::size_t>(estimate) * outputs);
+        }
+
+        float* coefficients = &converter.Coefficients[0];
+        while (converter.Position + reach <= frameCount)
+        {
+            // Interpolate the filter between the two closest phases
+            float phase = static_cast<float>(converter.Fraction) * phaseCount / converter.OutputSampleRate;
+            std::size_t index = std::min(static_cast<std::size_t>(phase), phaseCount - 1);
+            float blend = phase - static_cast<float>(index);
+
+            const float* low  = &converter.Filter[index * taps];
+            const float* high = low + taps;
+            for (std::size_t tap = 0; tap < taps; ++tap)
+                coefficients[tap] = low[tap] + blend * (high[tap] - low[tap]);
+
+            std::size_t start = converter.Position + 1 - converter.HalfTaps;
+            for (unsigned int out = 0; out < outputs; ++out)
+                converter.Pending.push_back(toSample(dotProduct(&converter.History[out][start], coefficients, taps)));
+
+            // Advance by inputRate / outputRate input frames, using exact integer arithmetic
+            converter.Fraction += converter.InputSampleRate;
+            converter.Position += converter.Fraction / converter.OutputSampleRate;
+            converter.Fraction %= converter.OutputSampleRate;
+        }
+
+        // Drop the frames that the filter will never read again
+        std::size_t consumed = std::min(converter.Position + 1 - converter.HalfTaps, frameCount);
+        if (consumed > 0)
+        {
+            for (unsigned int out = 0; out < outputs; ++out)
+                converter.History[out].erase(converter.History[out].begin(), converter.History[out].begin() + consumed);
+            converter.Position -= consumed;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfAudioConverter* sfAudioConverter_create(unsigned int inputChannelCount,
+                                          unsigned int inputSampleRate,
+                                          unsigned int outputChannelCount,
+                                          unsigned int outputSampleRate)
+{
+    if ((inputChannelCount == 0) || (inputSampleRate == 0) || (outputChannelCount == 0) || (outputSampleRate == 0))
+        return NULL;
+
+    sfAudioConverter* converter = new sfAudioConverter;
+    converter->InputChannelCount  = inputChannelCount;
+    converter->InputSampleRate    = inputSampleRate;
+    converter->OutputChannelCount = outputChannelCount;
+    converter->OutputSampleRate   = outputSampleRate;
+    converter->PendingOffset      = 0;
+
+    buildMixMatrix(*converter);
+    buildFilter(*converter);
+    resetHistory(*converter);
+
+    return converter;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioConverter_destroy(sfAudioConverter* converter)
+{
+    delete converter;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfAudioConverter_convert(sfAudioConverter* converter, const sfInt16* input, size_t inputSampleCount, sfInt16* output, size_t outputCapacity)
+{
+    CSFML_CHECK_RETURN(converter, 0);
+
+    std::size_t frameCount = inputSampleCount / converter->InputChannelCount;
+    if (input && (frameCount > 0))
+    {
+        compactPending(*converter);
+
+        if (isBypassed(*converter))
+        {
+            mixDirect(*converter, input, frameCount);
+        }
+        else
+        {
+            appendFrames(*converter, input, frameCount);
+            resample(*converter);
+        }
+    }
+
+    return output ? drainPending(*converter, output, outputCapacity) : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfAudioConverter_flush(sfAudioConverter* converter, sfInt16* output, size_t outputCapacity)
+{
+    CSFML_CHECK_RETURN(converter, 0);
+
+    if (!isBypassed(*converter))
+    {
+        // Pad with silence so that the filter reaches the last input frame
+        compactPending(*converter);
+        appendFrames(*converter, NULL, converter->Taps - converter->HalfTaps);
+        resample(*converter);
+        resetHistory(*converter);
+    }
+
+    return output ? drainPending(*converter, output, outputCapacity) : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAudioConverter_reset(sfAudioConverter* converter)
+{
+    CSFML_CHECK(converter);
+
+    converter->Pending.clear();
+    converter->PendingOffset = 0;
+    resetHistory(*converter);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfAudioConverter_getOutputSampleCount(const sfAudioConverter* converter, size_t inputSampleCount)
+{
+    CSFML_CHECK_RETURN(converter, 0);
+
+    sfUint64 frameCount = inputSampleCount / converter->InputChannelCount;
+    sfUint64 pending    = converter->Pending.size() - converter->PendingOffset;
+
+    if (isBypassed(*converter))
+        return static_cast<size_t>(frameCount * converter->OutputChannelCount + pending);
+
+    // Upper bound, including the padding appended by sfAudioConverter_flush
+    sfUint64 available = converter->History[0].size() + frameCount + converter->Taps;
+    sfUint64 produced  = (available * converter->OutputSampleRate) / converter->InputSampleRate + 1;
+
+    return static_cast<size_t>(produced * converter->OutputChannelCount + pending);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfAudioConverter_getChannelCount(const sfAudioConverter* converter)
+{
+    CSFML_CHECK_RETURN(converter, 0);
+
+    return converter->OutputChannelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfAudioConverter_getSampleRate(const sfAudioConverter* converter)
+{
+    CSFML_CHECK_RETURN(converter, 0);
+
+    return converter->OutputSampleRate;
+}
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_AUDIOCONVERTERSTRUCT_H
+#define SFML_AUDIOCONVERTERSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
+#include <cstddef>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Samples allocated with the functions passed to sfSetAllocator
+    ////////////////////////////////////////////////////////////
+    typedef std::vector<float, Allocator<float> > FloatBuffer;
+}
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfAudioConverter
+////////////////////////////////////////////////////////////
+struct sfAudioConverter : public priv::Allocated
+{
+    unsigned int                                                        InputChannelCount;  ///< Number of interleaved channels in the input
+    unsigned int                                                        InputSampleRate;    ///< Sample rate of the input
+    unsigned int                                                        OutputChannelCount; ///< Number of interleaved channels in the output
+    unsigned int                                                        OutputSampleRate;   ///< Sample rate of the output
+    priv::FloatBuffer                                                   Mix;                ///< Channel mixing matrix (OutputChannelCount rows of InputChannelCount gains)
+    std::size_t                                                         HalfTaps;           ///< Number of filter taps on each side of the interpolated position
+    std::size_t                                                         Taps;               ///< Total number of taps of a filter phase (multiple of 4)
+    priv::FloatBuffer                                                   Filter;             ///< Polyphase filter table, PhaseCount + 1 rows of Taps coefficients
+    priv::FloatBuffer                                                   Coefficients;       ///< Scratch row interpolated between two phases
+    std::vector<priv::FloatBuffer, priv::Allocator<priv::FloatBuffer> > History;            ///< Planar input frames still needed by the filter, one vector per output channel
+    std::size_t                                                         Position;           ///< Integer part of the current read position in History
+    unsigned int                                                        Fraction;           ///< Fractional part of the read position, in 1/OutputSampleRate units
+    std::vector<sfInt16, priv::Allocator<sfInt16> >                     Pending;            ///< Converted samples that did not fit in the caller's output
+    std::size_t                                                         PendingOffset;      ///< Index of the first pending sample not yet returned
+};
+
+
+#endif // SFML_AUDIOCONVERTERSTRUCT_H
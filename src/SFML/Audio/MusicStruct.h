@@ -30,14 +30,46 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Music.hpp>
 #include <SFML/CallbackStream.h>
+#include <SFML/ObjectAllocator.h>
+#include <SFML/ProfileZone.h>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // sf::Music that profiles the decoding of every chunk, done
+    // by the streaming thread of SFML
+    ////////////////////////////////////////////////////////////
+    class ProfiledMusic : public sf::Music
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        // The streaming thread must be stopped before this class is
+        // destroyed, since it calls onGetData through the vtable
+        ////////////////////////////////////////////////////////////
+        ~ProfiledMusic()
+        {
+            stop();
+        }
+
+    protected:
+
+        virtual bool onGetData(Chunk& data)
+        {
+            CSFML_PROFILE_ZONE("sfMusic_decode");
+            return sf::Music::onGetData(data);
+        }
+    };
+}
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfMusic
 ////////////////////////////////////////////////////////////
-struct sfMusic
+struct sfMusic : public priv::Allocated
 {
-    sf::Music This;
+    priv::ProfiledMusic This;
     CallbackStream Stream;
 };
 
@@ -30,6 +30,55 @@
 #include <SFML/Internal.h>
 
 
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    bool operator !=(const sfVector3f& left, const sfVector3f& right)
+    {
+        return (left.x != right.x) || (left.y != right.y) || (left.z != right.z);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void applyPosition(sfSound& sound, const sfVector3f& position)
+    {
+        if (position != sound.Spatialization.position)
+        {
+            sound.This.setPosition(position.x, position.y, position.z);
+            sound.Spatialization.position = position;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void applySpatialization(sfSound& sound, const sfSoundSpatialization& parameters)
+    {
+        sfSoundSpatialization& current = sound.Spatialization;
+
+        applyPosition(sound, parameters.position);
+
+        if (parameters.minDistance != current.minDistance)
+        {
+            sound.This.setMinDistance(parameters.minDistance);
+            current.minDistance = parameters.minDistance;
+        }
+
+        if (parameters.attenuation != current.attenuation)
+        {
+            sound.This.setAttenuation(parameters.attenuation);
+            current.attenuation = parameters.attenuation;
+        }
+
+        sfBool relative = parameters.relativeToListener ? sfTrue : sfFalse;
+        if (relative != current.relativeToListener)
+        {
+            sound.This.setRelativeToListener(relative == sfTrue);
+            current.relativeToListener = relative;
+        }
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 sfSound* sfSound_create(void)
 {
@@ -135,6 +184,9 @@ void sfSound_setVolume(sfSound* sound, float volume)
 void sfSound_setPosition(sfSound* sound, sfVector3f position)
 {
     CSFML_CALL(sound, setPosition(sf::Vector3f(position.x, position.y, position.z)));
+
+    if (sound)
+        sound->Spatialization.position = position;
 }
 
 
@@ -142,6 +194,9 @@ void sfSound_setPosition(sfSound* sound, sfVector3f position)
 void sfSound_setRelativeToListener(sfSound* sound, sfBool relative)
 {
     CSFML_CALL(sound, setRelativeToListener(relative == sfTrue));
+
+    if (sound)
+        sound->Spatialization.relativeToListener = (relative == sfTrue) ? sfTrue : sfFalse;
 }
 
 
@@ -149,6 +204,9 @@ void sfSound_setRelativeToListener(sfSound* sound, sfBool relative)
 void sfSound_setMinDistance(sfSound* sound, float distance)
 {
     CSFML_CALL(sound, setMinDistance(distance));
+
+    if (sound)
+        sound->Spatialization.minDistance = distance;
 }
 
 
@@ -156,6 +214,37 @@ void sfSound_setMinDistance(sfSound* sound, float distance)
 void sfSound_setAttenuation(sfSound* sound, float attenuation)
 {
     CSFML_CALL(sound, setAttenuation(attenuation));
+
+    if (sound)
+        sound->Spatialization.attenuation = attenuation;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSound_setPositions(sfSound** sounds, const sfVector3f* positions, size_t count)
+{
+    CSFML_CHECK(sounds);
+    CSFML_CHECK(positions);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (sounds[i])
+            applyPosition(*sounds[i], positions[i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSound_setSpatializations(sfSound** sounds, const sfSoundSpatialization* parameters, size_t count)
+{
+    CSFML_CHECK(sounds);
+    CSFML_CHECK(parameters);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (sounds[i])
+            applySpatialization(*sounds[i], parameters[i]);
+    }
 }
 
 
@@ -0,0 +1,582 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundBank.h>
+#include <SFML/Audio/SoundBankStruct.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/Internal.h>
+#include <set>
+#include <string>
+#include <cstring>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Layout of a sound bank file (all integers are little endian):
+    //
+    // header : magic "CSBK", version (32), clip count (32), size of the name table (32)
+    // index  : one entry per clip: offset (64), size (64), name offset (32), name hash (32)
+    // names  : null-terminated clip names
+    // data   : clip files, each one aligned on 16 bytes
+    ////////////////////////////////////////////////////////////
+    const char        magic[4]     = {'C', 'S', 'B', 'K'};
+    const sfUint32    version      = 1;
+    const std::size_t headerSize   = 16;
+    const std::size_t entrySize    = 24;
+    const std::size_t dataAlign    = 16;
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 hashName(const char* name)
+    {
+        // 32 bits FNV-1a
+        sfUint32 hash = 2166136261u;
+        for (; *name; ++name)
+        {
+            hash ^= static_cast<unsigned char>(*name);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void write32(std::vector<char>& buffer, std::size_t offset, sfUint32 value)
+    {
+        for (int i = 0; i < 4; ++i)
+            buffer[offset + i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void write64(std::vector<char>& buffer, std::size_t offset, sfUint64 value)
+    {
+        for (int i = 0; i < 8; ++i)
+            buffer[offset + i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 read32(const char* data)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        return static_cast<sfUint32>(bytes[0])
+             | (static_cast<sfUint32>(bytes[1]) << 8)
+             | (static_cast<sfUint32>(bytes[2]) << 16)
+             | (static_cast<sfUint32>(bytes[3]) << 24);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint64 read64(const char* data)
+    {
+        return static_cast<sfUint64>(read32(data)) | (static_cast<sfUint64>(read32(data + 4)) << 32);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool seekFile(std::FILE* file, sfUint64 offset)
+    {
+    #if defined(_MSC_VER)
+        return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+    #elif defined(CSFML_SYSTEM_WINDOWS)
+        return fseeko64(file, static_cast<off64_t>(offset), SEEK_SET) == 0;
+    #else
+        return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+    #endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool getFileSize(std::FILE* file, sfUint64& size)
+    {
+    #if defined(_MSC_VER)
+        if (_fseeki64(file, 0, SEEK_END) != 0)
+            return false;
+        __int64 end = _ftelli64(file);
+    #elif defined(CSFML_SYSTEM_WINDOWS)
+        if (fseeko64(file, 0, SEEK_END) != 0)
+            return false;
+        off64_t end = ftello64(file);
+    #else
+        if (fseeko(file, 0, SEEK_END) != 0)
+            return false;
+        off_t end = ftello(file);
+    #endif
+        if (end < 0)
+            return false;
+
+        size = static_cast<sfUint64>(end);
+        return seekFile(file, 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    const char* mapFile(const char* filename, sfUint64& size)
+    {
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return NULL;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0))
+        {
+            CloseHandle(file);
+            return NULL;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (!mapping)
+            return NULL;
+
+        // The view keeps the mapping alive, the handle is not needed anymore
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view)
+            return NULL;
+
+        size = static_cast<sfUint64>(fileSize.QuadPart);
+        return static_cast<const char*>(view);
+    #else
+        int file = open(filename, O_RDONLY);
+        if (file < 0)
+            return NULL;
+
+        struct stat status;
+        if ((fstat(file, &status) != 0) || (status.st_size <= 0))
+        {
+            close(file);
+            return NULL;
+        }
+
+        void* view = mmap(NULL, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (view == MAP_FAILED)
+            return NULL;
+
+        size = static_cast<sfUint64>(status.st_size);
+        return static_cast<const char*>(view);
+    #endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void unmapFile(const char* data, sfUint64 size)
+    {
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        (void)size;
+        UnmapViewOfFile(data);
+    #else
+        munmap(const_cast<char*>(data), static_cast<std::size_t>(size));
+    #endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool parseIndex(sfSoundBank& bank, const char* index, std::size_t indexSize, sfUint64 bankSize)
+    {
+        if ((indexSize < headerSize) || (std::memcmp(index, magic, 4) != 0) || (read32(index + 4) != version))
+            return false;
+
+        // Sizes are computed on 64 bits, so that they can't wrap on 32-bit platforms
+        sfUint32 clipCount = read32(index + 8);
+        sfUint32 nameBytes = read32(index + 12);
+        sfUint64 namesAt   = headerSize + static_cast<sfUint64>(clipCount) * entrySize;
+        if (namesAt + nameBytes > indexSize)
+            return false;
+
+        // Copy the name table and make sure that every name is terminated
+        bank.Names.assign(index + namesAt, index + namesAt + nameBytes);
+        bank.Names.push_back('\0');
+
+        bank.Clips.resize(clipCount);
+        for (std::size_t i = 0; i < clipCount; ++i)
+        {
+            const char*      entry = index + headerSize + i * entrySize;
+            sfSoundBankClip& clip  = bank.Clips[i];
+            sfUint32 nameOffset = read32(entry + 16);
+
+            clip.Offset = read64(entry);
+            clip.Size   = read64(entry + 8);
+            clip.Buffer = NULL;
+            if ((nameOffset >= nameBytes) || (clip.Offset > bankSize) || (clip.Size > bankSize - clip.Offset))
+                return false;
+
+            // The stored hash isn't trusted, a wrong one would make the clip unreachable
+            clip.Name = &bank.Names[nameOffset];
+            clip.Hash = hashName(clip.Name);
+        }
+
+        // Build the lookup table, with a load factor of at most 50%
+        std::size_t capacity = 1;
+        while (capacity < clipCount * 2)
+            capacity *= 2;
+        bank.Table.assign(capacity, 0);
+        for (std::size_t i = 0; i < clipCount; ++i)
+        {
+            std::size_t slot = bank.Clips[i].Hash & (capacity - 1);
+            while (bank.Table[slot] != 0)
+                slot = (slot + 1) & (capacity - 1);
+            bank.Table[slot] = static_cast<sfUint32>(i + 1);
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfSoundBank* createBank()
+    {
+        sfSoundBank* bank = new sfSoundBank;
+        bank->Data   = NULL;
+        bank->Size   = 0;
+        bank->Mapped = false;
+        bank->File   = NULL;
+        return bank;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfSoundBuffer* decodeClip(sfSoundBank& bank, std::size_t index)
+    {
+        const sfSoundBankClip& clip = bank.Clips[index];
+        std::vector<char, priv::Allocator<char> > storage;
+        const char* data = NULL;
+
+        if (bank.Data)
+        {
+            data = bank.Data + clip.Offset;
+        }
+        else
+        {
+            sf::Lock lock(bank.Mutex);
+
+            storage.resize(static_cast<std::size_t>(clip.Size));
+            if (storage.empty() || !seekFile(bank.File, clip.Offset) || (std::fread(&storage[0], 1, storage.size(), bank.File) != storage.size()))
+                return NULL;
+
+            data = &storage[0];
+        }
+
+        sfSoundBuffer* buffer = new sfSoundBuffer;
+
+        if (!buffer->This.loadFromMemory(data, static_cast<std::size_t>(clip.Size)))
+        {
+            delete buffer;
+            buffer = NULL;
+        }
+
+        return buffer;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool copyFile(std::FILE* output, const char* filename, sfUint64& size)
+    {
+        std::FILE* input = std::fopen(filename, "rb");
+        if (!input)
+            return false;
+
+        char buffer[65536];
+        size = 0;
+        std::size_t count;
+        bool ok = true;
+        while (ok && ((count = std::fread(buffer, 1, sizeof(buffer), input)) > 0))
+        {
+            ok = (std::fwrite(buffer, 1, count, output) == count);
+            size += count;
+        }
+
+        ok = ok && !std::ferror(input);
+        std::fclose(input);
+
+        return ok;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfSoundBank_pack(const char* filename, const char* const* clipNames, const char* const* clipFiles, size_t clipCount)
+{
+    CSFML_CHECK_RETURN(filename, sfFalse);
+    if (clipCount > 0)
+    {
+        CSFML_CHECK_RETURN(clipNames, sfFalse);
+        CSFML_CHECK_RETURN(clipFiles, sfFalse);
+    }
+
+    // Build the name table, rejecting duplicates
+    std::set<std::string> uniqueNames;
+    std::vector<char>     names;
+    std::vector<sfUint32> nameOffsets(clipCount);
+    for (std::size_t i = 0; i < clipCount; ++i)
+    {
+        if (!clipNames[i] || !clipFiles[i] || !uniqueNames.insert(clipNames[i]).second)
+            return sfFalse;
+
+        nameOffsets[i] = static_cast<sfUint32>(names.size());
+        names.insert(names.end(), clipNames[i], clipNames[i] + std::strlen(clipNames[i]) + 1);
+    }
+
+    std::size_t indexSize = headerSize + clipCount * entrySize + names.size();
+    std::vector<char> index(indexSize, 0);
+    std::memcpy(&index[0], magic, 4);
+    write32(index, 4, version);
+    write32(index, 8, static_cast<sfUint32>(clipCount));
+    write32(index, 12, static_cast<sfUint32>(names.size()));
+    if (!names.empty())
+        std::memcpy(&index[headerSize + clipCount * entrySize], &names[0], names.size());
+
+    std::FILE* output = std::fopen(filename, "wb");
+    if (!output)
+        return sfFalse;
+
+    // Reserve room for the index, append the clips, then fill the index
+    bool ok = (std::fwrite(&index[0], 1, index.size(), output) == index.size());
+    sfUint64 offset = index.size();
+    for (std::size_t i = 0; ok && (i < clipCount); ++i)
+    {
+        static const char padding[dataAlign] = {0};
+        std::size_t paddingSize = static_cast<std::size_t>((dataAlign - offset % dataAlign) % dataAlign);
+        ok = (std::fwrite(padding, 1, paddingSize, output) == paddingSize);
+        offset += paddingSize;
+
+        sfUint64 size = 0;
+        ok = ok && copyFile(output, clipFiles[i], size);
+
+        std::size_t entry = headerSize + i * entrySize;
+        write64(index, entry, offset);
+        write64(index, entry + 8, size);
+        write32(index, entry + 16, nameOffsets[i]);
+        write32(index, entry + 20, hashName(clipNames[i]));
+        offset += size;
+    }
+
+    ok = ok && seekFile(output, 0) && (std::fwrite(&index[0], 1, index.size(), output) == index.size());
+    ok = (std::fclose(output) == 0) && ok;
+
+    if (!ok)
+        std::remove(filename);
+
+    return ok ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSoundBank* sfSoundBank_createFromFile(const char* filename, sfBool memoryMapped)
+{
+    CSFML_CHECK_RETURN(filename, NULL);
+
+    sfSoundBank* bank = createBank();
+    bool ok = false;
+
+    if (memoryMapped)
+    {
+        bank->Data = mapFile(filename, bank->Size);
+        if (bank->Data)
+        {
+            bank->Mapped = true;
+            ok = parseIndex(*bank, bank->Data, static_cast<std::size_t>(bank->Size), bank->Size);
+        }
+    }
+    else
+    {
+        bank->File = std::fopen(filename, "rb");
+        if (bank->File && getFileSize(bank->File, bank->Size))
+        {
+            // Read the header first to know the size of the whole index
+            std::vector<char> index(headerSize);
+            if (std::fread(&index[0], 1, headerSize, bank->File) == headerSize)
+            {
+                sfUint64 indexSize = headerSize + static_cast<sfUint64>(read32(&index[8])) * entrySize + read32(&index[12]);
+                if (indexSize <= bank->Size)
+                {
+                    index.resize(static_cast<std::size_t>(indexSize));
+                    std::size_t remaining = index.size() - headerSize;
+                    if ((remaining == 0) || (std::fread(&index[headerSize], 1, remaining, bank->File) == remaining))
+                        ok = parseIndex(*bank, &index[0], index.size(), bank->Size);
+                }
+            }
+        }
+    }
+
+    if (!ok)
+    {
+        sfSoundBank_destroy(bank);
+        bank = NULL;
+    }
+
+    return bank;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSoundBank* sfSoundBank_createFromMemory(const void* data, size_t sizeInBytes)
+{
+    CSFML_CHECK_RETURN(data, NULL);
+
+    sfSoundBank* bank = createBank();
+    bank->Data = static_cast<const char*>(data);
+    bank->Size = sizeInBytes;
+
+    if (!parseIndex(*bank, bank->Data, sizeInBytes, sizeInBytes))
+    {
+        sfSoundBank_destroy(bank);
+        bank = NULL;
+    }
+
+    return bank;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSoundBank_destroy(sfSoundBank* soundBank)
+{
+    if (!soundBank)
+        return;
+
+    for (std::size_t i = 0; i < soundBank->Clips.size(); ++i)
+        delete soundBank->Clips[i].Buffer;
+
+    if (soundBank->Mapped)
+        unmapFile(soundBank->Data, soundBank->Size);
+    if (soundBank->File)
+        std::fclose(soundBank->File);
+
+    delete soundBank;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfSoundBank_getClipCount(const sfSoundBank* soundBank)
+{
+    CSFML_CHECK_RETURN(soundBank, 0);
+
+    return soundBank->Clips.size();
+}
+
+
+////////////////////////////////////////////////////////////
+long sfSoundBank_findClip(const sfSoundBank* soundBank, const char* name)
+{
+    CSFML_CHECK_RETURN(soundBank, -1);
+    CSFML_CHECK_RETURN(name, -1);
+
+    if (soundBank->Table.empty())
+        return -1;
+
+    sfUint32    hash = hashName(name);
+    std::size_t mask = soundBank->Table.size() - 1;
+    for (std::size_t slot = hash & mask; soundBank->Table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        std::size_t index = soundBank->Table[slot] - 1;
+        const sfSoundBankClip& clip = soundBank->Clips[index];
+        if ((clip.Hash == hash) && (std::strcmp(clip.Name, name) == 0))
+            return static_cast<long>(index);
+    }
+
+    return -1;
+}
+
+
+////////////////////////////////////////////////////////////
+const char* sfSoundBank_getClipName(const sfSoundBank* soundBank, size_t clip)
+{
+    CSFML_CHECK_RETURN(soundBank, NULL);
+
+    return clip < soundBank->Clips.size() ? soundBank->Clips[clip].Name : NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+const sfSoundBuffer* sfSoundBank_getSoundBuffer(sfSoundBank* soundBank, size_t clip)
+{
+    CSFML_CHECK_RETURN(soundBank, NULL);
+
+    if (clip >= soundBank->Clips.size())
+        return NULL;
+
+    {
+        sf::Lock lock(soundBank->Mutex);
+        if (soundBank->Clips[clip].Buffer)
+            return soundBank->Clips[clip].Buffer;
+    }
+
+    // Decode without holding the lock, so that other clips can be decoded in parallel
+    sfSoundBuffer* buffer = decodeClip(*soundBank, clip);
+    if (!buffer)
+        return NULL;
+
+    sf::Lock lock(soundBank->Mutex);
+    if (soundBank->Clips[clip].Buffer)
+        delete buffer;
+    else
+        soundBank->Clips[clip].Buffer = buffer;
+
+    return soundBank->Clips[clip].Buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSoundBuffer* sfSoundBank_createSoundBuffer(sfSoundBank* soundBank, size_t clip)
+{
+    CSFML_CHECK_RETURN(soundBank, NULL);
+
+    if (clip >= soundBank->Clips.size())
+        return NULL;
+
+    return decodeClip(*soundBank, clip);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSoundBank_unloadSoundBuffer(sfSoundBank* soundBank, size_t clip)
+{
+    CSFML_CHECK(soundBank);
+
+    if (clip >= soundBank->Clips.size())
+        return;
+
+    sf::Lock lock(soundBank->Mutex);
+    delete soundBank->Clips[clip].Buffer;
+    soundBank->Clips[clip].Buffer = NULL;
+}
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SOUNDBANKSTRUCT_H
+#define SFML_SOUNDBANKSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Audio/SoundBufferStruct.h>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
+#include <cstdio>
+
+
+////////////////////////////////////////////////////////////
+// Entry of the index of a sound bank
+////////////////////////////////////////////////////////////
+struct sfSoundBankClip
+{
+    sfUint64       Offset; ///< Offset of the clip data from the beginning of the bank
+    sfUint64       Size;   ///< Size of the clip data, in bytes
+    const char*    Name;   ///< Name of the clip, points into the name table
+    sfUint32       Hash;   ///< FNV-1a hash of the name
+    sfSoundBuffer* Buffer; ///< Decoded sound buffer, NULL until requested
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfSoundBank
+////////////////////////////////////////////////////////////
+struct sfSoundBank : public priv::Allocated
+{
+    std::vector<sfSoundBankClip, priv::Allocator<sfSoundBankClip> > Clips;  ///< Index of the bank
+    std::vector<char, priv::Allocator<char> >                       Names;  ///< Name table, null-terminated strings
+    std::vector<sfUint32, priv::Allocator<sfUint32> >               Table;  ///< Open addressing hash table of clip identifiers + 1 (0 = empty slot)
+    const char*                                                     Data;   ///< Whole bank in memory (mapped or provided by the user), or NULL
+    sfUint64                                                        Size;   ///< Size of the whole bank, in bytes
+    bool                                                            Mapped; ///< Whether Data is a file mapping owned by the bank
+    std::FILE*                                                      File;   ///< File to read clips from when the bank is not in memory
+    sf::Mutex                                                       Mutex;  ///< Protects File and the decoded buffers
+};
+
+
+#endif // SFML_SOUNDBANKSTRUCT_H
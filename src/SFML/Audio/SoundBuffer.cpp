@@ -27,13 +27,18 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundBuffer.h>
 #include <SFML/Audio/SoundBufferStruct.h>
+#include <SFML/Audio/AudioConverter.h>
 #include <SFML/CallbackStream.h>
 #include <SFML/Internal.h>
+#include <SFML/ProfileZone.h>
+#include <vector>
 
 
 ////////////////////////////////////////////////////////////
 sfSoundBuffer* sfSoundBuffer_createFromFile(const char* filename)
 {
+    CSFML_PROFILE_ZONE("sfSoundBuffer_createFromFile");
+
     sfSoundBuffer* buffer = new sfSoundBuffer;
 
     if (!buffer->This.loadFromFile(filename))
@@ -49,6 +54,8 @@ sfSoundBuffer* sfSoundBuffer_createFromFile(const char* filename)
 ////////////////////////////////////////////////////////////
 sfSoundBuffer* sfSoundBuffer_createFromMemory(const void* data, size_t sizeInBytes)
 {
+    CSFML_PROFILE_ZONE("sfSoundBuffer_createFromMemory");
+
     sfSoundBuffer* buffer = new sfSoundBuffer;
 
     if (!buffer->This.loadFromMemory(data, sizeInBytes))
@@ -65,6 +72,8 @@ sfSoundBuffer* sfSoundBuffer_createFromMemory(const void* data, size_t sizeInByt
 ////////////////////////////////////////////////////////////
 sfSoundBuffer* sfSoundBuffer_createFromStream(sfInputStream* stream)
 {
+    CSFML_PROFILE_ZONE("sfSoundBuffer_createFromStream");
+
     CSFML_CHECK_RETURN(stream, NULL);
 
     sfSoundBuffer* buffer = new sfSoundBuffer;
@@ -94,6 +103,38 @@ sfSoundBuffer* sfSoundBuffer_createFromSamples(const sfInt16* samples, sfUint64
 }
 
 
+////////////////////////////////////////////////////////////
+sfSoundBuffer* sfSoundBuffer_createResampled(const sfSoundBuffer* soundBuffer, unsigned int channelCount, unsigned int sampleRate)
+{
+    CSFML_CHECK_RETURN(soundBuffer, NULL);
+
+    const sf::SoundBuffer& source = soundBuffer->This;
+    if (source.getSampleCount() == 0)
+        return NULL;
+
+    sfAudioConverter* converter = sfAudioConverter_create(source.getChannelCount(), source.getSampleRate(), channelCount, sampleRate);
+    if (!converter)
+        return NULL;
+
+    std::size_t sampleCount = static_cast<std::size_t>(source.getSampleCount());
+    std::vector<sf::Int16> samples(sfAudioConverter_getOutputSampleCount(converter, sampleCount));
+
+    std::size_t count = sfAudioConverter_convert(converter, source.getSamples(), sampleCount, &samples[0], samples.size());
+    count += sfAudioConverter_flush(converter, &samples[count], samples.size() - count);
+    sfAudioConverter_destroy(converter);
+
+    sfSoundBuffer* buffer = new sfSoundBuffer;
+
+    if (!buffer->This.loadFromSamples(&samples[0], count, channelCount, sampleRate))
+    {
+        delete buffer;
+        buffer = NULL;
+    }
+
+    return buffer;
+}
+
+
 ////////////////////////////////////////////////////////////
 sfSoundBuffer* sfSoundBuffer_copy(const sfSoundBuffer* soundBuffer)
 {
@@ -30,12 +30,13 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundBufferRecorder.hpp>
 #include <SFML/Audio/SoundBufferStruct.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundBufferRecorder
 ////////////////////////////////////////////////////////////
-struct sfSoundBufferRecorder
+struct sfSoundBufferRecorder : public priv::Allocated
 {
     sf::SoundBufferRecorder This;
     mutable sfSoundBuffer   SoundBuffer;
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundBuffer
 ////////////////////////////////////////////////////////////
-struct sfSoundBuffer
+struct sfSoundBuffer : public priv::Allocated
 {
     sf::SoundBuffer This;
 };
@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundRecorder.hpp>
 #include <SFML/Audio/SoundRecorder.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -90,7 +91,7 @@ private :
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundRecorder
 ////////////////////////////////////////////////////////////
-struct sfSoundRecorder
+struct sfSoundRecorder : public priv::Allocated
 {
     sfSoundRecorder(sfSoundRecorderStartCallback   onStart,
                     sfSoundRecorderProcessCallback onProcess,
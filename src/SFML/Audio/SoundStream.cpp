@@ -41,6 +41,23 @@ sfSoundStream* sfSoundStream_create(sfSoundStreamGetDataCallback onGetData,
 }
 
 
+////////////////////////////////////////////////////////////
+sfSoundStream* sfSoundStream_createConverted(sfSoundStreamGetDataCallback onGetData,
+                                             sfSoundStreamSeekCallback    onSeek,
+                                             unsigned int                 sourceChannelCount,
+                                             unsigned int                 sourceSampleRate,
+                                             unsigned int                 channelCount,
+                                             unsigned int                 sampleRate,
+                                             void*                        userData)
+{
+    sfAudioConverter* converter = sfAudioConverter_create(sourceChannelCount, sourceSampleRate, channelCount, sampleRate);
+    if (!converter)
+        return NULL;
+
+    return new sfSoundStream(onGetData, onSeek, channelCount, sampleRate, userData, converter);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfSoundStream_destroy(sfSoundStream* soundStream)
 {
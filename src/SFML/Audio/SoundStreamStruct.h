@@ -29,6 +29,9 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/SoundStream.hpp>
+#include <SFML/Audio/AudioConverter.h>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
 
 
 ////////////////////////////////////////////////////////////
@@ -43,18 +46,30 @@ public :
                       sfSoundStreamSeekCallback    onSeek,
                       unsigned int                 channelCount,
                       unsigned int                 sampleRate,
-                      void*                        userData) :
+                      void*                        userData,
+                      sfAudioConverter*            converter) :
     myGetDataCallback(onGetData),
     mySeekCallback   (onSeek),
-    myUserData       (userData)
+    myUserData       (userData),
+    myConverter      (converter)
     {
         initialize(channelCount, sampleRate);
     }
 
+    ~sfSoundStreamImpl()
+    {
+        // Make sure that the streaming thread no longer uses the converter
+        stop();
+        sfAudioConverter_destroy(myConverter);
+    }
+
 private :
 
     virtual bool onGetData(Chunk& data)
     {
+        if (myConverter)
+            return onGetConvertedData(data);
+
         sfSoundStreamChunk chunk = {NULL, 0};
         bool ok = (myGetDataCallback(&chunk, myUserData) == sfTrue);
 
@@ -64,8 +79,37 @@ private :
         return ok;
     }
 
+    bool onGetConvertedData(Chunk& data)
+    {
+        // The converter may hold back a few samples, so keep pulling
+        // source data until some output is available or the source ends
+        std::size_t count = 0;
+        bool ok = true;
+        while (ok && (count == 0))
+        {
+            sfSoundStreamChunk chunk = {NULL, 0};
+            ok = (myGetDataCallback(&chunk, myUserData) == sfTrue);
+
+            myConvertedSamples.resize(sfAudioConverter_getOutputSampleCount(myConverter, chunk.sampleCount) + 1);
+            count = sfAudioConverter_convert(myConverter, chunk.samples, chunk.sampleCount, &myConvertedSamples[0], myConvertedSamples.size());
+
+            if (!ok)
+                count += sfAudioConverter_flush(myConverter, &myConvertedSamples[count], myConvertedSamples.size() - count);
+            else if (chunk.sampleCount == 0)
+                break;
+        }
+
+        data.samples     = count > 0 ? &myConvertedSamples[0] : NULL;
+        data.sampleCount = count;
+
+        return ok;
+    }
+
     virtual void onSeek(sf::Time timeOffset)
     {
+        if (myConverter)
+            sfAudioConverter_reset(myConverter);
+
         if (mySeekCallback)
         {
             sfTime time = {timeOffset.asMicroseconds()};
@@ -76,20 +120,23 @@ private :
     sfSoundStreamGetDataCallback myGetDataCallback;
     sfSoundStreamSeekCallback    mySeekCallback;
     void*                        myUserData;
+    sfAudioConverter*            myConverter;
+    std::vector<sfInt16>         myConvertedSamples;
 };
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSoundStream
 ////////////////////////////////////////////////////////////
-struct sfSoundStream
+struct sfSoundStream : public priv::Allocated
 {
     sfSoundStream(sfSoundStreamGetDataCallback onGetData,
                   sfSoundStreamSeekCallback    onSeek,
                   unsigned int                 channelCount,
                   unsigned int                 sampleRate,
-                  void*                        userData) :
-    This(onGetData, onSeek, channelCount, sampleRate, userData)
+                  void*                        userData,
+                  sfAudioConverter*            converter = NULL) :
+    This(onGetData, onSeek, channelCount, sampleRate, userData, converter)
     {
     }
 
@@ -30,15 +30,30 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBufferStruct.h>
+#include <SFML/Audio/Sound.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSound
 ////////////////////////////////////////////////////////////
-struct sfSound
+struct sfSound : public priv::Allocated
 {
-    sf::Sound            This;
-    const sfSoundBuffer* Buffer;
+    sfSound() :
+    Buffer(NULL)
+    {
+        // Default 3D parameters of sf::Sound
+        Spatialization.position.x         = 0.f;
+        Spatialization.position.y         = 0.f;
+        Spatialization.position.z         = 0.f;
+        Spatialization.minDistance        = 1.f;
+        Spatialization.attenuation        = 1.f;
+        Spatialization.relativeToListener = sfFalse;
+    }
+
+    sf::Sound             This;
+    const sfSoundBuffer*  Buffer;
+    sfSoundSpatialization Spatialization; ///< Last 3D parameters applied, to skip redundant driver calls
 };
 
 
@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Event.h>
+#include <cstddef>
 
 
 ////////////////////////////////////////////////////////////
@@ -123,4 +124,55 @@ inline void convertEvent(const sf::Event& SFMLEvent, sfEvent* event)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+// Tell whether an event only updates the previous one, and can
+// replace it when move events are coalesced
+////////////////////////////////////////////////////////////
+inline bool canCoalesceEvents(const sfEvent& previous, const sfEvent& event)
+{
+    if (previous.type != event.type)
+        return false;
+
+    switch (event.type)
+    {
+        case sfEvtMouseMoved :
+            return true;
+
+        case sfEvtJoystickMoved :
+            return (previous.joystickMove.joystickId == event.joystickMove.joystickId) &&
+                   (previous.joystickMove.axis       == event.joystickMove.axis);
+
+        case sfEvtTouchMoved :
+            return previous.touch.finger == event.touch.finger;
+
+        default :
+            return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Define a function to pop and convert many events of a window at once
+////////////////////////////////////////////////////////////
+template <typename T>
+inline std::size_t pollEvents(T& window, sfEvent* events, std::size_t capacity, bool coalesce)
+{
+    // Stop as soon as the buffer is full, so that no event is lost:
+    // the remaining ones stay in the window's queue for the next call
+    std::size_t count = 0;
+    sf::Event SFMLEvent;
+    while ((count < capacity) && window.pollEvent(SFMLEvent))
+    {
+        convertEvent(SFMLEvent, &events[count]);
+
+        if (coalesce && (count > 0) && canCoalesceEvents(events[count - 1], events[count]))
+            events[count - 1] = events[count];
+        else
+            ++count;
+    }
+
+    return count;
+}
+
 #endif // SFML_CONVERTEVENT_H
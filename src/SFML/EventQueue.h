@@ -0,0 +1,387 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_EVENTQUEUE_H
+#define SFML_EVENTQUEUE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/Window.hpp>
+#include <SFML/ConvertEvent.h>
+#include <SFML/MonotonicClock.h>
+#include <SFML/Internal.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#if defined(CSFML_SYSTEM_LINUX) || defined(CSFML_SYSTEM_FREEBSD)
+    // Declared here rather than with <X11/Xlib.h>, whose macros
+    // (None, Status, ...) clash with the SFML headers
+    extern "C" int XInitThreads(void);
+#endif
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Input thread of a window, and queue of its timestamped events
+    //
+    // The OS delivers the events of a window to the thread that
+    // created it, so the window is created and polled by a
+    // dedicated thread, which stamps the events as soon as they
+    // arrive and pushes them to a single-producer / single-consumer
+    // lock-free ring. The thread that renders to the window (after
+    // activating it, which happens implicitly when drawing to a
+    // render window) pops them: it must be the only consumer, which
+    // is checked when CSFML_CHECKS is enabled.
+    ////////////////////////////////////////////////////////////
+    class EventQueue
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        explicit EventQueue(sf::Window& window) :
+        myWindow        (window),
+        myStyle         (0),
+        myPriorityRaised(false),
+        myEvents        (Capacity),
+        myHead          (0),
+        myTail          (0),
+        myState         (Starting),
+        myClosed        (false),
+        myWaiters       (0),
+        myConsumer      (std::thread::id())
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        ~EventQueue()
+        {
+            stop();
+
+            // A consumer may still be returning from wait: the mutex and
+            // the condition must outlive it
+            std::unique_lock<std::mutex> lock(myMutex);
+            while (myWaiters > 0)
+                myCondition.wait(lock);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Start the input thread, which creates the window, and
+        // wait until the window is open; returns false on failure
+        ////////////////////////////////////////////////////////////
+        bool start(const sf::VideoMode& mode, const sf::String& title, sf::Uint32 style, const sf::ContextSettings& settings)
+        {
+        #if defined(CSFML_SYSTEM_MACOS)
+
+            // Windows can only be created by the main thread
+            return false;
+
+        #else
+
+        #if defined(CSFML_SYSTEM_LINUX) || defined(CSFML_SYSTEM_FREEBSD)
+            // The connection to the X server is shared by the input
+            // thread and the thread that renders
+            XInitThreads();
+        #endif
+
+            myMode     = mode;
+            myTitle    = title;
+            myStyle    = style;
+            mySettings = settings;
+            myThread   = std::thread(&EventQueue::run, this);
+
+            std::unique_lock<std::mutex> lock(myMutex);
+            while (myState.load() == Starting)
+                myCondition.wait(lock);
+
+            return myState.load() == Running;
+
+        #endif
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Close the window from the input thread and stop it; the
+        // events received until then can still be popped
+        ////////////////////////////////////////////////////////////
+        void close()
+        {
+            // The context of the window is destroyed by the input
+            // thread, it must not stay active in the calling thread
+            if (myState.load() == Running)
+                myWindow.setActive(false);
+
+            int running = Running;
+            myState.compare_exchange_strong(running, Stopping);
+
+            if (myThread.joinable())
+                myThread.join();
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Pop the oldest collected event, if any
+        ////////////////////////////////////////////////////////////
+        bool pop(sfTimedEvent& event)
+        {
+            if (!checkConsumer())
+                return false;
+
+            std::size_t tail = myTail.load(std::memory_order_relaxed);
+            if (tail == myHead.load(std::memory_order_acquire))
+                return false;
+
+            event = myEvents[tail % Capacity];
+            myTail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Pop many events at once, same semantics as pollEvents
+        ////////////////////////////////////////////////////////////
+        std::size_t pop(sfEvent* events, std::size_t capacity, bool coalesce)
+        {
+            std::size_t count = 0;
+            sfTimedEvent event;
+            while ((count < capacity) && pop(event))
+            {
+                if (coalesce && (count > 0) && canCoalesceEvents(events[count - 1], event.event))
+                    events[count - 1] = event.event;
+                else
+                    events[count++] = event.event;
+            }
+
+            return count;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Wait until an event is available and pop it; fails once
+        // the window is closed, like sf::Window::waitEvent
+        ////////////////////////////////////////////////////////////
+        bool wait(sfTimedEvent& event)
+        {
+            if (!checkConsumer())
+                return false;
+
+            // The input thread publishes events before taking the mutex to
+            // notify, so checking the ring under the mutex can't miss a wake up
+            std::unique_lock<std::mutex> lock(myMutex);
+            ++myWaiters;
+
+            bool popped = pop(event);
+            while (!popped && !myClosed)
+            {
+                myCondition.wait(lock);
+                popped = pop(event);
+            }
+
+            // Let the destructor know when the last waiter has left
+            if ((--myWaiters == 0) && myClosed)
+                myCondition.notify_all();
+
+            return popped;
+        }
+
+    private:
+
+        enum State
+        {
+            Starting, ///< The input thread is creating the window
+            Running,  ///< The input thread is collecting events
+            Stopping, ///< The input thread must close the window and exit
+            Stopped   ///< The input thread has exited
+        };
+
+        enum
+        {
+            Capacity = 1024 ///< Maximum number of events waiting to be consumed
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Stop the input thread and wake up the waiting consumer
+        ////////////////////////////////////////////////////////////
+        void stop()
+        {
+            close();
+            setClosed();
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Raise the priority of the input thread, so that it gets
+        // the CPU as soon as an event arrives. This is best effort:
+        // real-time policies usually require privileges outside
+        // Windows, and without them the thread keeps the default
+        // policy, which still wakes it up every millisecond.
+        ////////////////////////////////////////////////////////////
+        static bool raisePriority()
+        {
+        #if defined(CSFML_SYSTEM_WINDOWS)
+            return SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST) != 0;
+        #else
+            sched_param parameters;
+            parameters.sched_priority = sched_get_priority_min(SCHED_RR);
+            return pthread_setschedparam(pthread_self(), SCHED_RR, &parameters) == 0;
+        #endif
+        }
+
+        ////////////////////////////////////////////////////////////
+        void run()
+        {
+            myPriorityRaised = raisePriority();
+
+            // Create the window, and leave its context free for the thread that renders
+            myWindow.create(myMode, myTitle, myStyle, mySettings);
+            bool opened = myWindow.isOpen();
+            if (opened)
+                myWindow.setActive(false);
+
+            {
+                std::lock_guard<std::mutex> lock(myMutex);
+                myState.store(opened ? Running : Stopped);
+            }
+            myCondition.notify_all();
+
+            if (!opened)
+                return;
+
+            // sf::Window::waitEvent polls every 10 ms and can't be interrupted
+            // to stop the thread, so poll directly with a finer period
+            sf::Event SFMLEvent;
+            while (myState.load() == Running)
+            {
+                // When the ring is full, events wait in the window's own queue, so none are lost
+                bool received = false;
+                while (!isFull() && myWindow.pollEvent(SFMLEvent))
+                {
+                    push(SFMLEvent);
+                    received = true;
+                }
+
+                if (received)
+                    notify();
+                else
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            myWindow.close();
+            myState.store(Stopped);
+            setClosed();
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Check that the calling thread is the single consumer of
+        // the ring; the first thread that pops events becomes it
+        ////////////////////////////////////////////////////////////
+        bool checkConsumer()
+        {
+        #if CSFML_CHECKS
+            std::thread::id consumer;
+            std::thread::id caller = std::this_thread::get_id();
+            if (!myConsumer.compare_exchange_strong(consumer, caller) && (consumer != caller))
+            {
+                sfRaiseError(sfErrorInvalidArgument, "the events of a window with an input thread must be consumed by a single thread");
+                return false;
+            }
+        #endif
+
+            return true;
+        }
+
+        ////////////////////////////////////////////////////////////
+        bool isFull() const
+        {
+            return myHead.load(std::memory_order_relaxed) - myTail.load(std::memory_order_acquire) >= Capacity;
+        }
+
+        ////////////////////////////////////////////////////////////
+        void push(const sf::Event& SFMLEvent)
+        {
+            std::size_t head = myHead.load(std::memory_order_relaxed);
+            sfTimedEvent& event = myEvents[head % Capacity];
+            convertEvent(SFMLEvent, &event.event);
+            event.timestamp = getMonotonicTime();
+            myHead.store(head + 1, std::memory_order_release);
+        }
+
+        ////////////////////////////////////////////////////////////
+        void notify()
+        {
+            {
+                std::lock_guard<std::mutex> lock(myMutex);
+            }
+            myCondition.notify_all();
+        }
+
+        ////////////////////////////////////////////////////////////
+        void setClosed()
+        {
+            {
+                std::lock_guard<std::mutex> lock(myMutex);
+                myClosed = true;
+            }
+            myCondition.notify_all();
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        sf::Window&               myWindow;         ///< Window owned by the input thread
+        sf::VideoMode             myMode;           ///< Creation parameters of the window
+        sf::String                myTitle;
+        sf::Uint32                myStyle;
+        sf::ContextSettings       mySettings;
+        std::thread               myThread;         ///< Input thread
+        bool                      myPriorityRaised; ///< Whether the input thread runs with a raised priority
+        std::vector<sfTimedEvent> myEvents;         ///< Ring of collected events
+        std::atomic<std::size_t>  myHead;           ///< Number of events pushed so far (written by the input thread)
+        std::atomic<std::size_t>  myTail;           ///< Number of events popped so far (written by the consumer)
+        std::atomic<int>          myState;          ///< Current State of the input thread
+        std::mutex                myMutex;          ///< Protects myClosed, myWaiters and the state changes, and orders wake ups with waits
+        std::condition_variable   myCondition;      ///< Signaled when events are pushed, the state or myClosed change, or the last waiter leaves
+        bool                      myClosed;         ///< Whether the window was closed
+        unsigned int              myWaiters;        ///< Number of threads inside wait (protected by myMutex)
+        std::atomic<std::thread::id> myConsumer;    ///< Thread that pops the events (checked builds only)
+    };
+}
+
+
+#endif // SFML_EVENTQUEUE_H
@@ -0,0 +1,836 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlockDecoder.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+    // Ranges of the integer sequences, made of bits and either trits or quints
+    struct IseRange
+    {
+        unsigned int Bits;   ///< Number of bits per value
+        unsigned int Trits;  ///< Whether values also have a trit (base 3 digit)
+        unsigned int Quints; ///< Whether values also have a quint (base 5 digit)
+    };
+
+    const unsigned int iseRangeCount = 21;
+    const IseRange iseRanges[iseRangeCount] =
+    {
+        {1, 0, 0}, {0, 1, 0}, {2, 0, 0}, {0, 0, 1}, {1, 1, 0}, {3, 0, 0}, {1, 0, 1}, {2, 1, 0}, {4, 0, 0}, {2, 0, 1}, {3, 1, 0},
+        {5, 0, 0}, {3, 0, 1}, {4, 1, 0}, {6, 0, 0}, {4, 0, 1}, {5, 1, 0}, {7, 0, 0}, {5, 0, 1}, {6, 1, 0}, {8, 0, 0}
+    };
+
+    // Weights only use the first 12 ranges, colors use the ranges starting from 6 levels
+    const unsigned int weightRangeCount = 12;
+    const unsigned int minColorRange = 4;
+
+    // Limits of the weights of a block
+    const unsigned int maxWeights = 64;
+    const unsigned int minWeightBits = 24;
+    const unsigned int maxWeightBits = 96;
+
+    // Limit of the number of color endpoint values of a block
+    const unsigned int maxColorValues = 18;
+
+
+    ////////////////////////////////////////////////////////////
+    // Unquantized values of the color and weight ranges
+    ////////////////////////////////////////////////////////////
+    struct Tables
+    {
+        Tables()
+        {
+            for (unsigned int range = 0; range < iseRangeCount; ++range)
+            {
+                for (unsigned int value = 0; value < 256; ++value)
+                {
+                    Colors[range][value] = unquantize(range, value, true);
+                    if ((range < weightRangeCount) && (value < 32))
+                        Weights[range][value] = unquantize(range, value, false);
+                }
+            }
+        }
+
+        // Bit-replicate a value to a larger number of bits
+        static unsigned int replicate(unsigned int value, unsigned int bits, unsigned int targetBits)
+        {
+            unsigned int result = 0;
+            int shift = static_cast<int>(targetBits);
+            while (shift > 0)
+            {
+                shift -= static_cast<int>(bits);
+                result |= (shift >= 0) ? (value << shift) : (value >> -shift);
+            }
+
+            return result & ((1u << targetBits) - 1);
+        }
+
+        // Unquantize a color to [0, 255] or a weight to [0, 64]
+        static sfUint8 unquantize(unsigned int range, unsigned int value, bool color)
+        {
+            const IseRange& ise = iseRanges[range];
+            unsigned int bits = ise.Bits;
+            unsigned int low = value & ((1u << bits) - 1);
+            unsigned int digit = value >> bits;
+            unsigned int result;
+
+            if (!ise.Trits && !ise.Quints)
+            {
+                result = replicate(low, bits, color ? 8 : 6);
+            }
+            else if (!color && (bits == 0))
+            {
+                static const unsigned int trits[3] = {0, 32, 63};
+                static const unsigned int quints[5] = {0, 16, 32, 47, 63};
+                result = ise.Trits ? trits[digit % 3] : quints[digit % 5];
+            }
+            else
+            {
+                // The other bits of the value are scattered in B, and the digit is scaled by C
+                unsigned int high = low >> 1;
+                unsigned int b = 0;
+                unsigned int c = 0;
+                if (color && ise.Trits)
+                {
+                    switch (bits)
+                    {
+                        case 1: c = 204; break;
+                        case 2: c = 93; b = (high << 8) | (high << 4) | (high << 2) | (high << 1); break;
+                        case 3: c = 44; b = (high << 7) | (high << 2) | high; break;
+                        case 4: c = 22; b = (high << 6) | high; break;
+                        case 5: c = 11; b = (high << 5) | (high >> 2); break;
+                        case 6: c = 5;  b = (high << 4) | (high >> 4); break;
+                    }
+                }
+                else if (color)
+                {
+                    switch (bits)
+                    {
+                        case 1: c = 113; break;
+                        case 2: c = 54; b = (high << 8) | (high << 3) | (high << 2); break;
+                        case 3: c = 26; b = (high << 7) | (high << 1) | (high >> 1); break;
+                        case 4: c = 13; b = (high << 6) | (high >> 1); break;
+                        case 5: c = 6;  b = (high << 5) | (high >> 3); break;
+                    }
+                }
+                else if (ise.Trits)
+                {
+                    switch (bits)
+                    {
+                        case 1: c = 50; break;
+                        case 2: c = 23; b = (high << 6) | (high << 2) | high; break;
+                        case 3: c = 11; b = (high << 5) | high; break;
+                    }
+                }
+                else
+                {
+                    switch (bits)
+                    {
+                        case 1: c = 28; break;
+                        case 2: c = 13; b = (high << 6) | (high << 1); break;
+                    }
+                }
+
+                unsigned int a = (low & 1) ? (color ? 0x1FF : 0x7F) : 0;
+                unsigned int t = (digit * c + b) ^ a;
+                result = (a & (color ? 0x80 : 0x20)) | (t >> 2);
+            }
+
+            // Weights above 32 are shifted to reach 64
+            if (!color && (result > 32))
+                ++result;
+
+            return static_cast<sfUint8>(result);
+        }
+
+        sfUint8 Colors[iseRangeCount][256];
+        sfUint8 Weights[weightRangeCount][32];
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    const Tables& getTables()
+    {
+        static const Tables tables;
+        return tables;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Read bits of a block, from the least significant one; bits
+    // past the limit are read as zeros
+    ////////////////////////////////////////////////////////////
+    unsigned int readBits(const sfUint8* block, unsigned int position, unsigned int count, unsigned int limit = 128)
+    {
+        unsigned int value = 0;
+        for (unsigned int i = 0; (i < count) && (position + i < limit); ++i)
+        {
+            unsigned int bit = position + i;
+            value |= ((block[bit >> 3] >> (bit & 7)) & 1u) << i;
+        }
+
+        return value;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    unsigned int getIseBitCount(unsigned int count, unsigned int range)
+    {
+        const IseRange& ise = iseRanges[range];
+        return count * ise.Bits + (ise.Trits ? (8 * count + 4) / 5 : 0) + (ise.Quints ? (7 * count + 2) / 3 : 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode an integer sequence; each value is (digit << bits) | bits
+    ////////////////////////////////////////////////////////////
+    void decodeIse(const sfUint8* block, unsigned int position, unsigned int count, unsigned int range, unsigned int* values)
+    {
+        const IseRange& ise = iseRanges[range];
+        unsigned int bits = ise.Bits;
+        unsigned int limit = position + getIseBitCount(count, range);
+
+        if (ise.Trits)
+        {
+            // Groups of 5 values, the 8 bits encoding their trits are interleaved with their bits
+            static const unsigned int tritBits[5] = {2, 2, 1, 2, 1};
+            for (unsigned int first = 0; first < count; first += 5)
+            {
+                unsigned int low[5];
+                unsigned int packed = 0;
+                unsigned int shift = 0;
+                for (unsigned int i = 0; i < 5; ++i)
+                {
+                    low[i] = readBits(block, position, bits, limit);
+                    position += bits;
+                    packed |= readBits(block, position, tritBits[i], limit) << shift;
+                    position += tritBits[i];
+                    shift += tritBits[i];
+                }
+
+                unsigned int trits[5];
+                unsigned int c;
+                if (((packed >> 2) & 7) == 7)
+                {
+                    c = (((packed >> 5) & 7) << 2) | (packed & 3);
+                    trits[4] = 2;
+                    trits[3] = 2;
+                }
+                else
+                {
+                    c = packed & 0x1F;
+                    if (((packed >> 5) & 3) == 3)
+                    {
+                        trits[4] = 2;
+                        trits[3] = (packed >> 7) & 1;
+                    }
+                    else
+                    {
+                        trits[4] = (packed >> 7) & 1;
+                        trits[3] = (packed >> 5) & 3;
+                    }
+                }
+
+                if ((c & 3) == 3)
+                {
+                    trits[2] = 2;
+                    trits[1] = (c >> 4) & 1;
+                    trits[0] = (((c >> 3) & 1) << 1) | ((c >> 2) & 1 & ~(c >> 3));
+                }
+                else if (((c >> 2) & 3) == 3)
+                {
+                    trits[2] = 2;
+                    trits[1] = 2;
+                    trits[0] = c & 3;
+                }
+                else
+                {
+                    trits[2] = (c >> 4) & 1;
+                    trits[1] = (c >> 2) & 3;
+                    trits[0] = (((c >> 1) & 1) << 1) | (c & 1 & ~(c >> 1));
+                }
+
+                for (unsigned int i = 0; (i < 5) && (first + i < count); ++i)
+                    values[first + i] = (trits[i] << bits) | low[i];
+            }
+        }
+        else if (ise.Quints)
+        {
+            // Groups of 3 values, the 7 bits encoding their quints are interleaved with their bits
+            static const unsigned int quintBits[3] = {3, 2, 2};
+            for (unsigned int first = 0; first < count; first += 3)
+            {
+                unsigned int low[3];
+                unsigned int packed = 0;
+                unsigned int shift = 0;
+                for (unsigned int i = 0; i < 3; ++i)
+                {
+                    low[i] = readBits(block, position, bits, limit);
+                    position += bits;
+                    packed |= readBits(block, position, quintBits[i], limit) << shift;
+                    position += quintBits[i];
+                    shift += quintBits[i];
+                }
+
+                unsigned int quints[3];
+                if ((((packed >> 1) & 3) == 3) && (((packed >> 5) & 3) == 0))
+                {
+                    quints[2] = ((packed & 1) << 2) | ((((packed >> 4) & 1) & ~packed & 1) << 1) | (((packed >> 3) & 1) & ~packed & 1);
+                    quints[1] = 4;
+                    quints[0] = 4;
+                }
+                else
+                {
+                    unsigned int c;
+                    if (((packed >> 1) & 3) == 3)
+                    {
+                        quints[2] = 4;
+                        c = (((packed >> 3) & 3) << 3) | ((~packed >> 4) & 6) | (packed & 1);
+                    }
+                    else
+                    {
+                        quints[2] = (packed >> 5) & 3;
+                        c = packed & 0x1F;
+                    }
+
+                    if ((c & 7) == 5)
+                    {
+                        quints[1] = 4;
+                        quints[0] = (c >> 3) & 3;
+                    }
+                    else
+                    {
+                        quints[1] = (c >> 3) & 3;
+                        quints[0] = c & 7;
+                    }
+                }
+
+                for (unsigned int i = 0; (i < 3) && (first + i < count); ++i)
+                    values[first + i] = (quints[i] << bits) | low[i];
+            }
+        }
+        else
+        {
+            for (unsigned int i = 0; i < count; ++i, position += bits)
+                values[i] = readBits(block, position, bits, limit);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode the dimensions of the weight grid and the range of
+    // the weights from the block mode
+    ////////////////////////////////////////////////////////////
+    bool decodeBlockMode(unsigned int mode, unsigned int& width, unsigned int& height, unsigned int& range, bool& dualPlane)
+    {
+        unsigned int a = (mode >> 5) & 3;
+        unsigned int precision = (mode >> 9) & 1;
+        unsigned int dual = (mode >> 10) & 1;
+        unsigned int baseRange = (mode >> 4) & 1;
+
+        if (mode & 3)
+        {
+            baseRange |= (mode & 3) << 1;
+            unsigned int b = (mode >> 7) & 3;
+            switch ((mode >> 2) & 3)
+            {
+                case 0: width = b + 4; height = a + 2; break;
+                case 1: width = b + 8; height = a + 2; break;
+                case 2: width = a + 2; height = b + 8; break;
+                default:
+                    b &= 1;
+                    if (mode & 0x100)
+                    {
+                        width = b + 2;
+                        height = a + 2;
+                    }
+                    else
+                    {
+                        width = a + 2;
+                        height = b + 6;
+                    }
+                    break;
+            }
+        }
+        else
+        {
+            baseRange |= ((mode >> 2) & 3) << 1;
+            if (((mode >> 2) & 3) == 0)
+                return false;
+
+            unsigned int b = (mode >> 9) & 3;
+            switch ((mode >> 7) & 3)
+            {
+                case 0: width = 12; height = a + 2; break;
+                case 1: width = a + 2; height = 12; break;
+                case 2: width = a + 6; height = b + 6; dual = 0; precision = 0; break;
+                default:
+                    if (a == 0)
+                    {
+                        width = 6;
+                        height = 10;
+                    }
+                    else if (a == 1)
+                    {
+                        width = 10;
+                        height = 6;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    break;
+            }
+        }
+
+        range = baseRange - 2 + 6 * precision;
+        dualPlane = dual != 0;
+
+        unsigned int count = width * height * (dualPlane ? 2 : 1);
+        if (count > maxWeights)
+            return false;
+
+        unsigned int bits = getIseBitCount(count, range);
+        return (bits >= minWeightBits) && (bits <= maxWeightBits);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Transfer the most significant bit of b to a, for the
+    // base + offset endpoint modes
+    ////////////////////////////////////////////////////////////
+    void transferBit(int& a, int& b)
+    {
+        b = (b >> 1) | (a & 0x80);
+        a = (a >> 1) & 0x3F;
+        if (a & 0x20)
+            a -= 0x40;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setColor(int* color, int r, int g, int b, int a)
+    {
+        color[0] = std::min(std::max(r, 0), 255);
+        color[1] = std::min(std::max(g, 0), 255);
+        color[2] = std::min(std::max(b, 0), 255);
+        color[3] = std::min(std::max(a, 0), 255);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Set a color with blue contraction, which is applied before clamping
+    ////////////////////////////////////////////////////////////
+    void setContractedColor(int* color, int r, int g, int b, int a)
+    {
+        setColor(color, (r + b) >> 1, (g + b) >> 1, b, a);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode the endpoints of a partition; returns false for
+    // HDR modes, which are errors in LDR textures
+    ////////////////////////////////////////////////////////////
+    bool decodeEndpoints(unsigned int mode, int* v, int* endpoint0, int* endpoint1)
+    {
+        switch (mode)
+        {
+            // Luminance, direct
+            case 0:
+                setColor(endpoint0, v[0], v[0], v[0], 255);
+                setColor(endpoint1, v[1], v[1], v[1], 255);
+                return true;
+
+            // Luminance, base + offset
+            case 1:
+            {
+                int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+                int l1 = std::min(l0 + (v[1] & 0x3F), 255);
+                setColor(endpoint0, l0, l0, l0, 255);
+                setColor(endpoint1, l1, l1, l1, 255);
+                return true;
+            }
+
+            // Luminance and alpha, direct
+            case 4:
+                setColor(endpoint0, v[0], v[0], v[0], v[2]);
+                setColor(endpoint1, v[1], v[1], v[1], v[3]);
+                return true;
+
+            // Luminance and alpha, base + offset
+            case 5:
+                transferBit(v[1], v[0]);
+                transferBit(v[3], v[2]);
+                setColor(endpoint0, v[0], v[0], v[0], v[2]);
+                setColor(endpoint1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+                return true;
+
+            // RGB, base + scale
+            case 6:
+                setColor(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, 255);
+                setColor(endpoint1, v[0], v[1], v[2], 255);
+                return true;
+
+            // RGB, direct
+            case 8:
+                if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+                {
+                    setColor(endpoint0, v[0], v[2], v[4], 255);
+                    setColor(endpoint1, v[1], v[3], v[5], 255);
+                }
+                else
+                {
+                    setContractedColor(endpoint0, v[1], v[3], v[5], 255);
+                    setContractedColor(endpoint1, v[0], v[2], v[4], 255);
+                }
+                return true;
+
+            // RGB, base + offset
+            case 9:
+                transferBit(v[1], v[0]);
+                transferBit(v[3], v[2]);
+                transferBit(v[5], v[4]);
+                if (v[1] + v[3] + v[5] >= 0)
+                {
+                    setColor(endpoint0, v[0], v[2], v[4], 255);
+                    setColor(endpoint1, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+                }
+                else
+                {
+                    setContractedColor(endpoint0, v[0] + v[1], v[2] + v[3], v[4] + v[5], 255);
+                    setContractedColor(endpoint1, v[0], v[2], v[4], 255);
+                }
+                return true;
+
+            // RGB, base + scale, plus two alphas
+            case 10:
+                setColor(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, v[4]);
+                setColor(endpoint1, v[0], v[1], v[2], v[5]);
+                return true;
+
+            // RGBA, direct
+            case 12:
+                if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+                {
+                    setColor(endpoint0, v[0], v[2], v[4], v[6]);
+                    setColor(endpoint1, v[1], v[3], v[5], v[7]);
+                }
+                else
+                {
+                    setContractedColor(endpoint0, v[1], v[3], v[5], v[7]);
+                    setContractedColor(endpoint1, v[0], v[2], v[4], v[6]);
+                }
+                return true;
+
+            // RGBA, base + offset
+            case 13:
+                transferBit(v[1], v[0]);
+                transferBit(v[3], v[2]);
+                transferBit(v[5], v[4]);
+                transferBit(v[7], v[6]);
+                if (v[1] + v[3] + v[5] >= 0)
+                {
+                    setColor(endpoint0, v[0], v[2], v[4], v[6]);
+                    setColor(endpoint1, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+                }
+                else
+                {
+                    setContractedColor(endpoint0, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+                    setContractedColor(endpoint1, v[0], v[2], v[4], v[6]);
+                }
+                return true;
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Find the partition of a texel with the hash function of the specification
+    ////////////////////////////////////////////////////////////
+    unsigned int selectPartition(unsigned int seed, unsigned int x, unsigned int y, unsigned int count, bool smallBlock)
+    {
+        if (smallBlock)
+        {
+            x <<= 1;
+            y <<= 1;
+        }
+
+        seed += (count - 1) * 1024;
+
+        sfUint32 random = seed;
+        random ^= random >> 15;
+        random *= 0xEEDE0891;
+        random ^= random >> 5;
+        random += random << 16;
+        random ^= random >> 7;
+        random ^= random >> 3;
+        random ^= random << 6;
+        random ^= random >> 17;
+
+        unsigned int seeds[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            seeds[i] = (random >> (i * 4)) & 0xF;
+            seeds[i] *= seeds[i];
+        }
+
+        unsigned int shift1, shift2;
+        if (seed & 1)
+        {
+            shift1 = (seed & 2) ? 4 : 5;
+            shift2 = (count == 3) ? 6 : 5;
+        }
+        else
+        {
+            shift1 = (count == 3) ? 6 : 5;
+            shift2 = (seed & 2) ? 4 : 5;
+        }
+
+        for (int i = 0; i < 8; ++i)
+            seeds[i] >>= (i & 1) ? shift2 : shift1;
+
+        // The z coordinate is always 0 for 2D textures
+        unsigned int a = (seeds[0] * x + seeds[1] * y + (random >> 14)) & 0x3F;
+        unsigned int b = (seeds[2] * x + seeds[3] * y + (random >> 10)) & 0x3F;
+        unsigned int c = (count >= 3) ? ((seeds[4] * x + seeds[5] * y + (random >> 6)) & 0x3F) : 0;
+        unsigned int d = (count >= 4) ? ((seeds[6] * x + seeds[7] * y + (random >> 2)) & 0x3F) : 0;
+
+        if ((a >= b) && (a >= c) && (a >= d))
+            return 0;
+        else if ((b >= c) && (b >= d))
+            return 1;
+        else if (c >= d)
+            return 2;
+        else
+            return 3;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void fillBlock(sfUint8* pixels, unsigned int count, sfUint8 r, sfUint8 g, sfUint8 b, sfUint8 a)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            pixels[i * 4 + 0] = r;
+            pixels[i * 4 + 1] = g;
+            pixels[i * 4 + 2] = b;
+            pixels[i * 4 + 3] = a;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool decodeAstc(const sfUint8* block, unsigned int blockWidth, unsigned int blockHeight, sfUint8* pixels)
+    {
+        const Tables& tables = getTables();
+        unsigned int texelCount = blockWidth * blockHeight;
+        unsigned int blockMode = readBits(block, 0, 11);
+
+        // Void extent blocks have a single color, stored as 16 bits channels
+        if ((blockMode & 0x1FF) == 0x1FC)
+        {
+            if ((blockMode & 0x200) || (readBits(block, 10, 2) != 3))
+                return false;
+
+            unsigned int s0 = readBits(block, 12, 13);
+            unsigned int s1 = readBits(block, 25, 13);
+            unsigned int t0 = readBits(block, 38, 13);
+            unsigned int t1 = readBits(block, 51, 13);
+            bool allOnes = (s0 == 0x1FFF) && (s1 == 0x1FFF) && (t0 == 0x1FFF) && (t1 == 0x1FFF);
+            if (!allOnes && ((s0 >= s1) || (t0 >= t1)))
+                return false;
+
+            fillBlock(pixels, texelCount, block[9], block[11], block[13], block[15]);
+            return true;
+        }
+
+        unsigned int gridWidth, gridHeight, weightRange;
+        bool dualPlane;
+        if (!decodeBlockMode(blockMode, gridWidth, gridHeight, weightRange, dualPlane) || (gridWidth > blockWidth) || (gridHeight > blockHeight))
+            return false;
+
+        unsigned int partitionCount = readBits(block, 11, 2) + 1;
+        if (dualPlane && (partitionCount == 4))
+            return false;
+
+        unsigned int planeCount = dualPlane ? 2 : 1;
+        unsigned int weightCount = gridWidth * gridHeight * planeCount;
+        unsigned int belowWeights = 128 - getIseBitCount(weightCount, weightRange);
+
+        // Color endpoint modes; when partitions have different modes, extra bits are stored below the weights
+        unsigned int modes[4];
+        unsigned int partitionIndex = 0;
+        unsigned int colorStart;
+        if (partitionCount == 1)
+        {
+            modes[0] = readBits(block, 13, 4);
+            colorStart = 17;
+        }
+        else
+        {
+            partitionIndex = readBits(block, 13, 10);
+            colorStart = 29;
+
+            unsigned int encoded = readBits(block, 23, 6);
+            if ((encoded & 3) == 0)
+            {
+                for (unsigned int i = 0; i < partitionCount; ++i)
+                    modes[i] = encoded >> 2;
+            }
+            else
+            {
+                unsigned int extraBits = 3 * partitionCount - 4;
+                belowWeights -= extraBits;
+                encoded |= readBits(block, belowWeights, extraBits) << 6;
+
+                unsigned int baseClass = (encoded & 3) - 1;
+                encoded >>= 2;
+                for (unsigned int i = 0; i < partitionCount; ++i)
+                    modes[i] = ((baseClass + ((encoded >> i) & 1)) << 2) | ((encoded >> (partitionCount + i * 2)) & 3);
+            }
+        }
+
+        unsigned int planeComponent = 4;
+        if (dualPlane)
+        {
+            belowWeights -= 2;
+            planeComponent = readBits(block, belowWeights, 2);
+        }
+
+        // Use the largest color range that fits in the remaining bits
+        unsigned int valueCount = 0;
+        for (unsigned int i = 0; i < partitionCount; ++i)
+            valueCount += ((modes[i] >> 2) + 1) * 2;
+
+        if ((valueCount > maxColorValues) || (belowWeights <= colorStart))
+            return false;
+
+        unsigned int colorBits = belowWeights - colorStart;
+        unsigned int colorRange = iseRangeCount;
+        while ((colorRange > 0) && (getIseBitCount(valueCount, colorRange - 1) > colorBits))
+            --colorRange;
+        if (colorRange <= minColorRange)
+            return false;
+        --colorRange;
+
+        unsigned int values[maxColorValues];
+        decodeIse(block, colorStart, valueCount, colorRange, values);
+
+        int endpoints[4][2][4];
+        for (unsigned int i = 0, first = 0; i < partitionCount; ++i)
+        {
+            int colors[8];
+            unsigned int count = ((modes[i] >> 2) + 1) * 2;
+            for (unsigned int j = 0; j < count; ++j)
+                colors[j] = tables.Colors[colorRange][values[first + j]];
+
+            if (!decodeEndpoints(modes[i], colors, endpoints[i][0], endpoints[i][1]))
+                return false;
+
+            first += count;
+        }
+
+        // Weights are stored from the most significant bit of the block, in reverse order
+        sfUint8 reversed[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            sfUint8 byte = block[15 - i];
+            byte = static_cast<sfUint8>(((byte & 0xF0) >> 4) | ((byte & 0x0F) << 4));
+            byte = static_cast<sfUint8>(((byte & 0xCC) >> 2) | ((byte & 0x33) << 2));
+            byte = static_cast<sfUint8>(((byte & 0xAA) >> 1) | ((byte & 0x55) << 1));
+            reversed[i] = byte;
+        }
+
+        unsigned int weightValues[maxWeights];
+        decodeIse(reversed, 0, weightCount, weightRange, weightValues);
+
+        // The grid is padded so that the interpolation can read past its last row and column
+        unsigned int gridWeights[2][maxWeights + 16];
+        std::memset(gridWeights, 0, sizeof(gridWeights));
+        for (unsigned int i = 0; i < weightCount; ++i)
+            gridWeights[i % planeCount][i / planeCount] = tables.Weights[weightRange][weightValues[i]];
+
+        unsigned int scaleX = (1024 + blockWidth / 2) / (blockWidth - 1);
+        unsigned int scaleY = (1024 + blockHeight / 2) / (blockHeight - 1);
+        bool smallBlock = texelCount < 31;
+
+        for (unsigned int y = 0; y < blockHeight; ++y)
+        {
+            for (unsigned int x = 0; x < blockWidth; ++x)
+            {
+                // Bilinear interpolation of the weight grid
+                unsigned int gridX = (scaleX * x * (gridWidth - 1) + 32) >> 6;
+                unsigned int gridY = (scaleY * y * (gridHeight - 1) + 32) >> 6;
+                unsigned int fractionX = gridX & 0xF;
+                unsigned int fractionY = gridY & 0xF;
+                unsigned int index = (gridX >> 4) + (gridY >> 4) * gridWidth;
+                unsigned int factor11 = (fractionX * fractionY + 8) >> 4;
+                unsigned int factor10 = fractionY - factor11;
+                unsigned int factor01 = fractionX - factor11;
+                unsigned int factor00 = 16 - fractionX - fractionY + factor11;
+
+                unsigned int weights[2];
+                for (unsigned int p = 0; p < planeCount; ++p)
+                {
+                    const unsigned int* grid = gridWeights[p];
+                    weights[p] = (grid[index] * factor00 + grid[index + 1] * factor01 +
+                                  grid[index + gridWidth] * factor10 + grid[index + gridWidth + 1] * factor11 + 8) >> 4;
+                }
+
+                unsigned int partition = (partitionCount > 1) ? selectPartition(partitionIndex, x, y, partitionCount, smallBlock) : 0;
+                const int* endpoint0 = endpoints[partition][0];
+                const int* endpoint1 = endpoints[partition][1];
+                sfUint8* pixel = pixels + (y * blockWidth + x) * 4;
+                for (unsigned int c = 0; c < 4; ++c)
+                {
+                    // Endpoints are expanded to 16 bits before the interpolation
+                    unsigned int weight = (c == planeComponent) ? weights[1] : weights[0];
+                    unsigned int value = (static_cast<unsigned int>(endpoint0[c]) * 257 * (64 - weight) + static_cast<unsigned int>(endpoint1[c]) * 257 * weight + 32) >> 6;
+                    pixel[c] = static_cast<sfUint8>(value >> 8);
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    void decodeAstcBlock(const sfUint8* block, unsigned int blockWidth, unsigned int blockHeight, sfUint8* pixels)
+    {
+        if (!decodeAstc(block, blockWidth, blockHeight, pixels))
+            fillBlock(pixels, blockWidth * blockHeight, 255, 0, 255, 255);
+    }
+}
@@ -0,0 +1,722 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/BlockDecoder.hpp>
+#include <SFML/Graphics/ImageCodec.hpp>
+#include <SFML/System/TaskPool.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+    // Levels with fewer rows of blocks are decoded on the calling thread
+    const std::size_t minParallelRows = 32;
+
+    // Attributes of the 8 modes of BC7
+    struct Bc7Mode
+    {
+        unsigned int Subsets;        ///< Number of subsets
+        unsigned int PartitionBits;  ///< Number of bits of the partition index
+        unsigned int RotationBits;   ///< Number of bits of the channel rotation
+        unsigned int SelectionBits;  ///< Number of bits of the index selection
+        unsigned int ColorBits;      ///< Number of bits of the color components of the endpoints
+        unsigned int AlphaBits;      ///< Number of bits of the alpha component of the endpoints
+        unsigned int EndpointPBits;  ///< Whether each endpoint has a P-bit
+        unsigned int SharedPBits;    ///< Whether each subset has a P-bit shared by its endpoints
+        unsigned int IndexBits;      ///< Number of bits of the primary indices
+        unsigned int IndexBits2;     ///< Number of bits of the secondary indices
+    };
+
+    const Bc7Mode bc7Modes[8] =
+    {
+        {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+        {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+        {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+        {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+        {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+        {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+        {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+        {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}
+    };
+
+    // Subset of each pixel for the partitions with 2 subsets, one bit per pixel
+    const sfUint16 bc7Partitions2[64] =
+    {
+        0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+        0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+        0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+        0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+        0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+        0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+        0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+        0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+    };
+
+    // Subset of each pixel for the partitions with 3 subsets, two bits per pixel
+    const sfUint32 bc7Partitions3[64] =
+    {
+        0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+        0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+        0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+        0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+        0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+        0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+        0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+        0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254
+    };
+
+    // Anchor pixel of the second subset, for partitions with 2 subsets
+    const sfUint8 bc7Anchors2[64] =
+    {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+        15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+         6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+    };
+
+    // Anchor pixels of the second and third subsets, for partitions with 3 subsets
+    const sfUint8 bc7Anchors3[2][64] =
+    {
+        {
+             3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+             3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+             8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+             3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3
+        },
+        {
+            15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+            15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+            15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+            15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8
+        }
+    };
+
+    // Interpolation weights of BC7, for 2, 3 and 4 bits indices
+    const sfUint8 bc7Weights2[4]  = {0, 21, 43, 64};
+    const sfUint8 bc7Weights3[8]  = {0, 9, 18, 27, 37, 46, 55, 64};
+    const sfUint8 bc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    // Modifiers of ETC1 and ETC2 individual and differential modes
+    const int etcModifiers[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+    // Distances of ETC2 T and H modes
+    const int etcDistances[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+    // Modifiers of EAC alpha
+    const int eacModifiers[16][8] =
+    {
+        {-3, -6, -9, -15, 2, 5, 8, 14}, {-3, -7, -10, -13, 2, 6, 9, 12}, {-2, -5, -8, -13, 1, 4, 7, 12}, {-2, -4, -6, -13, 1, 3, 5, 12},
+        {-3, -6, -8, -12, 2, 5, 7, 11}, {-3, -7, -9, -11, 2, 6, 8, 10}, {-4, -7, -8, -11, 3, 6, 7, 10}, {-3, -5, -8, -11, 2, 4, 7, 10},
+        {-2, -6, -8, -10, 1, 5, 7, 9},  {-2, -5, -8, -10, 1, 4, 7, 9},  {-2, -4, -8, -10, 1, 3, 7, 9},  {-2, -5, -7, -10, 1, 4, 6, 9},
+        {-3, -4, -7, -10, 2, 3, 6, 9},  {-1, -2, -3, -10, 0, 1, 2, 9},  {-4, -6, -8, -9, 3, 5, 7, 8},   {-3, -5, -7, -9, 2, 4, 6, 8}
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint8 clampColor(int value)
+    {
+        return static_cast<sfUint8>(std::min(std::max(value, 0), 255));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint64 readLittleEndian64(const sfUint8* data)
+    {
+        sfUint64 value = 0;
+        for (int i = 7; i >= 0; --i)
+            value = (value << 8) | data[i];
+
+        return value;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint64 readBigEndian64(const sfUint8* data)
+    {
+        sfUint64 value = 0;
+        for (int i = 0; i < 8; ++i)
+            value = (value << 8) | data[i];
+
+        return value;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Read the bits of a 128 bits block, from the least significant one
+    ////////////////////////////////////////////////////////////
+    class BitReader
+    {
+    public:
+
+        explicit BitReader(const sfUint8* block) :
+        myLow(readLittleEndian64(block)),
+        myHigh(readLittleEndian64(block + 8)),
+        myPosition(0)
+        {
+        }
+
+        unsigned int read(unsigned int count)
+        {
+            sfUint64 bits;
+            if (myPosition >= 64)
+                bits = myHigh >> (myPosition - 64);
+            else if (myPosition > 0)
+                bits = (myLow >> myPosition) | (myHigh << (64 - myPosition));
+            else
+                bits = myLow;
+
+            myPosition += count;
+            return static_cast<unsigned int>(bits & ((1u << count) - 1));
+        }
+
+    private:
+
+        sfUint64     myLow;
+        sfUint64     myHigh;
+        unsigned int myPosition;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode the colors of a BC1 block, or of the color part of
+    // a BC2 or BC3 block (which always use 4 colors)
+    ////////////////////////////////////////////////////////////
+    void decodeBc1(const sfUint8* block, sfUint8* pixels, bool alwaysFourColors)
+    {
+        unsigned int color0 = block[0] | (block[1] << 8);
+        unsigned int color1 = block[2] | (block[3] << 8);
+
+        sfUint8 palette[4][4];
+        for (int i = 0; i < 2; ++i)
+        {
+            unsigned int color = i ? color1 : color0;
+            unsigned int r = color >> 11;
+            unsigned int g = (color >> 5) & 0x3F;
+            unsigned int b = color & 0x1F;
+            palette[i][0] = static_cast<sfUint8>((r << 3) | (r >> 2));
+            palette[i][1] = static_cast<sfUint8>((g << 2) | (g >> 4));
+            palette[i][2] = static_cast<sfUint8>((b << 3) | (b >> 2));
+            palette[i][3] = 255;
+        }
+
+        for (int c = 0; c < 3; ++c)
+        {
+            if (alwaysFourColors || (color0 > color1))
+            {
+                palette[2][c] = static_cast<sfUint8>((2 * palette[0][c] + palette[1][c]) / 3);
+                palette[3][c] = static_cast<sfUint8>((palette[0][c] + 2 * palette[1][c]) / 3);
+            }
+            else
+            {
+                palette[2][c] = static_cast<sfUint8>((palette[0][c] + palette[1][c]) / 2);
+                palette[3][c] = 0;
+            }
+        }
+        palette[2][3] = 255;
+        palette[3][3] = (alwaysFourColors || (color0 > color1)) ? 255 : 0;
+
+        sfUint32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<sfUint32>(block[7]) << 24);
+        for (int i = 0; i < 16; ++i)
+            std::memcpy(pixels + i * 4, palette[(indices >> (i * 2)) & 3], 4);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode an 8 bytes channel block of BC3, BC4 or BC5 to a
+    // component of the pixels
+    ////////////////////////////////////////////////////////////
+    void decodeChannel(const sfUint8* block, sfUint8* pixels, int component)
+    {
+        unsigned int value0 = block[0];
+        unsigned int value1 = block[1];
+
+        sfUint8 palette[8];
+        palette[0] = static_cast<sfUint8>(value0);
+        palette[1] = static_cast<sfUint8>(value1);
+        if (value0 > value1)
+        {
+            for (unsigned int i = 2; i < 8; ++i)
+                palette[i] = static_cast<sfUint8>(((8 - i) * value0 + (i - 1) * value1 + 3) / 7);
+        }
+        else
+        {
+            for (unsigned int i = 2; i < 6; ++i)
+                palette[i] = static_cast<sfUint8>(((6 - i) * value0 + (i - 1) * value1 + 2) / 5);
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        sfUint64 indices = readLittleEndian64(block) >> 16;
+        for (int i = 0; i < 16; ++i)
+            pixels[i * 4 + component] = palette[(indices >> (i * 3)) & 7];
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeBc2(const sfUint8* block, sfUint8* pixels)
+    {
+        decodeBc1(block + 8, pixels, true);
+
+        sfUint64 alpha = readLittleEndian64(block);
+        for (int i = 0; i < 16; ++i)
+            pixels[i * 4 + 3] = static_cast<sfUint8>(((alpha >> (i * 4)) & 0xF) * 17);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeBc3(const sfUint8* block, sfUint8* pixels)
+    {
+        decodeBc1(block + 8, pixels, true);
+        decodeChannel(block, pixels, 3);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeBc4(const sfUint8* block, sfUint8* pixels)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            pixels[i * 4 + 1] = 0;
+            pixels[i * 4 + 2] = 0;
+            pixels[i * 4 + 3] = 255;
+        }
+
+        decodeChannel(block, pixels, 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeBc5(const sfUint8* block, sfUint8* pixels)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            pixels[i * 4 + 2] = 0;
+            pixels[i * 4 + 3] = 255;
+        }
+
+        decodeChannel(block, pixels, 0);
+        decodeChannel(block + 8, pixels, 1);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint8 interpolateBc7(unsigned int value0, unsigned int value1, unsigned int index, unsigned int bits)
+    {
+        unsigned int weight = (bits == 2) ? bc7Weights2[index] : ((bits == 3) ? bc7Weights3[index] : bc7Weights4[index]);
+        return static_cast<sfUint8>(((64 - weight) * value0 + weight * value1 + 32) >> 6);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeBc7(const sfUint8* block, sfUint8* pixels)
+    {
+        // The mode is given by the position of the first bit set
+        unsigned int index = 0;
+        while ((index < 8) && !(block[0] & (1 << index)))
+            ++index;
+
+        // Reserved mode
+        if (index == 8)
+        {
+            std::memset(pixels, 0, 16 * 4);
+            return;
+        }
+
+        const Bc7Mode& mode = bc7Modes[index];
+        BitReader reader(block);
+        reader.read(index + 1);
+
+        unsigned int partition = reader.read(mode.PartitionBits);
+        unsigned int rotation = reader.read(mode.RotationBits);
+        unsigned int selection = reader.read(mode.SelectionBits);
+
+        // Endpoints are stored channel by channel
+        unsigned int endpoints[3][2][4];
+        unsigned int bits[4] = {mode.ColorBits, mode.ColorBits, mode.ColorBits, mode.AlphaBits};
+        unsigned int channels = mode.AlphaBits ? 4 : 3;
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int s = 0; s < mode.Subsets; ++s)
+            {
+                endpoints[s][0][c] = reader.read(bits[c]);
+                endpoints[s][1][c] = reader.read(bits[c]);
+            }
+        }
+
+        // P-bits add a least significant bit to every channel
+        if (mode.EndpointPBits || mode.SharedPBits)
+        {
+            for (unsigned int s = 0; s < mode.Subsets; ++s)
+            {
+                unsigned int shared = mode.SharedPBits ? reader.read(1) : 0;
+                for (unsigned int e = 0; e < 2; ++e)
+                {
+                    unsigned int pBit = mode.SharedPBits ? shared : reader.read(1);
+                    for (unsigned int c = 0; c < channels; ++c)
+                        endpoints[s][e][c] = (endpoints[s][e][c] << 1) | pBit;
+                }
+            }
+
+            for (unsigned int c = 0; c < channels; ++c)
+                ++bits[c];
+        }
+
+        // Expand the endpoints to 8 bits
+        for (unsigned int s = 0; s < mode.Subsets; ++s)
+        {
+            for (unsigned int e = 0; e < 2; ++e)
+            {
+                for (unsigned int c = 0; c < channels; ++c)
+                {
+                    unsigned int value = endpoints[s][e][c] << (8 - bits[c]);
+                    endpoints[s][e][c] = value | (value >> bits[c]);
+                }
+
+                if (channels == 3)
+                    endpoints[s][e][3] = 255;
+            }
+        }
+
+        // Anchor pixels have an implicit most significant bit of 0 in their indices
+        unsigned int anchors[3] = {0, 0, 0};
+        if (mode.Subsets == 2)
+        {
+            anchors[1] = bc7Anchors2[partition];
+        }
+        else if (mode.Subsets == 3)
+        {
+            anchors[1] = bc7Anchors3[0][partition];
+            anchors[2] = bc7Anchors3[1][partition];
+        }
+
+        unsigned int indices[2][16];
+        for (unsigned int i = 0; i < 16; ++i)
+        {
+            bool anchor = (i == anchors[0]) || (i == anchors[1]) || (i == anchors[2]);
+            indices[0][i] = reader.read(mode.IndexBits - (anchor ? 1 : 0));
+        }
+        if (mode.IndexBits2)
+        {
+            for (unsigned int i = 0; i < 16; ++i)
+                indices[1][i] = reader.read(mode.IndexBits2 - (i == 0 ? 1 : 0));
+        }
+
+        // The index selection swaps the indices used for colors and alpha
+        unsigned int colorSet = (mode.IndexBits2 && selection) ? 1 : 0;
+        unsigned int alphaSet = (mode.IndexBits2 && !selection) ? 1 : 0;
+        unsigned int colorBits = colorSet ? mode.IndexBits2 : mode.IndexBits;
+        unsigned int alphaBits = alphaSet ? mode.IndexBits2 : mode.IndexBits;
+
+        for (unsigned int i = 0; i < 16; ++i)
+        {
+            unsigned int subset = 0;
+            if (mode.Subsets == 2)
+                subset = (bc7Partitions2[partition] >> i) & 1;
+            else if (mode.Subsets == 3)
+                subset = (bc7Partitions3[partition] >> (i * 2)) & 3;
+
+            const unsigned int* endpoint0 = endpoints[subset][0];
+            const unsigned int* endpoint1 = endpoints[subset][1];
+            sfUint8* pixel = pixels + i * 4;
+            for (unsigned int c = 0; c < 3; ++c)
+                pixel[c] = interpolateBc7(endpoint0[c], endpoint1[c], indices[colorSet][i], colorBits);
+            pixel[3] = interpolateBc7(endpoint0[3], endpoint1[3], indices[alphaSet][i], alphaBits);
+
+            if (rotation > 0)
+                std::swap(pixel[3], pixel[rotation - 1]);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Decode an ETC2 RGB block (ETC1 blocks are valid ETC2 blocks)
+    ////////////////////////////////////////////////////////////
+    void decodeEtc2(const sfUint8* block, sfUint8* pixels)
+    {
+        sfUint64 bits = readBigEndian64(block);
+        sfUint32 high = static_cast<sfUint32>(bits >> 32);
+        sfUint32 low = static_cast<sfUint32>(bits);
+
+        // Pixel indices are stored column by column
+        int indices[16];
+        for (int i = 0; i < 16; ++i)
+            indices[(i & 3) * 4 + (i >> 2)] = static_cast<int>(((low >> i) & 1) | (((low >> (i + 16)) & 1) << 1));
+
+        int base[2][3];
+        bool differential = (high & 2) != 0;
+        bool flip = (high & 1) != 0;
+
+        if (differential)
+        {
+            int red = (high >> 27) & 0x1F;
+            int green = (high >> 19) & 0x1F;
+            int blue = (high >> 11) & 0x1F;
+            int deltaRed = static_cast<int>((high >> 24) & 7) - (((high >> 24) & 4) ? 8 : 0);
+            int deltaGreen = static_cast<int>((high >> 16) & 7) - (((high >> 16) & 4) ? 8 : 0);
+            int deltaBlue = static_cast<int>((high >> 8) & 7) - (((high >> 8) & 4) ? 8 : 0);
+
+            // Overflows of the differential colors select the additional ETC2 modes
+            if ((red + deltaRed < 0) || (red + deltaRed > 31))
+            {
+                // T mode
+                int color[2][3] =
+                {
+                    {static_cast<int>(((high >> 25) & 0xC) | ((high >> 24) & 3)), static_cast<int>((high >> 20) & 0xF), static_cast<int>((high >> 16) & 0xF)},
+                    {static_cast<int>((high >> 12) & 0xF), static_cast<int>((high >> 8) & 0xF), static_cast<int>((high >> 4) & 0xF)}
+                };
+                int distance = etcDistances[((high >> 1) & 6) | (high & 1)];
+
+                sfUint8 palette[4][4];
+                for (int c = 0; c < 3; ++c)
+                {
+                    palette[0][c] = static_cast<sfUint8>(color[0][c] * 17);
+                    palette[1][c] = clampColor(color[1][c] * 17 + distance);
+                    palette[2][c] = static_cast<sfUint8>(color[1][c] * 17);
+                    palette[3][c] = clampColor(color[1][c] * 17 - distance);
+                }
+
+                for (int i = 0; i < 16; ++i)
+                {
+                    std::memcpy(pixels + i * 4, palette[indices[i]], 3);
+                    pixels[i * 4 + 3] = 255;
+                }
+                return;
+            }
+            else if ((green + deltaGreen < 0) || (green + deltaGreen > 31))
+            {
+                // H mode
+                int color[2][3] =
+                {
+                    {static_cast<int>((high >> 27) & 0xF), static_cast<int>(((high >> 23) & 0xE) | ((high >> 20) & 1)), static_cast<int>(((high >> 16) & 8) | ((high >> 15) & 7))},
+                    {static_cast<int>((high >> 11) & 0xF), static_cast<int>((high >> 7) & 0xF), static_cast<int>((high >> 3) & 0xF)}
+                };
+                int value0 = (color[0][0] << 8) | (color[0][1] << 4) | color[0][2];
+                int value1 = (color[1][0] << 8) | (color[1][1] << 4) | color[1][2];
+                int distance = etcDistances[(high & 4) | ((high & 1) << 1) | (value0 >= value1 ? 1 : 0)];
+
+                sfUint8 palette[4][4];
+                for (int c = 0; c < 3; ++c)
+                {
+                    palette[0][c] = clampColor(color[0][c] * 17 + distance);
+                    palette[1][c] = clampColor(color[0][c] * 17 - distance);
+                    palette[2][c] = clampColor(color[1][c] * 17 + distance);
+                    palette[3][c] = clampColor(color[1][c] * 17 - distance);
+                }
+
+                for (int i = 0; i < 16; ++i)
+                {
+                    std::memcpy(pixels + i * 4, palette[indices[i]], 3);
+                    pixels[i * 4 + 3] = 255;
+                }
+                return;
+            }
+            else if ((blue + deltaBlue < 0) || (blue + deltaBlue > 31))
+            {
+                // Planar mode
+                int origin[3] =
+                {
+                    static_cast<int>((high >> 25) & 0x3F),
+                    static_cast<int>(((high >> 18) & 0x40) | ((high >> 17) & 0x3F)),
+                    static_cast<int>(((high >> 11) & 0x20) | ((high >> 8) & 0x18) | ((high >> 7) & 7))
+                };
+                int horizontal[3] =
+                {
+                    static_cast<int>(((high >> 1) & 0x3E) | (high & 1)),
+                    static_cast<int>((low >> 25) & 0x7F),
+                    static_cast<int>((low >> 19) & 0x3F)
+                };
+                int vertical[3] =
+                {
+                    static_cast<int>((low >> 13) & 0x3F),
+                    static_cast<int>((low >> 6) & 0x7F),
+                    static_cast<int>(low & 0x3F)
+                };
+
+                // Expand red and blue from 6 bits and green from 7 bits
+                for (int c = 0; c < 3; ++c)
+                {
+                    int shift = (c == 1) ? 1 : 2;
+                    origin[c] = (origin[c] << shift) | (origin[c] >> (8 - 2 * shift));
+                    horizontal[c] = (horizontal[c] << shift) | (horizontal[c] >> (8 - 2 * shift));
+                    vertical[c] = (vertical[c] << shift) | (vertical[c] >> (8 - 2 * shift));
+                }
+
+                for (int y = 0; y < 4; ++y)
+                {
+                    for (int x = 0; x < 4; ++x)
+                    {
+                        sfUint8* pixel = pixels + (y * 4 + x) * 4;
+                        for (int c = 0; c < 3; ++c)
+                            pixel[c] = clampColor((x * (horizontal[c] - origin[c]) + y * (vertical[c] - origin[c]) + 4 * origin[c] + 2) >> 2);
+                        pixel[3] = 255;
+                    }
+                }
+                return;
+            }
+
+            // Differential mode
+            int colors[2][3] = {{red, green, blue}, {red + deltaRed, green + deltaGreen, blue + deltaBlue}};
+            for (int s = 0; s < 2; ++s)
+            {
+                for (int c = 0; c < 3; ++c)
+                    base[s][c] = (colors[s][c] << 3) | (colors[s][c] >> 2);
+            }
+        }
+        else
+        {
+            // Individual mode
+            for (int s = 0; s < 2; ++s)
+            {
+                base[s][0] = static_cast<int>((high >> (28 - s * 4)) & 0xF) * 17;
+                base[s][1] = static_cast<int>((high >> (20 - s * 4)) & 0xF) * 17;
+                base[s][2] = static_cast<int>((high >> (12 - s * 4)) & 0xF) * 17;
+            }
+        }
+
+        // Each half of the block has its own base color and modifiers
+        int tables[2] = {static_cast<int>((high >> 5) & 7), static_cast<int>((high >> 2) & 7)};
+        for (int y = 0; y < 4; ++y)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                int subset = flip ? (y >= 2) : (x >= 2);
+                int index = indices[y * 4 + x];
+                int modifier = etcModifiers[tables[subset]][index & 1];
+                if (index & 2)
+                    modifier = -modifier;
+
+                sfUint8* pixel = pixels + (y * 4 + x) * 4;
+                for (int c = 0; c < 3; ++c)
+                    pixel[c] = clampColor(base[subset][c] + modifier);
+                pixel[3] = 255;
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeEtc2Rgba(const sfUint8* block, sfUint8* pixels)
+    {
+        decodeEtc2(block + 8, pixels);
+
+        // Alpha is stored in an EAC block, indices stored column by column
+        sfUint64 bits = readBigEndian64(block);
+        int base = static_cast<int>(bits >> 56);
+        int multiplier = static_cast<int>((bits >> 52) & 0xF);
+        const int* modifiers = eacModifiers[(bits >> 48) & 0xF];
+        for (int i = 0; i < 16; ++i)
+        {
+            int index = static_cast<int>((bits >> (45 - i * 3)) & 7);
+            pixels[((i & 3) * 4 + (i >> 2)) * 4 + 3] = clampColor(base + modifiers[index] * multiplier);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    struct DecodeJob
+    {
+        const priv::TextureContainer* Container;
+        const priv::TextureLevel*     Level;
+        sfUint8*                      Pixels;
+        std::size_t                   BlocksPerRow;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeRows(std::size_t begin, std::size_t end, void* userData)
+    {
+        const DecodeJob& job = *static_cast<const DecodeJob*>(userData);
+        const priv::TextureContainer& container = *job.Container;
+        const priv::TextureLevel& level = *job.Level;
+
+        sfUint8 block[12 * 12 * 4];
+        for (std::size_t row = begin; row < end; ++row)
+        {
+            unsigned int top = static_cast<unsigned int>(row) * container.BlockHeight;
+            unsigned int height = std::min(container.BlockHeight, level.Height - top);
+            for (std::size_t column = 0; column < job.BlocksPerRow; ++column)
+            {
+                priv::decodeBlock(container, level.Data + (row * job.BlocksPerRow + column) * container.BlockSize, block);
+
+                // Blocks on the right and bottom edges can be partially outside the level
+                unsigned int left = static_cast<unsigned int>(column) * container.BlockWidth;
+                unsigned int width = std::min(container.BlockWidth, level.Width - left);
+                for (unsigned int y = 0; y < height; ++y)
+                    std::memcpy(job.Pixels + ((static_cast<std::size_t>(top) + y) * level.Width + left) * 4, block + y * container.BlockWidth * 4, width * 4);
+            }
+        }
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    void decodeBlock(const TextureContainer& container, const sfUint8* block, sfUint8* pixels)
+    {
+        switch (container.Format)
+        {
+            case sfTextureFormatRgba8:    std::memcpy(pixels, block, 4); break;
+            case sfTextureFormatBc1:      decodeBc1(block, pixels, false); break;
+            case sfTextureFormatBc2:      decodeBc2(block, pixels); break;
+            case sfTextureFormatBc3:      decodeBc3(block, pixels); break;
+            case sfTextureFormatBc4:      decodeBc4(block, pixels); break;
+            case sfTextureFormatBc5:      decodeBc5(block, pixels); break;
+            case sfTextureFormatBc7:      decodeBc7(block, pixels); break;
+            case sfTextureFormatEtc2Rgb:  decodeEtc2(block, pixels); break;
+            case sfTextureFormatEtc2Rgba: decodeEtc2Rgba(block, pixels); break;
+            case sfTextureFormatAstc:     decodeAstcBlock(block, container.BlockWidth, container.BlockHeight, pixels); break;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void decodeLevel(const TextureContainer& container, const TextureLevel& level, std::vector<sfUint8>& pixels)
+    {
+        pixels.resize(static_cast<std::size_t>(level.Width) * level.Height * 4);
+
+        if (container.Format == sfTextureFormatRgba8)
+        {
+            std::memcpy(&pixels[0], level.Data, pixels.size());
+            return;
+        }
+
+        DecodeJob job;
+        job.Container = &container;
+        job.Level = &level;
+        job.Pixels = &pixels[0];
+        job.BlocksPerRow = (level.Width + container.BlockWidth - 1) / container.BlockWidth;
+
+        std::size_t rows = (level.Height + container.BlockHeight - 1) / container.BlockHeight;
+        if (rows >= minParallelRows)
+            sfTaskPool_parallelFor(getImagePool(), 0, rows, 0, &decodeRows, &job);
+        else
+            decodeRows(0, rows, &job);
+    }
+}
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_BLOCKDECODER_HPP
+#define SFML_BLOCKDECODER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureContainer.hpp>
+#include <vector>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Decode a block of a container to RGBA pixels, stored in
+    // rows of BlockWidth pixels
+    ////////////////////////////////////////////////////////////
+    void decodeBlock(const TextureContainer& container, const sfUint8* block, sfUint8* pixels);
+
+    ////////////////////////////////////////////////////////////
+    // Decode an ASTC LDR block to RGBA pixels; invalid blocks
+    // are decoded to magenta, as required by the specification
+    ////////////////////////////////////////////////////////////
+    void decodeAstcBlock(const sfUint8* block, unsigned int blockWidth, unsigned int blockHeight, sfUint8* pixels);
+
+    ////////////////////////////////////////////////////////////
+    // Decode a level of a container to RGBA pixels; large levels
+    // are decoded in parallel by the tasks of the image pool
+    ////////////////////////////////////////////////////////////
+    void decodeLevel(const TextureContainer& container, const TextureLevel& level, std::vector<sfUint8>& pixels);
+}
+
+
+#endif // SFML_BLOCKDECODER_HPP
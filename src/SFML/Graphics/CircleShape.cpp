@@ -58,6 +58,45 @@ void sfCircleShape_destroy(sfCircleShape* shape)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfCircleShape_sizeof(void)
+{
+    return sizeof(sfCircleShape);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfCircleShape_alignof(void)
+{
+    return alignof(sfCircleShape);
+}
+
+
+////////////////////////////////////////////////////////////
+sfCircleShape* sfCircleShape_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfCircleShape)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfCircleShape_init is not suitably aligned");
+        return NULL;
+    }
+
+    sfCircleShape* shape = new (memory) sfCircleShape;
+    shape->Texture = NULL;
+
+    return shape;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCircleShape_deinit(sfCircleShape* shape)
+{
+    if (shape)
+        shape->~sfCircleShape();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfCircleShape_setPosition(sfCircleShape* shape, sfVector2f position)
 {
@@ -31,12 +31,13 @@
 #include <SFML/Graphics/CircleShape.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfCircleShape
 ////////////////////////////////////////////////////////////
-struct sfCircleShape
+struct sfCircleShape : public priv::Pooled<sfCircleShape>
 {
     sf::CircleShape     This;
     const sfTexture*    Texture;
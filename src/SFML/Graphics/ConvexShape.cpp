@@ -55,6 +55,42 @@ void sfConvexShape_destroy(sfConvexShape* shape)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfConvexShape_sizeof(void)
+{
+    return sizeof(sfConvexShape);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfConvexShape_alignof(void)
+{
+    return alignof(sfConvexShape);
+}
+
+
+////////////////////////////////////////////////////////////
+sfConvexShape* sfConvexShape_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfConvexShape)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfConvexShape_init is not suitably aligned");
+        return NULL;
+    }
+
+    return new (memory) sfConvexShape;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfConvexShape_deinit(sfConvexShape* shape)
+{
+    if (shape)
+        shape->~sfConvexShape();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfConvexShape_setPosition(sfConvexShape* shape, sfVector2f position)
 {
@@ -31,12 +31,13 @@
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfConvexShape
 ////////////////////////////////////////////////////////////
-struct sfConvexShape
+struct sfConvexShape : public priv::Pooled<sfConvexShape>
 {
     sf::ConvexShape     This;
     const sfTexture*    Texture;
@@ -31,13 +31,14 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/CallbackStream.h>
+#include <SFML/ObjectAllocator.h>
 #include <map>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFont
 ////////////////////////////////////////////////////////////
-struct sfFont
+struct sfFont : public priv::Allocated
 {
     sf::Font This;
     std::map<unsigned int, sfTexture> Textures;
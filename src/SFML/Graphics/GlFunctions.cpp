@@ -0,0 +1,190 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GlFunctions.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <cstdio>
+#include <cstring>
+
+
+namespace
+{
+    priv::GlFunctions gl;
+    std::atomic<bool> loaded(false);
+    sf::Mutex         mutex;
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void load(T& function, const char* name, const char* fallbackName = NULL)
+    {
+        sf::GlFunctionPointer address = sf::Context::getFunction(name);
+        if (!address && fallbackName)
+            address = sf::Context::getFunction(fallbackName);
+
+        function = reinterpret_cast<T>(address);
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    bool hasExtension(const GlFunctions& gl, const char* name)
+    {
+        if (!gl.GetIntegerv || !gl.GetError || !gl.GetString)
+            return false;
+
+        // Core contexts only list their extensions one by one; older
+        // contexts don't know GL_NUM_EXTENSIONS and leave the count at 0
+        GLint count = 0;
+        if (gl.GetStringi)
+        {
+            gl.GetIntegerv(GL_NUM_EXTENSIONS, &count);
+            gl.GetError();
+        }
+
+        if (count > 0)
+        {
+            for (GLint i = 0; i < count; ++i)
+            {
+                const GLubyte* extension = gl.GetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+                if (extension && (std::strcmp(reinterpret_cast<const char*>(extension), name) == 0))
+                    return true;
+            }
+
+            return false;
+        }
+
+        const char* extensions = reinterpret_cast<const char*>(gl.GetString(GL_EXTENSIONS));
+        if (!extensions)
+            return false;
+
+        std::size_t length = std::strlen(name);
+        for (const char* found = std::strstr(extensions, name); found; found = std::strstr(found + length, name))
+        {
+            if (((found == extensions) || (found[-1] == ' ')) && ((found[length] == ' ') || (found[length] == '\0')))
+                return true;
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool hasVersion(const GlFunctions& gl, bool embedded, int major, int minor)
+    {
+        if (!gl.GetString)
+            return false;
+
+        // "4.5 (Core Profile) Mesa ..." or "OpenGL ES 3.2 Mesa ..."
+        const char* version = reinterpret_cast<const char*>(gl.GetString(GL_VERSION));
+        if (!version)
+            return false;
+
+        const char prefix[] = "OpenGL ES ";
+        bool isEmbedded = (std::strncmp(version, prefix, sizeof(prefix) - 1) == 0);
+        if (isEmbedded)
+            version += sizeof(prefix) - 1;
+
+        int actualMajor = 0;
+        int actualMinor = 0;
+        if ((isEmbedded != embedded) || (std::sscanf(version, "%d.%d", &actualMajor, &actualMinor) != 2))
+            return false;
+
+        return (actualMajor > major) || ((actualMajor == major) && (actualMinor >= minor));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    const GlFunctions& getGlFunctions()
+    {
+        if (loaded.load(std::memory_order_acquire))
+            return gl;
+
+        sf::Lock lock(mutex);
+
+        if (!loaded.load(std::memory_order_relaxed))
+        {
+            load(gl.GetIntegerv,            "glGetIntegerv");
+            load(gl.BindTexture,            "glBindTexture");
+            load(gl.GetTexLevelParameteriv, "glGetTexLevelParameteriv");
+            load(gl.GetTexImage,            "glGetTexImage");
+            load(gl.ReadPixels,             "glReadPixels");
+            load(gl.Flush,                  "glFlush");
+            load(gl.GetError,               "glGetError");
+            load(gl.GetString,              "glGetString");
+            load(gl.TexImage2D,             "glTexImage2D");
+            load(gl.TexParameteri,          "glTexParameteri");
+            load(gl.CompressedTexImage2D,   "glCompressedTexImage2D", "glCompressedTexImage2DARB");
+            load(gl.GetStringi,             "glGetStringi");
+            load(gl.GenBuffers,             "glGenBuffers",    "glGenBuffersARB");
+            load(gl.DeleteBuffers,          "glDeleteBuffers", "glDeleteBuffersARB");
+            load(gl.BindBuffer,             "glBindBuffer",    "glBindBufferARB");
+            load(gl.BufferData,             "glBufferData",    "glBufferDataARB");
+            load(gl.MapBuffer,              "glMapBuffer",     "glMapBufferARB");
+            load(gl.UnmapBuffer,            "glUnmapBuffer",   "glUnmapBufferARB");
+            load(gl.FenceSync,              "glFenceSync");
+            load(gl.ClientWaitSync,         "glClientWaitSync");
+            load(gl.DeleteSync,             "glDeleteSync");
+            load(gl.UseProgram,             "glUseProgram",         "glUseProgramObjectARB");
+            load(gl.GetUniformLocation,     "glGetUniformLocation", "glGetUniformLocationARB");
+            load(gl.Uniform1f,              "glUniform1f",          "glUniform1fARB");
+            load(gl.Uniform2f,              "glUniform2f",          "glUniform2fARB");
+            load(gl.Uniform3f,              "glUniform3f",          "glUniform3fARB");
+            load(gl.Uniform4f,              "glUniform4f",          "glUniform4fARB");
+            load(gl.Uniform1i,              "glUniform1i",          "glUniform1iARB");
+            load(gl.Uniform2i,              "glUniform2i",          "glUniform2iARB");
+            load(gl.Uniform3i,              "glUniform3i",          "glUniform3iARB");
+            load(gl.Uniform4i,              "glUniform4i",          "glUniform4iARB");
+            load(gl.UniformMatrix3fv,       "glUniformMatrix3fv",   "glUniformMatrix3fvARB");
+            load(gl.UniformMatrix4fv,       "glUniformMatrix4fv",   "glUniformMatrix4fvARB");
+            load(gl.GetProgramiv,           "glGetProgramiv");
+            load(gl.GetProgramBinary,       "glGetProgramBinary");
+            load(gl.ProgramBinary,          "glProgramBinary");
+
+            // Some drivers export entry points that the context doesn't
+            // support, so the version and the extensions are checked too
+            gl.HasBasics  = gl.GetIntegerv && gl.BindTexture && gl.GetTexLevelParameteriv && gl.GetTexImage && gl.ReadPixels && gl.Flush;
+            gl.HasBuffers = gl.HasBasics && gl.GenBuffers && gl.DeleteBuffers && gl.BindBuffer && gl.BufferData && gl.MapBuffer && gl.UnmapBuffer &&
+                            (hasVersion(gl, false, 2, 1) || hasExtension(gl, "GL_ARB_pixel_buffer_object") || hasExtension(gl, "GL_EXT_pixel_buffer_object"));
+            gl.HasSync    = gl.FenceSync && gl.ClientWaitSync && gl.DeleteSync &&
+                            (hasVersion(gl, false, 3, 2) || hasVersion(gl, true, 3, 0) || hasExtension(gl, "GL_ARB_sync"));
+            gl.HasShaders = gl.HasBasics && gl.UseProgram && gl.GetUniformLocation && gl.Uniform1f && gl.Uniform2f && gl.Uniform3f && gl.Uniform4f &&
+                            gl.Uniform1i && gl.Uniform2i && gl.Uniform3i && gl.Uniform4i && gl.UniformMatrix3fv && gl.UniformMatrix4fv;
+            gl.HasProgramBinary = gl.HasShaders && gl.GetError && gl.GetString && gl.GetProgramiv && gl.GetProgramBinary && gl.ProgramBinary &&
+                                  (hasVersion(gl, false, 4, 1) || hasVersion(gl, true, 3, 0) || hasExtension(gl, "GL_ARB_get_program_binary") ||
+                                   hasExtension(gl, "GL_OES_get_program_binary"));
+            gl.HasCompression   = gl.HasBasics && gl.GetError && gl.GetString && gl.TexImage2D && gl.TexParameteri && gl.CompressedTexImage2D;
+
+            loaded.store(true, std::memory_order_release);
+        }
+
+        return gl;
+    }
+}
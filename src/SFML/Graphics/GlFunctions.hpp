@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_GLFUNCTIONS_HPP
+#define SFML_GLFUNCTIONS_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+#include <SFML/Window/Context.hpp>
+#include <atomic>
+#include <cstddef>
+
+
+// The OpenGL entry points used by CSFML are loaded at runtime
+// through sf::Context, so that CSFML doesn't have to link OpenGL
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #define CSFML_GLAPI __stdcall
+#else
+    #define CSFML_GLAPI
+#endif
+
+
+namespace priv
+{
+    typedef unsigned int       GLenum;
+    typedef unsigned int       GLuint;
+    typedef int                GLint;
+    typedef int                GLsizei;
+    typedef unsigned int       GLbitfield;
+    typedef unsigned char      GLboolean;
+    typedef unsigned char      GLubyte;
+    typedef float              GLfloat;
+    typedef char               GLchar;
+    typedef std::ptrdiff_t     GLsizeiptr;
+    typedef unsigned long long GLuint64;
+    typedef void*              GLsync;
+
+    const GLenum GL_NO_ERROR                   = 0;
+    const GLenum GL_TEXTURE_2D                 = 0x0DE1;
+    const GLenum GL_TEXTURE_WIDTH              = 0x1000;
+    const GLenum GL_TEXTURE_HEIGHT             = 0x1001;
+    const GLenum GL_UNSIGNED_BYTE              = 0x1401;
+    const GLenum GL_RGBA                       = 0x1908;
+    const GLenum GL_VENDOR                     = 0x1F00;
+    const GLenum GL_RENDERER                   = 0x1F01;
+    const GLenum GL_VERSION                    = 0x1F02;
+    const GLenum GL_EXTENSIONS                 = 0x1F03;
+    const GLenum GL_NEAREST_MIPMAP_LINEAR      = 0x2702;
+    const GLenum GL_TEXTURE_MIN_FILTER         = 0x2801;
+    const GLenum GL_RGBA8                      = 0x8058;
+    const GLenum GL_TEXTURE_BINDING_2D         = 0x8069;
+    const GLenum GL_TEXTURE_MAX_LEVEL          = 0x813D;
+    const GLenum GL_NUM_EXTENSIONS             = 0x821D;
+    const GLenum GL_READ_ONLY                  = 0x88B8;
+    const GLenum GL_STREAM_READ                = 0x88E1;
+    const GLenum GL_PROGRAM_BINARY_LENGTH      = 0x8741;
+    const GLenum GL_NUM_PROGRAM_BINARY_FORMATS = 0x87FE;
+    const GLenum GL_PROGRAM_BINARY_FORMATS     = 0x87FF;
+    const GLenum GL_PIXEL_PACK_BUFFER          = 0x88EB;
+    const GLenum GL_LINK_STATUS                = 0x8B82;
+    const GLenum GL_CURRENT_PROGRAM            = 0x8B8D;
+    const GLenum GL_SYNC_GPU_COMMANDS_COMPLETE = 0x9117;
+    const GLenum GL_ALREADY_SIGNALED           = 0x911A;
+    const GLenum GL_CONDITION_SATISFIED        = 0x911C;
+
+    ////////////////////////////////////////////////////////////
+    // OpenGL functions that CSFML calls directly
+    ////////////////////////////////////////////////////////////
+    struct GlFunctions
+    {
+        // OpenGL 1.1
+        void      (CSFML_GLAPI *GetIntegerv)(GLenum, GLint*);
+        void      (CSFML_GLAPI *BindTexture)(GLenum, GLuint);
+        void      (CSFML_GLAPI *GetTexLevelParameteriv)(GLenum, GLint, GLenum, GLint*);
+        void      (CSFML_GLAPI *GetTexImage)(GLenum, GLint, GLenum, GLenum, void*);
+        void      (CSFML_GLAPI *ReadPixels)(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, void*);
+        void      (CSFML_GLAPI *Flush)();
+        GLenum    (CSFML_GLAPI *GetError)();
+        const GLubyte* (CSFML_GLAPI *GetString)(GLenum);
+        void      (CSFML_GLAPI *TexImage2D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*);
+        void      (CSFML_GLAPI *TexParameteri)(GLenum, GLenum, GLint);
+
+        // Compressed textures
+        void      (CSFML_GLAPI *CompressedTexImage2D)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void*);
+        const GLubyte* (CSFML_GLAPI *GetStringi)(GLenum, GLuint);
+
+        // Buffer objects
+        void      (CSFML_GLAPI *GenBuffers)(GLsizei, GLuint*);
+        void      (CSFML_GLAPI *DeleteBuffers)(GLsizei, const GLuint*);
+        void      (CSFML_GLAPI *BindBuffer)(GLenum, GLuint);
+        void      (CSFML_GLAPI *BufferData)(GLenum, GLsizeiptr, const void*, GLenum);
+        void*     (CSFML_GLAPI *MapBuffer)(GLenum, GLenum);
+        GLboolean (CSFML_GLAPI *UnmapBuffer)(GLenum);
+
+        // Sync objects
+        GLsync    (CSFML_GLAPI *FenceSync)(GLenum, GLbitfield);
+        GLenum    (CSFML_GLAPI *ClientWaitSync)(GLsync, GLbitfield, GLuint64);
+        void      (CSFML_GLAPI *DeleteSync)(GLsync);
+
+        // Shader uniforms
+        void      (CSFML_GLAPI *UseProgram)(GLuint);
+        GLint     (CSFML_GLAPI *GetUniformLocation)(GLuint, const GLchar*);
+        void      (CSFML_GLAPI *Uniform1f)(GLint, GLfloat);
+        void      (CSFML_GLAPI *Uniform2f)(GLint, GLfloat, GLfloat);
+        void      (CSFML_GLAPI *Uniform3f)(GLint, GLfloat, GLfloat, GLfloat);
+        void      (CSFML_GLAPI *Uniform4f)(GLint, GLfloat, GLfloat, GLfloat, GLfloat);
+        void      (CSFML_GLAPI *Uniform1i)(GLint, GLint);
+        void      (CSFML_GLAPI *Uniform2i)(GLint, GLint, GLint);
+        void      (CSFML_GLAPI *Uniform3i)(GLint, GLint, GLint, GLint);
+        void      (CSFML_GLAPI *Uniform4i)(GLint, GLint, GLint, GLint, GLint);
+        void      (CSFML_GLAPI *UniformMatrix3fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+        void      (CSFML_GLAPI *UniformMatrix4fv)(GLint, GLsizei, GLboolean, const GLfloat*);
+
+        // Program binaries
+        void      (CSFML_GLAPI *GetProgramiv)(GLuint, GLenum, GLint*);
+        void      (CSFML_GLAPI *GetProgramBinary)(GLuint, GLsizei, GLsizei*, GLenum*, void*);
+        void      (CSFML_GLAPI *ProgramBinary)(GLuint, GLenum, const void*, GLsizei);
+
+        bool HasBasics;         ///< OpenGL 1.1 functions
+        bool HasBuffers;        ///< Pixel buffer objects (OpenGL 2.1 or ARB_pixel_buffer_object)
+        bool HasSync;           ///< Sync objects (OpenGL 3.2 or ARB_sync)
+        bool HasShaders;        ///< Programs and uniforms (OpenGL 2.0 or ARB_shader_objects)
+        bool HasProgramBinary;  ///< Program binaries (OpenGL 4.1 or ARB_get_program_binary)
+        bool HasCompression;    ///< Compressed textures (OpenGL 1.3 or ARB_texture_compression)
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Get the OpenGL functions, loading them on first call;
+    // a context must be active for the first call
+    ////////////////////////////////////////////////////////////
+    const GlFunctions& getGlFunctions();
+
+
+    ////////////////////////////////////////////////////////////
+    // Tell whether the active context supports an extension
+    ////////////////////////////////////////////////////////////
+    bool hasExtension(const GlFunctions& gl, const char* name);
+
+
+    ////////////////////////////////////////////////////////////
+    // Tell whether the active context is at least of the given
+    // version of OpenGL, or of OpenGL ES if \a embedded is true
+    ////////////////////////////////////////////////////////////
+    bool hasVersion(const GlFunctions& gl, bool embedded, int major, int minor);
+
+
+    ////////////////////////////////////////////////////////////
+    // Make sure that a context is active for the lifetime of the object
+    ////////////////////////////////////////////////////////////
+    class ActiveContext
+    {
+    public:
+
+        ActiveContext() :
+        myContext(NULL)
+        {
+            if (sf::Context::getActiveContextId() == 0)
+                myContext = new sf::Context;
+        }
+
+        ~ActiveContext()
+        {
+            delete myContext;
+        }
+
+    private:
+
+        ActiveContext(const ActiveContext&);
+        ActiveContext& operator =(const ActiveContext&);
+
+        sf::Context* myContext;
+    };
+}
+
+
+#endif // SFML_GLFUNCTIONS_HPP
@@ -27,8 +27,93 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.h>
 #include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Graphics/ImageCodec.hpp>
+#include <SFML/System/Allocator.h>
+#include <SFML/System/TaskPool.h>
 #include <SFML/Internal.h>
 #include <SFML/CallbackStream.h>
+#include <SFML/ObjectAllocator.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Encode pixels and write them to a file; formats that CSFML
+    // doesn't encode itself (jpg) are saved by SFML
+    ////////////////////////////////////////////////////////////
+    bool savePixels(const sfUint8* pixels, unsigned int width, unsigned int height, const char* filename)
+    {
+        sfImageFormat format;
+        if (!priv::getImageFormat(filename, format))
+        {
+            sf::Image image;
+            if (pixels)
+                image.create(width, height, pixels);
+            return image.saveToFile(filename);
+        }
+
+        priv::ByteBuffer data;
+        return priv::encodeImage(pixels, width, height, format, data) && priv::writeImageFile(filename, data);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Copy of an image being saved in the background
+    ////////////////////////////////////////////////////////////
+    struct SaveRequest : public priv::Allocated
+    {
+        priv::ByteBuffer Pixels;
+        unsigned int     Width;
+        unsigned int     Height;
+        std::string      Filename;
+        sfBool*          Success;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void saveInBackground(void* userData)
+    {
+        SaveRequest* request = static_cast<SaveRequest*>(userData);
+
+        bool saved = savePixels(&request->Pixels[0], request->Width, request->Height, request->Filename.c_str());
+        if (request->Success)
+            *request->Success = saved ? sfTrue : sfFalse;
+
+        delete request;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isQoiFile(const char* filename)
+    {
+        sfImageFormat format;
+        return priv::getImageFormat(filename, format) && (format == sfImageFormatQoi);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool loadQoiFile(const char* filename, sf::Image& image)
+    {
+        std::FILE* file = std::fopen(filename, "rb");
+        if (!file)
+            return false;
+
+        priv::ByteBuffer data;
+        sfUint8 buffer[65536];
+        std::size_t count;
+        while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+            data.insert(data.end(), buffer, buffer + count);
+
+        bool ok = !std::ferror(file);
+        std::fclose(file);
+
+        return ok && !data.empty() && priv::decodeQoi(&data[0], data.size(), image);
+    }
+}
+
 
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_create(unsigned int width, unsigned int height)
@@ -65,7 +150,9 @@ sfImage* sfImage_createFromFile(const char* filename)
 {
     sfImage* image = new sfImage;
 
-    if (!image->This.loadFromFile(filename))
+    // SFML can't read QOI files
+    bool loaded = isQoiFile(filename) ? loadQoiFile(filename, image->This) : image->This.loadFromFile(filename);
+    if (!loaded)
     {
         delete image;
         image = NULL;
@@ -80,7 +167,8 @@ sfImage* sfImage_createFromMemory(const void* data, size_t sizeInBytes)
 {
     sfImage* image = new sfImage;
 
-    if (!image->This.loadFromMemory(data, sizeInBytes))
+    bool loaded = priv::isQoi(data, sizeInBytes) ? priv::decodeQoi(data, sizeInBytes, image->This) : image->This.loadFromMemory(data, sizeInBytes);
+    if (!loaded)
     {
         delete image;
         image = NULL;
@@ -127,7 +215,63 @@ void sfImage_destroy(sfImage* image)
 ////////////////////////////////////////////////////////////
 sfBool sfImage_saveToFile(const sfImage* image, const char* filename)
 {
-    CSFML_CALL_RETURN(image, saveToFile(filename), sfFalse);
+    CSFML_CHECK_RETURN(image, sfFalse);
+    CSFML_CHECK_RETURN(filename, sfFalse);
+
+    sf::Vector2u size = image->This.getSize();
+
+    return savePixels(image->This.getPixelsPtr(), size.x, size.y, filename) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfTask* sfImage_saveToFileAsync(const sfImage* image, const char* filename, sfTaskPool* pool, sfBool* success)
+{
+    if (success)
+        *success = sfFalse;
+
+    CSFML_CHECK_RETURN(image, NULL);
+    CSFML_CHECK_RETURN(filename, NULL);
+
+    sf::Vector2u size = image->This.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return NULL;
+
+    // Copy the pixels now, so that the image can change while it's being saved
+    const sfUint8* pixels = image->This.getPixelsPtr();
+    SaveRequest* request = new SaveRequest;
+    request->Pixels.assign(pixels, pixels + static_cast<std::size_t>(size.x) * size.y * 4);
+    request->Width    = size.x;
+    request->Height   = size.y;
+    request->Filename = filename;
+    request->Success  = success;
+
+    return sfTaskPool_submit(pool ? pool : priv::getImagePool(), &saveInBackground, request, NULL, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfImage_saveToMemory(const sfImage* image, sfImageFormat format, size_t* sizeInBytes)
+{
+    if (sizeInBytes)
+        *sizeInBytes = 0;
+
+    CSFML_CHECK_RETURN(image, NULL);
+    CSFML_CHECK_RETURN(sizeInBytes, NULL);
+
+    sf::Vector2u size = image->This.getSize();
+    priv::ByteBuffer data;
+    if (!priv::encodeImage(image->This.getPixelsPtr(), size.x, size.y, format, data))
+        return NULL;
+
+    void* buffer = sfMalloc(data.size());
+    if (!buffer)
+        return NULL;
+
+    std::memcpy(buffer, &data[0], data.size());
+    *sizeInBytes = data.size();
+
+    return buffer;
 }
 
 
@@ -0,0 +1,980 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageCodec.hpp>
+#include <SFML/System/TaskPool.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // PNG encoding
+    //
+    // The image is cut in horizontal stripes that are filtered
+    // and compressed independently, each by a task: every stripe
+    // is a fixed Huffman deflate block followed by an empty stored
+    // block, which byte-aligns the stream so that the stripes can
+    // simply be concatenated. Each stripe goes in its own IDAT
+    // chunk, and the Adler-32 checksums of the stripes are combined
+    // at the end.
+    ////////////////////////////////////////////////////////////
+    const std::size_t minStripeSize = 64 * 1024; // Minimum size of the filtered data of a stripe, in bytes
+    const unsigned int stripesPerThread = 4;
+    const unsigned int hashBits = 15;
+    const unsigned int windowSize = 32768;
+    const unsigned int minMatch = 4;
+    const unsigned int maxMatch = 258;
+
+    const unsigned char pngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    const unsigned short lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const unsigned char lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    const unsigned short distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    const unsigned char distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+
+    ////////////////////////////////////////////////////////////
+    // Tables computed once: CRC-32, and the bit-reversed codes of
+    // the fixed Huffman alphabets of deflate
+    ////////////////////////////////////////////////////////////
+    struct Tables
+    {
+        Tables()
+        {
+            for (sfUint32 i = 0; i < 256; ++i)
+            {
+                sfUint32 c = i;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                Crc[i] = c;
+            }
+
+            for (unsigned int symbol = 0; symbol < 288; ++symbol)
+            {
+                unsigned int code;
+                unsigned int length;
+                if (symbol < 144)      {code = 0x30 + symbol;          length = 8;}
+                else if (symbol < 256) {code = 0x190 + symbol - 144;   length = 9;}
+                else if (symbol < 280) {code = symbol - 256;           length = 7;}
+                else                   {code = 0xC0 + symbol - 280;    length = 8;}
+                LiteralCode[symbol] = static_cast<sfUint16>(reverse(code, length));
+                LiteralLength[symbol] = static_cast<sfUint8>(length);
+            }
+
+            for (unsigned int symbol = 0; symbol < 30; ++symbol)
+                DistanceCode[symbol] = static_cast<sfUint8>(reverse(symbol, 5));
+
+            for (unsigned int symbol = 0; symbol < 29; ++symbol)
+            {
+                unsigned int end = (symbol == 28) ? 259 : lengthBase[symbol] + (1u << lengthExtra[symbol]);
+                for (unsigned int length = lengthBase[symbol]; length < end; ++length)
+                    LengthSymbol[length] = static_cast<sfUint8>(symbol);
+            }
+
+            for (unsigned int symbol = 0; symbol < 30; ++symbol)
+            {
+                unsigned int end = distanceBase[symbol] + (1u << distanceExtra[symbol]);
+                for (unsigned int distance = distanceBase[symbol]; distance < end; ++distance)
+                {
+                    if (distance <= 256)
+                        DistanceSymbolLow[distance] = static_cast<sfUint8>(symbol);
+                    else
+                        DistanceSymbolHigh[(distance - 1) >> 7] = static_cast<sfUint8>(symbol);
+                }
+            }
+        }
+
+        static unsigned int reverse(unsigned int code, unsigned int length)
+        {
+            unsigned int result = 0;
+            for (unsigned int i = 0; i < length; ++i)
+                result |= ((code >> i) & 1) << (length - 1 - i);
+            return result;
+        }
+
+        unsigned int distanceSymbol(unsigned int distance) const
+        {
+            return (distance <= 256) ? DistanceSymbolLow[distance] : DistanceSymbolHigh[(distance - 1) >> 7];
+        }
+
+        sfUint32 Crc[256];
+        sfUint16 LiteralCode[288];
+        sfUint8  LiteralLength[288];
+        sfUint8  DistanceCode[30];
+        sfUint8  LengthSymbol[259];
+        sfUint8  DistanceSymbolLow[257];
+        sfUint8  DistanceSymbolHigh[256];
+    };
+
+    const Tables& getTables()
+    {
+        static const Tables tables;
+        return tables;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 updateCrc(const Tables& tables, sfUint32 crc, const sfUint8* data, std::size_t size)
+    {
+        crc = ~crc;
+        for (std::size_t i = 0; i < size; ++i)
+            crc = tables.Crc[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 adler32(const sfUint8* data, std::size_t size)
+    {
+        sfUint32 a = 1;
+        sfUint32 b = 0;
+        while (size > 0)
+        {
+            // 5552 is the largest block for which b can't overflow before the modulo
+            std::size_t block = std::min<std::size_t>(size, 5552);
+            for (std::size_t i = 0; i < block; ++i)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += block;
+            size -= block;
+        }
+        return (b << 16) | a;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Checksum of the concatenation of two blocks, from their
+    // checksums and the size of the second one
+    ////////////////////////////////////////////////////////////
+    sfUint32 combineAdler32(sfUint32 first, sfUint32 second, std::size_t secondSize)
+    {
+        const sfUint32 base = 65521;
+        sfUint32 remainder = static_cast<sfUint32>(secondSize % base);
+        sfUint32 sum1 = first & 0xFFFF;
+        sfUint32 sum2 = (remainder * sum1) % base;
+        sum1 += (second & 0xFFFF) + base - 1;
+        sum2 += (first >> 16) + (second >> 16) + base - remainder;
+        if (sum1 >= base)
+            sum1 -= base;
+        if (sum1 >= base)
+            sum1 -= base;
+        if (sum2 >= 2 * base)
+            sum2 -= 2 * base;
+        if (sum2 >= base)
+            sum2 -= base;
+        return (sum2 << 16) | sum1;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Writes bits least significant first, as deflate wants them
+    ////////////////////////////////////////////////////////////
+    class BitWriter
+    {
+    public:
+
+        explicit BitWriter(priv::ByteBuffer& output) :
+        myOutput(output),
+        myBits  (0),
+        myCount (0)
+        {
+        }
+
+        void write(sfUint32 bits, unsigned int count)
+        {
+            myBits |= static_cast<sfUint64>(bits) << myCount;
+            myCount += count;
+            while (myCount >= 8)
+            {
+                myOutput.push_back(static_cast<sfUint8>(myBits));
+                myBits >>= 8;
+                myCount -= 8;
+            }
+        }
+
+        void align()
+        {
+            if (myCount > 0)
+                write(0, 8 - myCount);
+        }
+
+    private:
+
+        priv::ByteBuffer& myOutput;
+        sfUint64              myBits;
+        unsigned int          myCount;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Compress data with fixed Huffman codes and a single-entry
+    // hash table of the previous 4-byte sequences, then end the
+    // stream segment with an empty stored block
+    ////////////////////////////////////////////////////////////
+    void deflate(const sfUint8* data, std::size_t size, bool last, priv::ByteBuffer& output)
+    {
+        const Tables& tables = getTables();
+        std::size_t start = output.size();
+        BitWriter writer(output);
+        std::vector<sfInt32, priv::Allocator<sfInt32> > head(std::size_t(1) << hashBits, -1);
+
+        // Fixed Huffman block, not final
+        writer.write(0, 1);
+        writer.write(1, 2);
+
+        std::size_t position = 0;
+        while (position < size)
+        {
+            unsigned int length = 0;
+            unsigned int distance = 0;
+
+            if (position + minMatch <= size)
+            {
+                sfUint32 sequence;
+                std::memcpy(&sequence, data + position, 4);
+                sfUint32 hash = (sequence * 2654435761u) >> (32 - hashBits);
+                sfInt32 candidate = head[hash];
+                head[hash] = static_cast<sfInt32>(position);
+
+                if ((candidate >= 0) && (position - candidate <= windowSize) && (std::memcmp(data + candidate, data + position, minMatch) == 0))
+                {
+                    std::size_t limit = std::min<std::size_t>(maxMatch, size - position);
+                    length = minMatch;
+                    while ((length < limit) && (data[candidate + length] == data[position + length]))
+                        ++length;
+                    distance = static_cast<unsigned int>(position - candidate);
+                }
+            }
+
+            if (length > 0)
+            {
+                unsigned int lengthSymbol = tables.LengthSymbol[length];
+                unsigned int symbol = 257 + lengthSymbol;
+                writer.write(tables.LiteralCode[symbol], tables.LiteralLength[symbol]);
+                writer.write(length - lengthBase[lengthSymbol], lengthExtra[lengthSymbol]);
+
+                unsigned int distanceSymbol = tables.distanceSymbol(distance);
+                writer.write(tables.DistanceCode[distanceSymbol], 5);
+                writer.write(distance - distanceBase[distanceSymbol], distanceExtra[distanceSymbol]);
+
+                // Index a few positions at the end of the match, so that
+                // the next repetition finds it; indexing all of them
+                // costs more than it gains
+                std::size_t end = position + length;
+                for (std::size_t i = std::max(position + 1, end - std::min<std::size_t>(length, 4)); (i < end) && (i + minMatch <= size); ++i)
+                {
+                    sfUint32 sequence;
+                    std::memcpy(&sequence, data + i, 4);
+                    head[(sequence * 2654435761u) >> (32 - hashBits)] = static_cast<sfInt32>(i);
+                }
+                position = end;
+            }
+            else
+            {
+                unsigned int literal = data[position];
+                writer.write(tables.LiteralCode[literal], tables.LiteralLength[literal]);
+                ++position;
+            }
+        }
+
+        // End of block
+        writer.write(tables.LiteralCode[256], tables.LiteralLength[256]);
+
+        // Empty stored block, final for the last stripe
+        writer.write(last ? 1 : 0, 1);
+        writer.write(0, 2);
+        writer.align();
+        writer.write(0x0000, 16);
+        writer.write(0xFFFF, 16);
+
+        // Data that doesn't compress (noise) is stored instead
+        if (output.size() - start > size + (size / 65535 + 1) * 5)
+        {
+            output.resize(start);
+            for (std::size_t offset = 0; offset < size; offset += 65535)
+            {
+                std::size_t length = std::min<std::size_t>(size - offset, 65535);
+                bool isFinal = last && (offset + length == size);
+                writer.write(isFinal ? 1 : 0, 1);
+                writer.write(0, 2);
+                writer.align();
+                writer.write(static_cast<sfUint32>(length), 16);
+                writer.write(static_cast<sfUint32>(~length & 0xFFFF), 16);
+                output.insert(output.end(), data + offset, data + offset + length);
+            }
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    inline int paeth(int a, int b, int c)
+    {
+        int p = a + b - c;
+        int pa = std::abs(p - a);
+        int pb = std::abs(p - b);
+        int pc = std::abs(p - c);
+        if ((pa <= pb) && (pa <= pc))
+            return a;
+        return (pb <= pc) ? b : c;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    inline void addFilterCosts(int x, int a, int b, int c, unsigned int* sums)
+    {
+        sums[0] += static_cast<unsigned int>(std::abs(static_cast<sfInt8>(x)));
+        sums[1] += static_cast<unsigned int>(std::abs(static_cast<sfInt8>(x - a)));
+        sums[2] += static_cast<unsigned int>(std::abs(static_cast<sfInt8>(x - b)));
+        sums[3] += static_cast<unsigned int>(std::abs(static_cast<sfInt8>(x - ((a + b) >> 1))));
+        sums[4] += static_cast<unsigned int>(std::abs(static_cast<sfInt8>(x - paeth(a, b, c))));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    inline sfUint8 applyFilter(unsigned int filter, int x, int a, int b, int c)
+    {
+        switch (filter)
+        {
+            case 1:  return static_cast<sfUint8>(x - a);
+            case 2:  return static_cast<sfUint8>(x - b);
+            case 3:  return static_cast<sfUint8>(x - ((a + b) >> 1));
+            case 4:  return static_cast<sfUint8>(x - paeth(a, b, c));
+            default: return static_cast<sfUint8>(x);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Filter a row with the filter that minimizes the sum of
+    // absolute differences, the usual heuristic of PNG encoders;
+    // \a previous is a row of zeros for the first row
+    ////////////////////////////////////////////////////////////
+    void filterRow(const sfUint8* row, const sfUint8* previous, std::size_t rowSize, sfUint8* output)
+    {
+        // The first pixel has no left neighbour
+        unsigned int sums[5] = {0, 0, 0, 0, 0};
+        for (std::size_t i = 0; i < 4; ++i)
+            addFilterCosts(row[i], 0, previous[i], 0, sums);
+        for (std::size_t i = 4; i < rowSize; ++i)
+            addFilterCosts(row[i], row[i - 4], previous[i], previous[i - 4], sums);
+
+        unsigned int filter = 0;
+        for (unsigned int i = 1; i < 5; ++i)
+        {
+            if (sums[i] < sums[filter])
+                filter = i;
+        }
+
+        output[0] = static_cast<sfUint8>(filter);
+        ++output;
+        for (std::size_t i = 0; i < 4; ++i)
+            output[i] = applyFilter(filter, row[i], 0, previous[i], 0);
+        for (std::size_t i = 4; i < rowSize; ++i)
+            output[i] = applyFilter(filter, row[i], row[i - 4], previous[i], previous[i - 4]);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    struct PngStripe
+    {
+        priv::ByteBuffer Data;     ///< Compressed data of the stripe
+        sfUint32         Adler;    ///< Checksum of the filtered data
+        std::size_t      Size;     ///< Size of the filtered data
+        sfUint32         Crc;      ///< CRC of the IDAT chunk of the stripe
+    };
+
+    struct PngJob
+    {
+        const sfUint8*                                      Pixels;
+        unsigned int                                        Width;
+        unsigned int                                        Height;
+        unsigned int                                        RowsPerStripe;
+        std::vector<PngStripe, priv::Allocator<PngStripe> > Stripes;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    void encodeStripes(std::size_t begin, std::size_t end, void* userData)
+    {
+        PngJob& job = *static_cast<PngJob*>(userData);
+        const Tables& tables = getTables();
+        std::size_t rowSize = static_cast<std::size_t>(job.Width) * 4;
+        priv::ByteBuffer filtered;
+        priv::ByteBuffer zeros(rowSize, 0);
+
+        for (std::size_t index = begin; index < end; ++index)
+        {
+            unsigned int first = static_cast<unsigned int>(index) * job.RowsPerStripe;
+            unsigned int last = std::min(first + job.RowsPerStripe, job.Height);
+
+            filtered.resize((last - first) * (rowSize + 1));
+            for (unsigned int y = first; y < last; ++y)
+            {
+                const sfUint8* row = job.Pixels + y * rowSize;
+                filterRow(row, (y > 0) ? row - rowSize : &zeros[0], rowSize, &filtered[(y - first) * (rowSize + 1)]);
+            }
+
+            PngStripe& stripe = job.Stripes[index];
+            stripe.Adler = adler32(&filtered[0], filtered.size());
+            stripe.Size = filtered.size();
+
+            // The first stripe starts the zlib stream: deflate, 32K window, fastest compression
+            if (index == 0)
+            {
+                stripe.Data.push_back(0x78);
+                stripe.Data.push_back(0x01);
+            }
+            deflate(&filtered[0], filtered.size(), last == job.Height, stripe.Data);
+
+            static const sfUint8 type[4] = {'I', 'D', 'A', 'T'};
+            stripe.Crc = updateCrc(tables, updateCrc(tables, 0, type, 4), &stripe.Data[0], stripe.Data.size());
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void put32BigEndian(priv::ByteBuffer& output, sfUint32 value)
+    {
+        output.push_back(static_cast<sfUint8>(value >> 24));
+        output.push_back(static_cast<sfUint8>(value >> 16));
+        output.push_back(static_cast<sfUint8>(value >> 8));
+        output.push_back(static_cast<sfUint8>(value));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void put16LittleEndian(priv::ByteBuffer& output, sfUint32 value)
+    {
+        output.push_back(static_cast<sfUint8>(value));
+        output.push_back(static_cast<sfUint8>(value >> 8));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void put32LittleEndian(priv::ByteBuffer& output, sfUint32 value)
+    {
+        put16LittleEndian(output, value & 0xFFFF);
+        put16LittleEndian(output, value >> 16);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void putChunk(priv::ByteBuffer& output, const char* type, const sfUint8* data, std::size_t size)
+    {
+        const Tables& tables = getTables();
+        put32BigEndian(output, static_cast<sfUint32>(size));
+        output.insert(output.end(), type, type + 4);
+        output.insert(output.end(), data, data + size);
+        sfUint32 crc = updateCrc(tables, 0, reinterpret_cast<const sfUint8*>(type), 4);
+        put32BigEndian(output, updateCrc(tables, crc, data, size));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void encodePng(const sfUint8* pixels, unsigned int width, unsigned int height, priv::ByteBuffer& output)
+    {
+        std::size_t rowSize = static_cast<std::size_t>(width) * 4 + 1;
+        unsigned int minRows = static_cast<unsigned int>(std::max<std::size_t>(1, (minStripeSize + rowSize - 1) / rowSize));
+
+        PngJob job;
+        job.Pixels = pixels;
+        job.Width = width;
+        job.Height = height;
+        job.RowsPerStripe = height;
+
+        // Only spread the work on the pool when there's more than one stripe
+        sfTaskPool* pool = NULL;
+        if (height > minRows)
+        {
+            pool = priv::getImagePool();
+            unsigned int stripeCount = sfTaskPool_getThreadCount(pool) * stripesPerThread;
+            job.RowsPerStripe = std::max(minRows, (height + stripeCount - 1) / stripeCount);
+        }
+
+        std::size_t stripeCount = (height + job.RowsPerStripe - 1) / job.RowsPerStripe;
+        job.Stripes.resize(stripeCount);
+        if (stripeCount > 1)
+            sfTaskPool_parallelFor(pool, 0, stripeCount, 1, &encodeStripes, &job);
+        else
+            encodeStripes(0, stripeCount, &job);
+
+        // Signature and header
+        output.insert(output.end(), pngSignature, pngSignature + 8);
+        priv::ByteBuffer header;
+        put32BigEndian(header, width);
+        put32BigEndian(header, height);
+        header.push_back(8); // bit depth
+        header.push_back(6); // color type: RGBA
+        header.push_back(0); // compression method
+        header.push_back(0); // filter method
+        header.push_back(0); // interlace method
+        putChunk(output, "IHDR", &header[0], header.size());
+
+        // Data of the stripes
+        std::size_t size = output.size() + 12 * (stripeCount + 2);
+        for (std::size_t i = 0; i < stripeCount; ++i)
+            size += job.Stripes[i].Data.size();
+        output.reserve(size + 4);
+
+        sfUint32 adler = 1;
+        for (std::size_t i = 0; i < stripeCount; ++i)
+        {
+            const PngStripe& stripe = job.Stripes[i];
+            put32BigEndian(output, static_cast<sfUint32>(stripe.Data.size()));
+            output.insert(output.end(), "IDAT", "IDAT" + 4);
+            output.insert(output.end(), stripe.Data.begin(), stripe.Data.end());
+            put32BigEndian(output, stripe.Crc);
+            adler = (i == 0) ? stripe.Adler : combineAdler32(adler, stripe.Adler, stripe.Size);
+        }
+
+        // End of the zlib stream
+        priv::ByteBuffer checksum;
+        put32BigEndian(checksum, adler);
+        putChunk(output, "IDAT", &checksum[0], checksum.size());
+        putChunk(output, "IEND", NULL, 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // QOI encoding and decoding, as described by the specification
+    // at https://qoiformat.org/qoi-specification.pdf
+    ////////////////////////////////////////////////////////////
+    const sfUint8 qoiOpIndex = 0x00;
+    const sfUint8 qoiOpDiff  = 0x40;
+    const sfUint8 qoiOpLuma  = 0x80;
+    const sfUint8 qoiOpRun   = 0xC0;
+    const sfUint8 qoiOpRgb   = 0xFE;
+    const sfUint8 qoiOpRgba  = 0xFF;
+    const sfUint8 qoiMask    = 0xC0;
+    const std::size_t qoiHeaderSize = 14;
+    const sfUint8 qoiPadding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    const sfUint64 qoiMaxPixels = 400000000;
+
+    struct QoiPixel
+    {
+        sfUint8 r, g, b, a;
+    };
+
+    inline bool operator ==(const QoiPixel& left, const QoiPixel& right)
+    {
+        return (left.r == right.r) && (left.g == right.g) && (left.b == right.b) && (left.a == right.a);
+    }
+
+    inline unsigned int qoiHash(const QoiPixel& pixel)
+    {
+        return (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void encodeQoi(const sfUint8* pixels, unsigned int width, unsigned int height, priv::ByteBuffer& output)
+    {
+        std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+        output.reserve(output.size() + qoiHeaderSize + pixelCount * 5 / 2 + sizeof(qoiPadding));
+
+        output.push_back('q');
+        output.push_back('o');
+        output.push_back('i');
+        output.push_back('f');
+        put32BigEndian(output, width);
+        put32BigEndian(output, height);
+        output.push_back(4); // channels: RGBA
+        output.push_back(0); // colorspace: sRGB with linear alpha
+
+        QoiPixel index[64];
+        std::memset(index, 0, sizeof(index));
+        QoiPixel previous = {0, 0, 0, 255};
+        unsigned int run = 0;
+
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            const sfUint8* source = pixels + i * 4;
+            QoiPixel pixel = {source[0], source[1], source[2], source[3]};
+
+            if (pixel == previous)
+            {
+                ++run;
+                if ((run == 62) || (i + 1 == pixelCount))
+                {
+                    output.push_back(static_cast<sfUint8>(qoiOpRun | (run - 1)));
+                    run = 0;
+                }
+                continue;
+            }
+
+            if (run > 0)
+            {
+                output.push_back(static_cast<sfUint8>(qoiOpRun | (run - 1)));
+                run = 0;
+            }
+
+            unsigned int hash = qoiHash(pixel);
+            if (index[hash] == pixel)
+            {
+                output.push_back(static_cast<sfUint8>(qoiOpIndex | hash));
+            }
+            else
+            {
+                index[hash] = pixel;
+
+                if (pixel.a == previous.a)
+                {
+                    int dr = static_cast<sfInt8>(pixel.r - previous.r);
+                    int dg = static_cast<sfInt8>(pixel.g - previous.g);
+                    int db = static_cast<sfInt8>(pixel.b - previous.b);
+                    int drg = dr - dg;
+                    int dbg = db - dg;
+
+                    if ((dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1))
+                    {
+                        output.push_back(static_cast<sfUint8>(qoiOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+                    }
+                    else if ((drg >= -8) && (drg <= 7) && (dg >= -32) && (dg <= 31) && (dbg >= -8) && (dbg <= 7))
+                    {
+                        output.push_back(static_cast<sfUint8>(qoiOpLuma | (dg + 32)));
+                        output.push_back(static_cast<sfUint8>(((drg + 8) << 4) | (dbg + 8)));
+                    }
+                    else
+                    {
+                        output.push_back(qoiOpRgb);
+                        output.push_back(pixel.r);
+                        output.push_back(pixel.g);
+                        output.push_back(pixel.b);
+                    }
+                }
+                else
+                {
+                    output.push_back(qoiOpRgba);
+                    output.push_back(pixel.r);
+                    output.push_back(pixel.g);
+                    output.push_back(pixel.b);
+                    output.push_back(pixel.a);
+                }
+            }
+
+            previous = pixel;
+        }
+
+        output.insert(output.end(), qoiPadding, qoiPadding + sizeof(qoiPadding));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Uncompressed BMP, with a version 4 header so that the alpha
+    // channel is kept
+    ////////////////////////////////////////////////////////////
+    bool encodeBmp(const sfUint8* pixels, unsigned int width, unsigned int height, priv::ByteBuffer& output)
+    {
+        const sfUint32 headerSize = 14 + 108;
+        if ((width > 0x7FFFFFFF) || (height > 0x7FFFFFFF) || (static_cast<sfUint64>(width) * height * 4 > 0xFFFFFFFFu - headerSize))
+            return false;
+
+        sfUint32 dataSize = width * height * 4;
+        output.reserve(output.size() + headerSize + dataSize);
+
+        // File header
+        output.push_back('B');
+        output.push_back('M');
+        put32LittleEndian(output, headerSize + dataSize);
+        put32LittleEndian(output, 0);
+        put32LittleEndian(output, headerSize);
+
+        // BITMAPV4HEADER
+        put32LittleEndian(output, 108);
+        put32LittleEndian(output, width);
+        put32LittleEndian(output, height); // positive: rows are stored bottom-up
+        put16LittleEndian(output, 1);      // planes
+        put16LittleEndian(output, 32);     // bits per pixel
+        put32LittleEndian(output, 3);      // BI_BITFIELDS
+        put32LittleEndian(output, dataSize);
+        put32LittleEndian(output, 2835);   // 72 DPI
+        put32LittleEndian(output, 2835);
+        put32LittleEndian(output, 0);
+        put32LittleEndian(output, 0);
+        put32LittleEndian(output, 0x00FF0000); // red mask
+        put32LittleEndian(output, 0x0000FF00); // green mask
+        put32LittleEndian(output, 0x000000FF); // blue mask
+        put32LittleEndian(output, 0xFF000000); // alpha mask
+        put32LittleEndian(output, 0x73524742); // LCS_sRGB
+        output.insert(output.end(), 36 + 12, 0); // endpoints and gamma, unused with sRGB
+
+        for (unsigned int y = height; y > 0; --y)
+        {
+            const sfUint8* row = pixels + static_cast<std::size_t>(y - 1) * width * 4;
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                const sfUint8* pixel = row + x * 4;
+                output.push_back(pixel[2]);
+                output.push_back(pixel[1]);
+                output.push_back(pixel[0]);
+                output.push_back(pixel[3]);
+            }
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Uncompressed true-color TGA, top-left origin
+    ////////////////////////////////////////////////////////////
+    bool encodeTga(const sfUint8* pixels, unsigned int width, unsigned int height, priv::ByteBuffer& output)
+    {
+        if ((width > 0xFFFF) || (height > 0xFFFF))
+            return false;
+
+        std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+        output.reserve(output.size() + 18 + pixelCount * 4);
+
+        output.push_back(0); // ID length
+        output.push_back(0); // no color map
+        output.push_back(2); // uncompressed true-color
+        output.insert(output.end(), 5, 0); // color map specification
+        put16LittleEndian(output, 0); // origin
+        put16LittleEndian(output, 0);
+        put16LittleEndian(output, width);
+        put16LittleEndian(output, height);
+        output.push_back(32);   // bits per pixel
+        output.push_back(0x28); // 8 bits of alpha, top-left origin
+
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            const sfUint8* pixel = pixels + i * 4;
+            output.push_back(pixel[2]);
+            output.push_back(pixel[1]);
+            output.push_back(pixel[0]);
+            output.push_back(pixel[3]);
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Owns the task pool shared by all images
+    ////////////////////////////////////////////////////////////
+    struct ImagePool
+    {
+        ImagePool() :
+        Pool(sfTaskPool_create(0))
+        {
+        }
+
+        ~ImagePool()
+        {
+            sfTaskPool_destroy(Pool);
+        }
+
+        sfTaskPool* Pool;
+    };
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    bool getImageFormat(const char* filename, sfImageFormat& format)
+    {
+        std::string name(filename);
+        std::string::size_type dot = name.rfind('.');
+        if (dot == std::string::npos)
+            return false;
+
+        std::string extension = name.substr(dot + 1);
+        for (std::string::iterator it = extension.begin(); it != extension.end(); ++it)
+            *it = static_cast<char>(std::tolower(static_cast<unsigned char>(*it)));
+
+        if (extension == "png")
+            format = sfImageFormatPng;
+        else if (extension == "qoi")
+            format = sfImageFormatQoi;
+        else if (extension == "bmp")
+            format = sfImageFormatBmp;
+        else if (extension == "tga")
+            format = sfImageFormatTga;
+        else
+            return false;
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool encodeImage(const sfUint8* pixels, unsigned int width, unsigned int height, sfImageFormat format, ByteBuffer& output)
+    {
+        if (!pixels || (width == 0) || (height == 0))
+            return false;
+
+        switch (format)
+        {
+            case sfImageFormatPng: encodePng(pixels, width, height, output); return true;
+            case sfImageFormatQoi: encodeQoi(pixels, width, height, output); return true;
+            case sfImageFormatBmp: return encodeBmp(pixels, width, height, output);
+            case sfImageFormatTga: return encodeTga(pixels, width, height, output);
+            default:               return false;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool writeImageFile(const char* filename, const ByteBuffer& data)
+    {
+        std::FILE* file = std::fopen(filename, "wb");
+        if (!file)
+            return false;
+
+        bool ok = data.empty() || (std::fwrite(&data[0], 1, data.size(), file) == data.size());
+        ok = (std::fclose(file) == 0) && ok;
+
+        if (!ok)
+            std::remove(filename);
+
+        return ok;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isQoi(const void* data, std::size_t size)
+    {
+        return data && (size >= qoiHeaderSize) && (std::memcmp(data, "qoif", 4) == 0);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool decodeQoi(const void* data, std::size_t size, sf::Image& image)
+    {
+        if (!isQoi(data, size))
+            return false;
+
+        const sfUint8* bytes = static_cast<const sfUint8*>(data);
+        sfUint32 width = (static_cast<sfUint32>(bytes[4]) << 24) | (bytes[5] << 16) | (bytes[6] << 8) | bytes[7];
+        sfUint32 height = (static_cast<sfUint32>(bytes[8]) << 24) | (bytes[9] << 16) | (bytes[10] << 8) | bytes[11];
+        sfUint8 channels = bytes[12];
+        if ((width == 0) || (height == 0) || (static_cast<sfUint64>(width) * height > qoiMaxPixels) || ((channels != 3) && (channels != 4)))
+            return false;
+
+        std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+        ByteBuffer pixels(pixelCount * 4);
+
+        QoiPixel index[64];
+        std::memset(index, 0, sizeof(index));
+        QoiPixel pixel = {0, 0, 0, 255};
+        unsigned int run = 0;
+        std::size_t position = qoiHeaderSize;
+        std::size_t end = size - sizeof(qoiPadding);
+
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            if (run > 0)
+            {
+                --run;
+            }
+            else if (position < end)
+            {
+                sfUint8 op = bytes[position++];
+
+                if (op == qoiOpRgb)
+                {
+                    if (position + 3 > size)
+                        return false;
+                    pixel.r = bytes[position++];
+                    pixel.g = bytes[position++];
+                    pixel.b = bytes[position++];
+                }
+                else if (op == qoiOpRgba)
+                {
+                    if (position + 4 > size)
+                        return false;
+                    pixel.r = bytes[position++];
+                    pixel.g = bytes[position++];
+                    pixel.b = bytes[position++];
+                    pixel.a = bytes[position++];
+                }
+                else if ((op & qoiMask) == qoiOpIndex)
+                {
+                    pixel = index[op];
+                }
+                else if ((op & qoiMask) == qoiOpDiff)
+                {
+                    pixel.r = static_cast<sfUint8>(pixel.r + ((op >> 4) & 0x03) - 2);
+                    pixel.g = static_cast<sfUint8>(pixel.g + ((op >> 2) & 0x03) - 2);
+                    pixel.b = static_cast<sfUint8>(pixel.b + (op & 0x03) - 2);
+                }
+                else if ((op & qoiMask) == qoiOpLuma)
+                {
+                    if (position + 1 > size)
+                        return false;
+                    sfUint8 second = bytes[position++];
+                    int dg = (op & 0x3F) - 32;
+                    pixel.r = static_cast<sfUint8>(pixel.r + dg - 8 + ((second >> 4) & 0x0F));
+                    pixel.g = static_cast<sfUint8>(pixel.g + dg);
+                    pixel.b = static_cast<sfUint8>(pixel.b + dg - 8 + (second & 0x0F));
+                }
+                else
+                {
+                    run = op & 0x3F;
+                }
+
+                index[qoiHash(pixel)] = pixel;
+            }
+            else
+            {
+                // Truncated data
+                return false;
+            }
+
+            sfUint8* destination = &pixels[i * 4];
+            destination[0] = pixel.r;
+            destination[1] = pixel.g;
+            destination[2] = pixel.b;
+            destination[3] = pixel.a;
+        }
+
+        image.create(width, height, &pixels[0]);
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTaskPool* getImagePool()
+    {
+        static ImagePool pool;
+        return pool.Pool;
+    }
+}
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_IMAGECODEC_HPP
+#define SFML_IMAGECODEC_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.h>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
+#include <cstddef>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Bytes allocated with the functions passed to sfSetAllocator
+    ////////////////////////////////////////////////////////////
+    typedef std::vector<sfUint8, Allocator<sfUint8> > ByteBuffer;
+
+    ////////////////////////////////////////////////////////////
+    // Find the format to encode from the extension of a file name;
+    // returns false for formats that are left to SFML (jpg) or unknown
+    ////////////////////////////////////////////////////////////
+    bool getImageFormat(const char* filename, sfImageFormat& format);
+
+    ////////////////////////////////////////////////////////////
+    // Encode RGBA pixels; large PNG images are filtered and
+    // compressed in parallel by the tasks of the image pool
+    ////////////////////////////////////////////////////////////
+    bool encodeImage(const sfUint8* pixels, unsigned int width, unsigned int height, sfImageFormat format, ByteBuffer& output);
+
+    ////////////////////////////////////////////////////////////
+    // Write an encoded image to a file
+    ////////////////////////////////////////////////////////////
+    bool writeImageFile(const char* filename, const ByteBuffer& data);
+
+    ////////////////////////////////////////////////////////////
+    // Check whether data starts with the QOI signature
+    ////////////////////////////////////////////////////////////
+    bool isQoi(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    // Decode a QOI image, which SFML can't load
+    ////////////////////////////////////////////////////////////
+    bool decodeQoi(const void* data, std::size_t size, sf::Image& image);
+
+    ////////////////////////////////////////////////////////////
+    // Get the task pool shared by all images, created on first use
+    ////////////////////////////////////////////////////////////
+    sfTaskPool* getImagePool();
+}
+
+
+#endif // SFML_IMAGECODEC_HPP
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfImage
 ////////////////////////////////////////////////////////////
-struct sfImage
+struct sfImage : public priv::Allocated
 {
     sf::Image This;
 };
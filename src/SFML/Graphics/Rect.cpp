@@ -28,6 +28,12 @@
 #include <SFML/Graphics/Rect.h>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Internal.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define CSFML_RECT_SSE2
+#endif
 
 
 ////////////////////////////////////////////////////////////
@@ -45,6 +51,61 @@ sfBool sfIntRect_contains(const sfIntRect* rect, int x, int y)
 }
 
 
+////////////////////////////////////////////////////////////
+/// Check which points of an array are inside a rectangle's area
+////////////////////////////////////////////////////////////
+size_t sfFloatRect_containsPoints(const sfFloatRect* rect, const sfVector2f* points, size_t count, sfBool* results)
+{
+    CSFML_CHECK_RETURN(rect, 0);
+    CSFML_CHECK_RETURN(points, 0);
+    CSFML_CHECK_RETURN(results, 0);
+
+    // Same bounds as sf::Rect::contains, so that rectangles with negative dimensions work too
+    float minX = std::min(rect->left, rect->left + rect->width);
+    float maxX = std::max(rect->left, rect->left + rect->width);
+    float minY = std::min(rect->top, rect->top + rect->height);
+    float maxY = std::max(rect->top, rect->top + rect->height);
+
+    size_t inside = 0;
+    size_t i = 0;
+
+#ifdef CSFML_RECT_SSE2
+    // Four points per iteration
+    const __m128 left   = _mm_set1_ps(minX);
+    const __m128 right  = _mm_set1_ps(maxX);
+    const __m128 top    = _mm_set1_ps(minY);
+    const __m128 bottom = _mm_set1_ps(maxY);
+    const __m128i one   = _mm_set1_epi32(1);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 first  = _mm_loadu_ps(&points[i].x);
+        __m128 second = _mm_loadu_ps(&points[i + 2].x);
+        __m128 x = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m128 mask = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, left), _mm_cmplt_ps(x, right)),
+                                 _mm_and_ps(_mm_cmpge_ps(y, top), _mm_cmplt_ps(y, bottom)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(results + i), _mm_and_si128(_mm_castps_si128(mask), one));
+
+        int bits = _mm_movemask_ps(mask);
+        inside += static_cast<size_t>((bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        float x = points[i].x;
+        float y = points[i].y;
+        results[i] = (x >= minX) && (x < maxX) && (y >= minY) && (y < maxY);
+        inside += results[i];
+    }
+
+    return inside;
+}
+
+
 ////////////////////////////////////////////////////////////
 /// Check intersection between two rectangles
 ////////////////////////////////////////////////////////////
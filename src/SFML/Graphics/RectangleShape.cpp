@@ -55,6 +55,42 @@ void sfRectangleShape_destroy(sfRectangleShape* shape)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfRectangleShape_sizeof(void)
+{
+    return sizeof(sfRectangleShape);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfRectangleShape_alignof(void)
+{
+    return alignof(sfRectangleShape);
+}
+
+
+////////////////////////////////////////////////////////////
+sfRectangleShape* sfRectangleShape_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfRectangleShape)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfRectangleShape_init is not suitably aligned");
+        return NULL;
+    }
+
+    return new (memory) sfRectangleShape;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRectangleShape_deinit(sfRectangleShape* shape)
+{
+    if (shape)
+        shape->~sfRectangleShape();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRectangleShape_setPosition(sfRectangleShape* shape, sfVector2f position)
 {
@@ -31,12 +31,13 @@
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRectangleShape
 ////////////////////////////////////////////////////////////
-struct sfRectangleShape
+struct sfRectangleShape : public priv::Pooled<sfRectangleShape>
 {
     sf::RectangleShape  This;
     const sfTexture*    Texture;
@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderTexture.h>
 #include <SFML/Graphics/RenderTextureStruct.h>
+#include <SFML/Graphics/TextureReadbackStruct.h>
 #include <SFML/Graphics/SpriteStruct.h>
 #include <SFML/Graphics/TextStruct.h>
 #include <SFML/Graphics/ShapeStruct.h>
@@ -37,6 +38,7 @@
 #include <SFML/Graphics/VertexBufferStruct.h>
 #include <SFML/Graphics/ConvertRenderStates.hpp>
 #include <SFML/Internal.h>
+#include <SFML/ProfileZone.h>
 #include <SFML/Window/ContextSettingsInternal.h>
 
 
@@ -45,7 +47,9 @@ sfRenderTexture* sfRenderTexture_create(unsigned int width, unsigned int height,
 {
     sfRenderTexture* renderTexture = new sfRenderTexture;
     renderTexture->This.create(width, height, depthBuffer == sfTrue);
-    renderTexture->Target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.getTexture()));
+    sfTexture* target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.getTexture()));
+    target->Flipped = true;
+    renderTexture->Target = target;
     renderTexture->DefaultView.This = renderTexture->This.getDefaultView();
     renderTexture->CurrentView.This = renderTexture->This.getView();
 
@@ -66,7 +70,9 @@ sfRenderTexture* sfRenderTexture_createWithSettings(unsigned int width, unsigned
     // Create the render texture
     sfRenderTexture* renderTexture = new sfRenderTexture;
     renderTexture->This.create(width, height, params);
-    renderTexture->Target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.getTexture()));
+    sfTexture* target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.getTexture()));
+    target->Flipped = true;
+    renderTexture->Target = target;
     renderTexture->DefaultView.This = renderTexture->This.getDefaultView();
     renderTexture->CurrentView.This = renderTexture->This.getView();
 
@@ -106,6 +112,8 @@ sfBool sfRenderTexture_setActive(sfRenderTexture* renderTexture, sfBool active)
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_display(sfRenderTexture* renderTexture)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_display");
+
     CSFML_CALL(renderTexture, display());
 }
 
@@ -204,41 +212,57 @@ sfVector2i sfRenderTexture_mapCoordsToPixel(const sfRenderTexture* renderTexture
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_drawSprite(sfRenderTexture* renderTexture, const sfSprite* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawSprite");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawText(sfRenderTexture* renderTexture, const sfText* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawText");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawShape(sfRenderTexture* renderTexture, const sfShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawCircleShape(sfRenderTexture* renderTexture, const sfCircleShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawCircleShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawConvexShape(sfRenderTexture* renderTexture, const sfConvexShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawConvexShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawRectangleShape(sfRenderTexture* renderTexture, const sfRectangleShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawRectangleShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawVertexArray(sfRenderTexture* renderTexture, const sfVertexArray* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawVertexArray");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderTexture_drawVertexBuffer(sfRenderTexture* renderTexture, const sfVertexBuffer* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawVertexBuffer");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderTexture, draw(object->This, convertRenderStates(states)));
 }
@@ -249,6 +273,8 @@ void sfRenderTexture_drawPrimitives(sfRenderTexture* renderTexture,
                                     const sfVertex* vertices, size_t vertexCount,
                                     sfPrimitiveType type, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderTexture_drawPrimitives");
+
     CSFML_CALL(renderTexture, draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount,
                static_cast<sf::PrimitiveType>(type), convertRenderStates(states)));
 }
@@ -284,6 +310,15 @@ const sfTexture* sfRenderTexture_getTexture(const sfRenderTexture* renderTexture
 }
 
 
+////////////////////////////////////////////////////////////
+sfTextureReadback* sfRenderTexture_readbackAsync(const sfRenderTexture* renderTexture)
+{
+    CSFML_CHECK_RETURN(renderTexture, NULL);
+
+    return priv::readbackTexture(renderTexture->This.getTexture(), true);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_setSmooth(sfRenderTexture* renderTexture, sfBool smooth)
 {
@@ -0,0 +1,394 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.h>
+#include <SFML/Graphics/RenderTexturePoolStruct.h>
+#include <SFML/Graphics/RenderTextureStruct.h>
+#include <SFML/Graphics/RenderTexture.h>
+#include <SFML/Window/ContextSettingsInternal.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    sfRenderTextureKey getKey(unsigned int width, unsigned int height, const sfContextSettings* settings)
+    {
+        sfRenderTextureKey key;
+        key.Width  = width;
+        key.Height = height;
+
+        // Same defaults as sfRenderTexture_createWithSettings
+        if (settings)
+            key.Settings = *settings;
+        else
+            priv::sfContextSettings_readFromCpp(sf::ContextSettings(), key.Settings);
+
+        return key;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isSameKey(const sfRenderTextureKey& left, const sfRenderTextureKey& right)
+    {
+        return (left.Width == right.Width) &&
+               (left.Height == right.Height) &&
+               (left.Settings.depthBits == right.Settings.depthBits) &&
+               (left.Settings.stencilBits == right.Settings.stencilBits) &&
+               (left.Settings.antialiasingLevel == right.Settings.antialiasingLevel) &&
+               (left.Settings.majorVersion == right.Settings.majorVersion) &&
+               (left.Settings.minorVersion == right.Settings.minorVersion) &&
+               (left.Settings.attributeFlags == right.Settings.attributeFlags) &&
+               ((left.Settings.sRgbCapable == sfTrue) == (right.Settings.sRgbCapable == sfTrue));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Estimate the video memory of a render texture
+    ////////////////////////////////////////////////////////////
+    std::size_t getMemorySize(const sfRenderTextureKey& key)
+    {
+        std::size_t pixels  = static_cast<std::size_t>(key.Width) * key.Height;
+        std::size_t samples = (key.Settings.antialiasingLevel > 0) ? key.Settings.antialiasingLevel : 1;
+
+        // RGBA texture
+        std::size_t memory = pixels * 4;
+
+        // Multisampled render textures draw to a renderbuffer, resolved into the texture
+        if (key.Settings.antialiasingLevel > 0)
+            memory += pixels * samples * 4;
+
+        // Depth and stencil share a buffer when both are requested
+        memory += pixels * samples * ((key.Settings.depthBits + key.Settings.stencilBits + 7) / 8);
+
+        return memory;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Same as sfRenderTexture_createWithSettings, but failures are reported
+    ////////////////////////////////////////////////////////////
+    sfRenderTexture* createRenderTexture(const sfRenderTextureKey& key)
+    {
+        sf::ContextSettings settings;
+        priv::sfContextSettings_writeToCpp(key.Settings, settings);
+
+        sfRenderTexture* renderTexture = new sfRenderTexture;
+        if (!renderTexture->This.create(key.Width, key.Height, settings))
+        {
+            delete renderTexture;
+            return NULL;
+        }
+
+        sfTexture* target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.getTexture()));
+        target->Flipped = true;
+        renderTexture->Target = target;
+        renderTexture->DefaultView.This = renderTexture->This.getDefaultView();
+        renderTexture->CurrentView.This = renderTexture->This.getView();
+
+        return renderTexture;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void destroyTarget(sfRenderTexturePool& pool, std::size_t index)
+    {
+        pool.Memory -= pool.Targets[index].Memory;
+        sfRenderTexture_destroy(pool.Targets[index].Target);
+
+        pool.Targets[index] = pool.Targets.back();
+        pool.Targets.pop_back();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfRenderTexture* acquireTarget(sfRenderTexturePool& pool, const sfRenderTextureKey& key)
+    {
+        for (std::vector<sfPooledRenderTexture, priv::Allocator<sfPooledRenderTexture> >::iterator it = pool.Targets.begin(); it != pool.Targets.end(); ++it)
+        {
+            if (!it->Acquired && isSameKey(it->Key, key))
+            {
+                // The previous user may have changed the view
+                sfRenderTexture* renderTexture = it->Target;
+                renderTexture->This.setView(renderTexture->This.getDefaultView());
+                renderTexture->CurrentView.This = renderTexture->This.getView();
+
+                it->Acquired  = true;
+                it->LastFrame = pool.Frame;
+                return renderTexture;
+            }
+        }
+
+        sfPooledRenderTexture pooled;
+        pooled.Target = createRenderTexture(key);
+        if (!pooled.Target)
+            return NULL;
+
+        pooled.Key       = key;
+        pooled.Memory    = getMemorySize(key);
+        pooled.Acquired  = true;
+        pooled.LastFrame = pool.Frame;
+        pool.Targets.push_back(pooled);
+        pool.Memory += pooled.Memory;
+
+        return pooled.Target;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Render texture shared by transient targets with disjoint lifetimes
+    ////////////////////////////////////////////////////////////
+    struct TransientSlot
+    {
+        sfRenderTextureKey Key;      ///< Size and settings of the render texture
+        unsigned int       LastPass; ///< Last pass of the last target assigned to the slot
+        sfRenderTexture*   Target;   ///< Render texture of the slot
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Order of transient targets by first pass
+    ////////////////////////////////////////////////////////////
+    struct EarlierFirstPass
+    {
+        const std::vector<sfRenderTextureTransient, priv::Allocator<sfRenderTextureTransient> >& Transients;
+
+        bool operator ()(std::size_t left, std::size_t right) const
+        {
+            return Transients[left].FirstPass < Transients[right].FirstPass;
+        }
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // The lifetimes of the transient targets form an interval
+    // graph; visiting them by first pass and reusing any slot
+    // whose last target has ended colors it with the minimum
+    // number of render textures
+    ////////////////////////////////////////////////////////////
+    void assignTransients(sfRenderTexturePool& pool)
+    {
+        std::vector<std::size_t> order(pool.Transients.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        EarlierFirstPass earlierFirstPass = {pool.Transients};
+        std::stable_sort(order.begin(), order.end(), earlierFirstPass);
+
+        std::vector<TransientSlot> slots;
+        for (std::vector<std::size_t>::const_iterator it = order.begin(); it != order.end(); ++it)
+        {
+            sfRenderTextureTransient& transient = pool.Transients[*it];
+
+            std::size_t slot = 0;
+            while ((slot < slots.size()) && !(isSameKey(slots[slot].Key, transient.Key) && (slots[slot].LastPass < transient.FirstPass)))
+                ++slot;
+
+            if (slot == slots.size())
+            {
+                TransientSlot newSlot;
+                newSlot.Key    = transient.Key;
+                newSlot.Target = acquireTarget(pool, transient.Key);
+                slots.push_back(newSlot);
+            }
+
+            slots[slot].LastPass = transient.LastPass;
+            transient.Target = slots[slot].Target;
+        }
+
+        pool.Assigned = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfRenderTexturePool* sfRenderTexturePool_create(void)
+{
+    sfRenderTexturePool* pool = new sfRenderTexturePool;
+    pool->Assigned      = false;
+    pool->Frame         = 0;
+    pool->MaxIdleFrames = 3;
+    pool->MemoryBudget  = 0;
+    pool->Memory        = 0;
+
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_destroy(sfRenderTexturePool* pool)
+{
+    if (!pool)
+        return;
+
+    for (std::vector<sfPooledRenderTexture, priv::Allocator<sfPooledRenderTexture> >::iterator it = pool->Targets.begin(); it != pool->Targets.end(); ++it)
+        sfRenderTexture_destroy(it->Target);
+
+    delete pool;
+}
+
+
+////////////////////////////////////////////////////////////
+sfRenderTexture* sfRenderTexturePool_acquire(sfRenderTexturePool* pool, unsigned int width, unsigned int height, const sfContextSettings* settings)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+
+    return acquireTarget(*pool, getKey(width, height, settings));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_release(sfRenderTexturePool* pool, sfRenderTexture* renderTexture)
+{
+    CSFML_CHECK(pool);
+
+    for (std::vector<sfPooledRenderTexture, priv::Allocator<sfPooledRenderTexture> >::iterator it = pool->Targets.begin(); it != pool->Targets.end(); ++it)
+    {
+        if (it->Target == renderTexture)
+        {
+            it->Acquired = false;
+            return;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_endFrame(sfRenderTexturePool* pool)
+{
+    CSFML_CHECK(pool);
+
+    for (std::vector<sfPooledRenderTexture, priv::Allocator<sfPooledRenderTexture> >::iterator it = pool->Targets.begin(); it != pool->Targets.end(); ++it)
+        it->Acquired = false;
+
+    pool->Transients.clear();
+    pool->Assigned = false;
+    ++pool->Frame;
+
+    for (std::size_t i = pool->Targets.size(); i-- > 0;)
+    {
+        if (pool->Frame - pool->Targets[i].LastFrame > pool->MaxIdleFrames)
+            destroyTarget(*pool, i);
+    }
+
+    while ((pool->MemoryBudget > 0) && (pool->Memory > pool->MemoryBudget) && !pool->Targets.empty())
+    {
+        std::size_t oldest = 0;
+        for (std::size_t i = 1; i < pool->Targets.size(); ++i)
+        {
+            if (pool->Targets[i].LastFrame < pool->Targets[oldest].LastFrame)
+                oldest = i;
+        }
+
+        destroyTarget(*pool, oldest);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_trim(sfRenderTexturePool* pool)
+{
+    CSFML_CHECK(pool);
+
+    for (std::size_t i = pool->Targets.size(); i-- > 0;)
+    {
+        if (!pool->Targets[i].Acquired)
+            destroyTarget(*pool, i);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_setMaxIdleFrames(sfRenderTexturePool* pool, unsigned int maxFrames)
+{
+    CSFML_CHECK(pool);
+
+    pool->MaxIdleFrames = maxFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexturePool_setMemoryBudget(sfRenderTexturePool* pool, size_t budget)
+{
+    CSFML_CHECK(pool);
+
+    pool->MemoryBudget = budget;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfRenderTexturePool_getMemoryUsage(const sfRenderTexturePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    return pool->Memory;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfRenderTexturePool_getTargetCount(const sfRenderTexturePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    return pool->Targets.size();
+}
+
+
+////////////////////////////////////////////////////////////
+int sfRenderTexturePool_addTransient(sfRenderTexturePool* pool, unsigned int width, unsigned int height, const sfContextSettings* settings, unsigned int firstPass, unsigned int lastPass)
+{
+    CSFML_CHECK_RETURN(pool, -1);
+
+    if (pool->Assigned)
+        return -1;
+
+    sfRenderTextureTransient transient;
+    transient.Key       = getKey(width, height, settings);
+    transient.FirstPass = std::min(firstPass, lastPass);
+    transient.LastPass  = std::max(firstPass, lastPass);
+    transient.Target    = NULL;
+    pool->Transients.push_back(transient);
+
+    return static_cast<int>(pool->Transients.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+sfRenderTexture* sfRenderTexturePool_getTransient(sfRenderTexturePool* pool, int transient)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+
+    if ((transient < 0) || (static_cast<std::size_t>(transient) >= pool->Transients.size()))
+        return NULL;
+
+    if (!pool->Assigned)
+        assignTransients(*pool);
+
+    return pool->Transients[transient].Target;
+}
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RENDERTEXTUREPOOLSTRUCT_H
+#define SFML_RENDERTEXTUREPOOLSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.h>
+#include <SFML/ObjectAllocator.h>
+#include <vector>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Size and settings that render textures must share to be
+// interchangeable
+////////////////////////////////////////////////////////////
+struct sfRenderTextureKey
+{
+    unsigned int      Width;
+    unsigned int      Height;
+    sfContextSettings Settings;
+};
+
+
+////////////////////////////////////////////////////////////
+// Render texture owned by a pool
+////////////////////////////////////////////////////////////
+struct sfPooledRenderTexture
+{
+    sfRenderTexture*   Target;    ///< Render texture
+    sfRenderTextureKey Key;       ///< Size and settings of the render texture
+    std::size_t        Memory;    ///< Estimated video memory of the render texture, in bytes
+    bool               Acquired;  ///< Whether the render texture is in use
+    sfUint64           LastFrame; ///< Last frame where the render texture was acquired
+};
+
+
+////////////////////////////////////////////////////////////
+// Transient target declared for the current frame
+////////////////////////////////////////////////////////////
+struct sfRenderTextureTransient
+{
+    sfRenderTextureKey Key;       ///< Size and settings of the target
+    unsigned int       FirstPass; ///< First pass that uses the target
+    unsigned int       LastPass;  ///< Last pass that uses the target
+    sfRenderTexture*   Target;    ///< Render texture assigned to the target
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfRenderTexturePool
+////////////////////////////////////////////////////////////
+struct sfRenderTexturePool : public priv::Allocated
+{
+    std::vector<sfPooledRenderTexture, priv::Allocator<sfPooledRenderTexture> >       Targets;       ///< All the render textures of the pool
+    std::vector<sfRenderTextureTransient, priv::Allocator<sfRenderTextureTransient> > Transients;    ///< Transient targets of the current frame
+    bool                                                                              Assigned;      ///< Whether render textures are assigned to the transient targets
+    sfUint64                                                                          Frame;         ///< Index of the current frame
+    unsigned int                                                                      MaxIdleFrames; ///< Number of frames a free render texture is kept
+    std::size_t                                                                       MemoryBudget;  ///< Memory budget, 0 for no budget
+    std::size_t                                                                       Memory;        ///< Estimated video memory of all the render textures
+};
+
+
+#endif // SFML_RENDERTEXTUREPOOLSTRUCT_H
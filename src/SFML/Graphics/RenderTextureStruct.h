@@ -31,12 +31,13 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/ViewStruct.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRenderTexture
 ////////////////////////////////////////////////////////////
-struct sfRenderTexture
+struct sfRenderTexture : public priv::Allocated
 {
     sf::RenderTexture This;
     const sfTexture*  Target;
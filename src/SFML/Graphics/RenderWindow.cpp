@@ -27,6 +27,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderWindow.h>
 #include <SFML/Graphics/RenderWindowStruct.h>
+#include <SFML/Graphics/TextureReadbackStruct.h>
 #include <SFML/Graphics/ImageStruct.h>
 #include <SFML/Graphics/SpriteStruct.h>
 #include <SFML/Graphics/TextStruct.h>
@@ -42,6 +43,29 @@
 #include <SFML/Window/ContextSettingsInternal.h>
 #include <SFML/Window/CursorStruct.h>
 #include <SFML/ConvertEvent.h>
+#include <SFML/EventQueue.h>
+#include <SFML/ProfileZone.h>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Update the viewport of a render window after it was resized;
+    // windows with an input thread leave it to the thread that
+    // renders, which calls this for the events it pops
+    ////////////////////////////////////////////////////////////
+    void applyResize(sfRenderWindow& renderWindow, const sfEvent* events, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (events[i].type == sfEvtResized)
+            {
+                renderWindow.This.applyResize();
+                return;
+            }
+        }
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -109,9 +133,44 @@ sfRenderWindow* sfRenderWindow_createFromHandle(sfWindowHandle handle, const sfC
 }
 
 
+////////////////////////////////////////////////////////////
+sfRenderWindow* sfRenderWindow_createWithEventQueue(sfVideoMode mode, const char* title, sfUint32 style, const sfContextSettings* settings)
+{
+    // Convert video mode
+    sf::VideoMode videoMode(mode.width, mode.height, mode.bitsPerPixel);
+
+    // Convert context settings
+    sf::ContextSettings params;
+    if (settings)
+    {
+        priv::sfContextSettings_writeToCpp(*settings, params);
+    }
+
+    // Create the window in its input thread; the view is updated
+    // after a resize by the thread that renders, when it pops the event
+    sfRenderWindow* renderWindow = new sfRenderWindow;
+    renderWindow->This.setDeferredResize(true);
+    renderWindow->Events = new priv::EventQueue(renderWindow->This);
+    if (!renderWindow->Events->start(videoMode, title, style, params))
+    {
+        sfRenderWindow_destroy(renderWindow);
+        return NULL;
+    }
+
+    renderWindow->DefaultView.This = renderWindow->This.getDefaultView();
+    renderWindow->CurrentView.This = renderWindow->This.getView();
+
+    return renderWindow;
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_destroy(sfRenderWindow* renderWindow)
 {
+    // Stops the input thread, and waits until a consumer blocked in waitEvent has returned
+    if (renderWindow)
+        delete renderWindow->Events;
+
     delete renderWindow;
 }
 
@@ -119,7 +178,12 @@ void sfRenderWindow_destroy(sfRenderWindow* renderWindow)
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_close(sfRenderWindow* renderWindow)
 {
-    CSFML_CALL(renderWindow, close());
+    CSFML_CHECK(renderWindow);
+
+    if (renderWindow->Events)
+        renderWindow->Events->close();
+    else
+        renderWindow->This.close();
 }
 
 
@@ -146,9 +210,23 @@ sfContextSettings sfRenderWindow_getSettings(const sfRenderWindow* renderWindow)
 ////////////////////////////////////////////////////////////
 sfBool sfRenderWindow_pollEvent(sfRenderWindow* renderWindow, sfEvent* event)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_pollEvent");
+
     CSFML_CHECK_RETURN(renderWindow, sfFalse);
     CSFML_CHECK_RETURN(event,        sfFalse);
 
+    // Events of windows with an event queue go through it
+    if (renderWindow->Events)
+    {
+        sfTimedEvent timedEvent;
+        if (!renderWindow->Events->pop(timedEvent))
+            return sfFalse;
+
+        *event = timedEvent.event;
+        applyResize(*renderWindow, event, 1);
+        return sfTrue;
+    }
+
     // Get the event
     sf::Event SFMLEvent;
     sfBool ret = renderWindow->This.pollEvent(SFMLEvent);
@@ -164,12 +242,61 @@ sfBool sfRenderWindow_pollEvent(sfRenderWindow* renderWindow, sfEvent* event)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfRenderWindow_pollEvents(sfRenderWindow* renderWindow, sfEvent* events, size_t capacity)
+{
+    CSFML_PROFILE_ZONE("sfRenderWindow_pollEvents");
+
+    CSFML_CHECK_RETURN(renderWindow, 0);
+    CSFML_CHECK_RETURN(events, 0);
+
+    if (renderWindow->Events)
+    {
+        std::size_t count = renderWindow->Events->pop(events, capacity, false);
+        applyResize(*renderWindow, events, count);
+        return count;
+    }
+
+    return pollEvents(renderWindow->This, events, capacity, false);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfRenderWindow_pollEventsCoalesced(sfRenderWindow* renderWindow, sfEvent* events, size_t capacity)
+{
+    CSFML_PROFILE_ZONE("sfRenderWindow_pollEventsCoalesced");
+
+    CSFML_CHECK_RETURN(renderWindow, 0);
+    CSFML_CHECK_RETURN(events, 0);
+
+    if (renderWindow->Events)
+    {
+        std::size_t count = renderWindow->Events->pop(events, capacity, true);
+        applyResize(*renderWindow, events, count);
+        return count;
+    }
+
+    return pollEvents(renderWindow->This, events, capacity, true);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfBool sfRenderWindow_waitEvent(sfRenderWindow* renderWindow, sfEvent* event)
 {
     CSFML_CHECK_RETURN(renderWindow, sfFalse);
     CSFML_CHECK_RETURN(event,        sfFalse);
 
+    if (renderWindow->Events)
+    {
+        sfTimedEvent timedEvent;
+        if (!renderWindow->Events->wait(timedEvent))
+            return sfFalse;
+
+        *event = timedEvent.event;
+        applyResize(*renderWindow, event, 1);
+        return sfTrue;
+    }
+
     // Get the event
     sf::Event SFMLEvent;
     sfBool ret = renderWindow->This.waitEvent(SFMLEvent);
@@ -185,6 +312,33 @@ sfBool sfRenderWindow_waitEvent(sfRenderWindow* renderWindow, sfEvent* event)
 }
 
 
+////////////////////////////////////////////////////////////
+sfBool sfRenderWindow_pollTimedEvent(sfRenderWindow* renderWindow, sfTimedEvent* event)
+{
+    CSFML_CHECK_RETURN(renderWindow, sfFalse);
+    CSFML_CHECK_RETURN(event, sfFalse);
+
+    if (renderWindow->Events)
+    {
+        if (!renderWindow->Events->pop(*event))
+            return sfFalse;
+
+        applyResize(*renderWindow, &event->event, 1);
+        return sfTrue;
+    }
+
+    // Without event queue, the event is received now
+    sf::Event SFMLEvent;
+    if (!renderWindow->This.pollEvent(SFMLEvent))
+        return sfFalse;
+
+    convertEvent(SFMLEvent, &event->event);
+    event->timestamp = priv::getMonotonicTime();
+
+    return sfTrue;
+}
+
+
 ////////////////////////////////////////////////////////////
 sfVector2i sfRenderWindow_getPosition(const sfRenderWindow* renderWindow)
 {
@@ -316,6 +470,8 @@ sfBool sfRenderWindow_hasFocus(const sfRenderWindow* renderWindow)
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_display(sfRenderWindow* renderWindow)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_display");
+
     CSFML_CALL(renderWindow, display());
 }
 
@@ -437,41 +593,57 @@ sfVector2i sfRenderWindow_mapCoordsToPixel(const sfRenderWindow* renderWindow, s
 ////////////////////////////////////////////////////////////
 void sfRenderWindow_drawSprite(sfRenderWindow* renderWindow, const sfSprite* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawSprite");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawText(sfRenderWindow* renderWindow, const sfText* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawText");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawShape(sfRenderWindow* renderWindow, const sfShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawCircleShape(sfRenderWindow* renderWindow, const sfCircleShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawCircleShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawConvexShape(sfRenderWindow* renderWindow, const sfConvexShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawConvexShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawRectangleShape(sfRenderWindow* renderWindow, const sfRectangleShape* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawRectangleShape");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawVertexArray(sfRenderWindow* renderWindow, const sfVertexArray* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawVertexArray");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
 void sfRenderWindow_drawVertexBuffer(sfRenderWindow* renderWindow, const sfVertexBuffer* object, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawVertexBuffer");
+
     CSFML_CHECK(object);
     CSFML_CALL(renderWindow, draw(object->This, convertRenderStates(states)));
 }
@@ -482,6 +654,8 @@ void sfRenderWindow_drawPrimitives(sfRenderWindow* renderWindow,
                                    const sfVertex* vertices, size_t vertexCount,
                                    sfPrimitiveType type, const sfRenderStates* states)
 {
+    CSFML_PROFILE_ZONE("sfRenderWindow_drawPrimitives");
+
     CSFML_CALL(renderWindow, draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount,
                static_cast<sf::PrimitiveType>(type), convertRenderStates(states)));
 }
@@ -520,6 +694,19 @@ sfImage* sfRenderWindow_capture(const sfRenderWindow* renderWindow)
 }
 
 
+////////////////////////////////////////////////////////////
+sfTextureReadback* sfRenderWindow_readbackAsync(sfRenderWindow* renderWindow)
+{
+    CSFML_CHECK_RETURN(renderWindow, NULL);
+
+    if (!renderWindow->This.setActive(true))
+        return NULL;
+
+    sf::Vector2u size = renderWindow->This.getSize();
+    return priv::readbackFramebuffer(size.x, size.y);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfVector2i sfMouse_getPositionRenderWindow(const sfRenderWindow* relativeTo)
 {
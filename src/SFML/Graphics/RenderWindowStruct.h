@@ -30,16 +30,68 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/ViewStruct.h>
+#include <SFML/ObjectAllocator.h>
+#include <cstddef>
+
+
+namespace priv
+{
+    class EventQueue;
+
+
+    ////////////////////////////////////////////////////////////
+    // sf::RenderWindow whose viewport can be updated after a
+    // resize by the thread that renders, rather than by the
+    // input thread that receives the event
+    ////////////////////////////////////////////////////////////
+    class RenderWindow : public sf::RenderWindow
+    {
+    public:
+
+        RenderWindow() :
+        myDeferredResize(false)
+        {
+        }
+
+        void setDeferredResize(bool deferred)
+        {
+            myDeferredResize = deferred;
+        }
+
+        void applyResize()
+        {
+            sf::RenderWindow::onResize();
+        }
+
+    protected:
+
+        virtual void onResize()
+        {
+            if (!myDeferredResize)
+                sf::RenderWindow::onResize();
+        }
+
+    private:
+
+        bool myDeferredResize; ///< Whether onResize is left to applyResize
+    };
+}
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfRenderWindow
 ////////////////////////////////////////////////////////////
-struct sfRenderWindow
+struct sfRenderWindow : public priv::Allocated
 {
-    sf::RenderWindow This;
-    sfView           DefaultView;
-    sfView           CurrentView;
+    sfRenderWindow() :
+    Events(NULL)
+    {
+    }
+
+    priv::RenderWindow This;
+    sfView             DefaultView;
+    sfView             CurrentView;
+    priv::EventQueue*  Events; ///< Queue of timestamped events, or NULL
 };
 
 
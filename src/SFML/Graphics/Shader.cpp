@@ -29,15 +29,227 @@
 #include <SFML/Graphics/ShaderStruct.h>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/ConvertTransform.hpp>
+#include <SFML/Graphics/GlFunctions.hpp>
+#include <SFML/Graphics/ShaderCache.hpp>
+#include <SFML/System/FileInputStream.hpp>
 #include <SFML/Internal.h>
 #include <SFML/CallbackStream.h>
+#include <cstring>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Uniforms set by name bypass the handles, so the values last
+    // uploaded through the handles can no longer be trusted
+    ////////////////////////////////////////////////////////////
+    void forgetUniformValues(sfShader* shader)
+    {
+        if (shader)
+            ++shader->UniformGeneration;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::size_t getComponentCount(priv::UniformType type)
+    {
+        switch (type)
+        {
+            case priv::UniformFloat: return 1;
+            case priv::UniformVec2:  return 2;
+            case priv::UniformVec3:  return 3;
+            case priv::UniformVec4:  return 4;
+            case priv::UniformInt:   return 1;
+            case priv::UniformIvec2: return 2;
+            case priv::UniformIvec3: return 3;
+            case priv::UniformIvec4: return 4;
+            case priv::UniformMat3:  return 9;
+            case priv::UniformMat4:  return 16;
+            default:                 return 0;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isSameValue(const priv::UniformValue& left, const priv::UniformValue& right)
+    {
+        if (left.Type != right.Type)
+            return false;
+
+        if (left.Type == priv::UniformTexture)
+            return left.Texture == right.Texture;
+
+        return std::memcmp(left.Data, right.Data, getComponentCount(left.Type) * sizeof(sfUint32)) == 0;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Upload a value to the uniform at \a location of the bound program
+    ////////////////////////////////////////////////////////////
+    void uploadValue(const priv::GlFunctions& gl, sfShader& shader, const sfShaderUniform& uniform, const priv::UniformValue& value)
+    {
+        float f[16];
+        int   i[4];
+        std::memcpy(f, value.Data, sizeof(f));
+        std::memcpy(i, value.Data, sizeof(i));
+
+        switch (value.Type)
+        {
+            case priv::UniformFloat:   gl.Uniform1f(uniform.Location, f[0]); break;
+            case priv::UniformVec2:    gl.Uniform2f(uniform.Location, f[0], f[1]); break;
+            case priv::UniformVec3:    gl.Uniform3f(uniform.Location, f[0], f[1], f[2]); break;
+            case priv::UniformVec4:    gl.Uniform4f(uniform.Location, f[0], f[1], f[2], f[3]); break;
+            case priv::UniformInt:     gl.Uniform1i(uniform.Location, i[0]); break;
+            case priv::UniformIvec2:   gl.Uniform2i(uniform.Location, i[0], i[1]); break;
+            case priv::UniformIvec3:   gl.Uniform3i(uniform.Location, i[0], i[1], i[2]); break;
+            case priv::UniformIvec4:   gl.Uniform4i(uniform.Location, i[0], i[1], i[2], i[3]); break;
+            case priv::UniformMat3:    gl.UniformMatrix3fv(uniform.Location, 1, 0, f); break;
+            case priv::UniformMat4:    gl.UniformMatrix4fv(uniform.Location, 1, 0, f); break;
+
+            // SFML assigns the texture units
+            case priv::UniformTexture: shader.This.setUniform(uniform.Name, *value.Texture); break;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setFloats(sfShader* shader, int location, priv::UniformType type, const float* components)
+    {
+        CSFML_CHECK(shader);
+        if (location < 0)
+            return;
+
+        priv::UniformValue value;
+        std::memset(&value, 0, sizeof(value));
+        value.Location = location;
+        value.Type     = type;
+        std::memcpy(value.Data, components, getComponentCount(type) * sizeof(float));
+
+        priv::uploadUniforms(*shader, &value, 1);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setInts(sfShader* shader, int location, priv::UniformType type, const int* components)
+    {
+        CSFML_CHECK(shader);
+        if (location < 0)
+            return;
+
+        priv::UniformValue value;
+        std::memset(&value, 0, sizeof(value));
+        value.Location = location;
+        value.Type     = type;
+        std::memcpy(value.Data, components, getComponentCount(type) * sizeof(int));
+
+        priv::uploadUniforms(*shader, &value, 1);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // The program cache is keyed by the sources, so shaders loaded
+    // from files and streams are read in memory first
+    ////////////////////////////////////////////////////////////
+    bool readSource(sf::InputStream& stream, std::string& source)
+    {
+        sf::Int64 size = stream.getSize();
+        if ((size < 0) || (stream.seek(0) != 0))
+            return false;
+
+        source.resize(static_cast<std::size_t>(size));
+        return (size == 0) || (stream.read(&source[0], size) == size);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfShader* createFromSourceStreams(sf::InputStream* const streams[3])
+    {
+        std::string sources[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            if (streams[i] && !readSource(*streams[i], sources[i]))
+                return NULL;
+        }
+
+        return sfShader_createFromMemory(streams[0] ? sources[0].c_str() : NULL,
+                                         streams[1] ? sources[1].c_str() : NULL,
+                                         streams[2] ? sources[2].c_str() : NULL);
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    std::size_t uploadUniforms(sfShader& shader, const UniformValue* values, std::size_t count)
+    {
+        GLuint program = shader.This.getNativeHandle();
+        if (!program || (count == 0))
+            return 0;
+
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+        if (!gl.HasShaders)
+            return 0;
+
+        // Bind the program once for all the values
+        GLint previous = 0;
+        gl.GetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        if (static_cast<GLuint>(previous) != program)
+            gl.UseProgram(program);
+
+        std::size_t uploaded = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const UniformValue& value = values[i];
+            if ((value.Location < 0) || (static_cast<std::size_t>(value.Location) >= shader.Uniforms.size()))
+                continue;
+
+            sfShaderUniform& uniform = shader.Uniforms[value.Location];
+            if ((uniform.Generation == shader.UniformGeneration) && isSameValue(uniform.Value, value))
+                continue;
+
+            uploadValue(gl, shader, uniform, value);
+            uniform.Value      = value;
+            uniform.Generation = shader.UniformGeneration;
+            ++uploaded;
+        }
+
+        if (static_cast<GLuint>(previous) != program)
+            gl.UseProgram(static_cast<GLuint>(previous));
+
+        return uploaded;
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
 sfShader* sfShader_createFromFile(const char* vertexShaderFilename, const char* geometryShaderFilename, const char* fragmentShaderFilename)
 {
+    if (priv::isProgramCacheEnabled())
+    {
+        const char* filenames[3] = {vertexShaderFilename, geometryShaderFilename, fragmentShaderFilename};
+        sf::FileInputStream files[3];
+        sf::InputStream* streams[3] = {NULL, NULL, NULL};
+        bool opened = true;
+        for (int i = 0; i < 3; ++i)
+        {
+            if (filenames[i])
+            {
+                opened = opened && files[i].open(filenames[i]);
+                streams[i] = &files[i];
+            }
+        }
+
+        // Let SFML report files that can't be opened
+        if (opened)
+            return createFromSourceStreams(streams);
+    }
+
     bool success = false;
     sfShader* shader = new sfShader;
+    shader->UniformGeneration = 1;
+    shader->FromProgramCache = false;
     if (vertexShaderFilename || geometryShaderFilename || fragmentShaderFilename)
     {
         if (!geometryShaderFilename)
@@ -80,7 +292,14 @@ sfShader* sfShader_createFromMemory(const char* vertexShader, const char* geomet
 {
     bool success = false;
     sfShader* shader = new sfShader;
-    if (vertexShader || geometryShader || fragmentShader)
+    shader->UniformGeneration = 1;
+    shader->FromProgramCache = false;
+    if ((vertexShader || geometryShader || fragmentShader) && priv::loadCachedProgram(shader->This, vertexShader, geometryShader, fragmentShader))
+    {
+        success = true;
+        shader->FromProgramCache = true;
+    }
+    else if (vertexShader || geometryShader || fragmentShader)
     {
         if (!geometryShader)
         {
@@ -105,6 +324,9 @@ sfShader* sfShader_createFromMemory(const char* vertexShader, const char* geomet
             // vertex + geometry + fragment shaders
             success = shader->This.loadFromMemory(vertexShader, geometryShader, fragmentShader);
         }
+
+        if (success)
+            priv::storeCachedProgram(shader->This, vertexShader, geometryShader, fragmentShader);
     }
 
     if (!success)
@@ -120,8 +342,27 @@ sfShader* sfShader_createFromMemory(const char* vertexShader, const char* geomet
 ////////////////////////////////////////////////////////////
 sfShader* sfShader_createFromStream(sfInputStream* vertexShaderStream, sfInputStream* geometryShaderStream, sfInputStream* fragmentShaderStream)
 {
+    if (priv::isProgramCacheEnabled())
+    {
+        sfInputStream* inputs[3] = {vertexShaderStream, geometryShaderStream, fragmentShaderStream};
+        CallbackStream callbacks[3];
+        sf::InputStream* streams[3] = {NULL, NULL, NULL};
+        for (int i = 0; i < 3; ++i)
+        {
+            if (inputs[i])
+            {
+                callbacks[i] = CallbackStream(inputs[i]);
+                streams[i] = &callbacks[i];
+            }
+        }
+
+        return createFromSourceStreams(streams);
+    }
+
     bool success = false;
     sfShader* shader = new sfShader;
+    shader->UniformGeneration = 1;
+    shader->FromProgramCache = false;
     if (vertexShaderStream || geometryShaderStream || fragmentShaderStream)
     {
         if (!geometryShaderStream)
@@ -176,6 +417,7 @@ void sfShader_destroy(sfShader* shader)
 ////////////////////////////////////////////////////////////
 void sfShader_setFloatUniform(sfShader* shader, const char* name, float x)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, x));
 }
 
@@ -183,6 +425,7 @@ void sfShader_setFloatUniform(sfShader* shader, const char* name, float x)
 ////////////////////////////////////////////////////////////
 void sfShader_setVec2Uniform(sfShader* shader, const char* name, sfGlslVec2 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Vec2(vector.x, vector.y)));
 }
 
@@ -190,6 +433,7 @@ void sfShader_setVec2Uniform(sfShader* shader, const char* name, sfGlslVec2 vect
 ////////////////////////////////////////////////////////////
 void sfShader_setVec3Uniform(sfShader* shader, const char* name, sfGlslVec3 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Vec3(vector.x, vector.y, vector.z)));
 }
 
@@ -197,6 +441,7 @@ void sfShader_setVec3Uniform(sfShader* shader, const char* name, sfGlslVec3 vect
 ////////////////////////////////////////////////////////////
 void sfShader_setVec4Uniform(sfShader* shader, const char* name, sfGlslVec4 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Vec4(vector.x, vector.y, vector.z, vector.w)));
 }
 
@@ -216,6 +461,7 @@ void sfShader_setColorUniform(sfShader* shader, const char* name, sfColor color)
 ////////////////////////////////////////////////////////////
 void sfShader_setIntUniform(sfShader* shader, const char* name, int x)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, x));
 }
 
@@ -223,6 +469,7 @@ void sfShader_setIntUniform(sfShader* shader, const char* name, int x)
 ////////////////////////////////////////////////////////////
 void sfShader_setIvec2Uniform(sfShader* shader, const char* name, sfGlslIvec2 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Ivec2(vector.x, vector.y)));
 }
 
@@ -230,6 +477,7 @@ void sfShader_setIvec2Uniform(sfShader* shader, const char* name, sfGlslIvec2 ve
 ////////////////////////////////////////////////////////////
 void sfShader_setIvec3Uniform(sfShader* shader, const char* name, sfGlslIvec3 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Ivec3(vector.x, vector.y, vector.z)));
 }
 
@@ -237,6 +485,7 @@ void sfShader_setIvec3Uniform(sfShader* shader, const char* name, sfGlslIvec3 ve
 ////////////////////////////////////////////////////////////
 void sfShader_setIvec4Uniform(sfShader* shader, const char* name, sfGlslIvec4 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Ivec4(vector.x, vector.y, vector.z, vector.w)));
 }
 
@@ -256,6 +505,7 @@ void sfShader_setIntColorUniform(sfShader* shader, const char* name, sfColor col
 ////////////////////////////////////////////////////////////
 void sfShader_setBoolUniform(sfShader* shader, const char* name, sfBool x)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, x != sfFalse));
 }
 
@@ -263,6 +513,7 @@ void sfShader_setBoolUniform(sfShader* shader, const char* name, sfBool x)
 ////////////////////////////////////////////////////////////
 void sfShader_setBvec2Uniform(sfShader* shader, const char* name, sfGlslBvec2 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Bvec2(vector.x != sfFalse, vector.y != sfFalse)));
 }
 
@@ -270,6 +521,7 @@ void sfShader_setBvec2Uniform(sfShader* shader, const char* name, sfGlslBvec2 ve
 ////////////////////////////////////////////////////////////
 void sfShader_setBvec3Uniform(sfShader* shader, const char* name, sfGlslBvec3 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Bvec3(vector.x != sfFalse, vector.y != sfFalse, vector.z != sfFalse)));
 }
 
@@ -277,6 +529,7 @@ void sfShader_setBvec3Uniform(sfShader* shader, const char* name, sfGlslBvec3 ve
 ////////////////////////////////////////////////////////////
 void sfShader_setBvec4Uniform(sfShader* shader, const char* name, sfGlslBvec4 vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Bvec4(vector.x != sfFalse, vector.y != sfFalse, vector.z != sfFalse, vector.w != sfFalse)));
 }
 
@@ -284,6 +537,7 @@ void sfShader_setBvec4Uniform(sfShader* shader, const char* name, sfGlslBvec4 ve
 ////////////////////////////////////////////////////////////
 void sfShader_setMat3Uniform(sfShader* shader, const char* name, const sfGlslMat3* matrix)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Mat3(matrix->array)));
 }
 
@@ -291,6 +545,7 @@ void sfShader_setMat3Uniform(sfShader* shader, const char* name, const sfGlslMat
 ////////////////////////////////////////////////////////////
 void sfShader_setMat4Uniform(sfShader* shader, const char* name, const sfGlslMat4* matrix)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Glsl::Mat4(matrix->array)));
 }
 
@@ -298,6 +553,7 @@ void sfShader_setMat4Uniform(sfShader* shader, const char* name, const sfGlslMat
 ////////////////////////////////////////////////////////////
 void sfShader_setTextureUniform(sfShader* shader, const char* name, const sfTexture* texture)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, *texture->This));
 }
 
@@ -305,6 +561,7 @@ void sfShader_setTextureUniform(sfShader* shader, const char* name, const sfText
 ////////////////////////////////////////////////////////////
 void sfShader_setCurrentTextureUniform(sfShader* shader, const char* name)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniform(name, sf::Shader::CurrentTexture));
 }
 
@@ -312,6 +569,7 @@ void sfShader_setCurrentTextureUniform(sfShader* shader, const char* name)
 ////////////////////////////////////////////////////////////
 void sfShader_setFloatUniformArray(sfShader* shader, const char* name, const float* scalarArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, scalarArray, length));
 }
 
@@ -319,6 +577,7 @@ void sfShader_setFloatUniformArray(sfShader* shader, const char* name, const flo
 ////////////////////////////////////////////////////////////
 void sfShader_setVec2UniformArray(sfShader* shader, const char* name, const sfGlslVec2* vectorArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, reinterpret_cast<const sf::Glsl::Vec2*>(vectorArray), length));
 }
 
@@ -326,6 +585,7 @@ void sfShader_setVec2UniformArray(sfShader* shader, const char* name, const sfGl
 ////////////////////////////////////////////////////////////
 void sfShader_setVec3UniformArray(sfShader* shader, const char* name, const sfGlslVec3* vectorArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, reinterpret_cast<const sf::Glsl::Vec3*>(vectorArray), length));
 }
 
@@ -333,6 +593,7 @@ void sfShader_setVec3UniformArray(sfShader* shader, const char* name, const sfGl
 ////////////////////////////////////////////////////////////
 void sfShader_setVec4UniformArray(sfShader* shader, const char* name, const sfGlslVec4* vectorArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, reinterpret_cast<const sf::Glsl::Vec4*>(vectorArray), length));
 }
 
@@ -340,6 +601,7 @@ void sfShader_setVec4UniformArray(sfShader* shader, const char* name, const sfGl
 ////////////////////////////////////////////////////////////
 void sfShader_setMat3UniformArray(sfShader* shader, const char* name, const sfGlslMat3* matrixArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, reinterpret_cast<const sf::Glsl::Mat3*>(matrixArray), length));
 }
 
@@ -347,13 +609,162 @@ void sfShader_setMat3UniformArray(sfShader* shader, const char* name, const sfGl
 ////////////////////////////////////////////////////////////
 void sfShader_setMat4UniformArray(sfShader* shader, const char* name, const sfGlslMat4* matrixArray, size_t length)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setUniformArray(name, reinterpret_cast<const sf::Glsl::Mat4*>(matrixArray), length));
 }
 
 
+////////////////////////////////////////////////////////////
+int sfShader_getUniformLocation(sfShader* shader, const char* name)
+{
+    CSFML_CHECK_RETURN(shader, -1);
+    CSFML_CHECK_RETURN(name, -1);
+
+    for (std::size_t i = 0; i < shader->Uniforms.size(); ++i)
+    {
+        if (shader->Uniforms[i].Name == name)
+            return static_cast<int>(i);
+    }
+
+    priv::GLuint program = shader->This.getNativeHandle();
+    if (!program)
+        return -1;
+
+    priv::ActiveContext context;
+    const priv::GlFunctions& gl = priv::getGlFunctions();
+    if (!gl.HasShaders)
+        return -1;
+
+    priv::GLint location = gl.GetUniformLocation(program, name);
+    if (location < 0)
+        return -1;
+
+    sfShaderUniform uniform;
+    uniform.Name       = name;
+    uniform.Location   = location;
+    uniform.Generation = 0;
+    shader->Uniforms.push_back(uniform);
+
+    return static_cast<int>(shader->Uniforms.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setFloatUniformAt(sfShader* shader, int location, float x)
+{
+    setFloats(shader, location, priv::UniformFloat, &x);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setVec2UniformAt(sfShader* shader, int location, sfGlslVec2 vector)
+{
+    float components[2] = {vector.x, vector.y};
+    setFloats(shader, location, priv::UniformVec2, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setVec3UniformAt(sfShader* shader, int location, sfGlslVec3 vector)
+{
+    float components[3] = {vector.x, vector.y, vector.z};
+    setFloats(shader, location, priv::UniformVec3, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setVec4UniformAt(sfShader* shader, int location, sfGlslVec4 vector)
+{
+    float components[4] = {vector.x, vector.y, vector.z, vector.w};
+    setFloats(shader, location, priv::UniformVec4, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setColorUniformAt(sfShader* shader, int location, sfColor color)
+{
+    float components[4] = {color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f};
+    setFloats(shader, location, priv::UniformVec4, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setIntUniformAt(sfShader* shader, int location, int x)
+{
+    setInts(shader, location, priv::UniformInt, &x);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setIvec2UniformAt(sfShader* shader, int location, sfGlslIvec2 vector)
+{
+    int components[2] = {vector.x, vector.y};
+    setInts(shader, location, priv::UniformIvec2, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setIvec3UniformAt(sfShader* shader, int location, sfGlslIvec3 vector)
+{
+    int components[3] = {vector.x, vector.y, vector.z};
+    setInts(shader, location, priv::UniformIvec3, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setIvec4UniformAt(sfShader* shader, int location, sfGlslIvec4 vector)
+{
+    int components[4] = {vector.x, vector.y, vector.z, vector.w};
+    setInts(shader, location, priv::UniformIvec4, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setBoolUniformAt(sfShader* shader, int location, sfBool x)
+{
+    int component = (x != sfFalse) ? 1 : 0;
+    setInts(shader, location, priv::UniformInt, &component);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setMat3UniformAt(sfShader* shader, int location, const sfGlslMat3* matrix)
+{
+    CSFML_CHECK(matrix);
+    setFloats(shader, location, priv::UniformMat3, matrix->array);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setMat4UniformAt(sfShader* shader, int location, const sfGlslMat4* matrix)
+{
+    CSFML_CHECK(matrix);
+    setFloats(shader, location, priv::UniformMat4, matrix->array);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setTextureUniformAt(sfShader* shader, int location, const sfTexture* texture)
+{
+    CSFML_CHECK(shader);
+    CSFML_CHECK(texture);
+    if (location < 0)
+        return;
+
+    priv::UniformValue value;
+    std::memset(&value, 0, sizeof(value));
+    value.Location = location;
+    value.Type     = priv::UniformTexture;
+    value.Texture  = texture->This;
+
+    priv::uploadUniforms(*shader, &value, 1);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfShader_setFloatParameter(sfShader* shader, const char* name, float x)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, x));
 }
 
@@ -361,6 +772,7 @@ void sfShader_setFloatParameter(sfShader* shader, const char* name, float x)
 ////////////////////////////////////////////////////////////
 void sfShader_setFloat2Parameter(sfShader* shader, const char* name, float x, float y)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, x, y));
 }
 
@@ -368,6 +780,7 @@ void sfShader_setFloat2Parameter(sfShader* shader, const char* name, float x, fl
 ////////////////////////////////////////////////////////////
 void sfShader_setFloat3Parameter(sfShader* shader, const char* name, float x, float y, float z)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, x, y, z));
 }
 
@@ -375,6 +788,7 @@ void sfShader_setFloat3Parameter(sfShader* shader, const char* name, float x, fl
 ////////////////////////////////////////////////////////////
 void sfShader_setFloat4Parameter(sfShader* shader, const char* name, float x, float y, float z, float w)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, x, y, z, w));
 }
 
@@ -382,6 +796,7 @@ void sfShader_setFloat4Parameter(sfShader* shader, const char* name, float x, fl
 ////////////////////////////////////////////////////////////
 void sfShader_setVector2Parameter(sfShader* shader, const char* name, sfVector2f vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, sf::Vector2f(vector.x, vector.y)));
 }
 
@@ -389,6 +804,7 @@ void sfShader_setVector2Parameter(sfShader* shader, const char* name, sfVector2f
 ////////////////////////////////////////////////////////////
 void sfShader_setVector3Parameter(sfShader* shader, const char* name, sfVector3f vector)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, sf::Vector3f(vector.x, vector.y, vector.z)));
 }
 
@@ -396,6 +812,7 @@ void sfShader_setVector3Parameter(sfShader* shader, const char* name, sfVector3f
 ////////////////////////////////////////////////////////////
 void sfShader_setColorParameter(sfShader* shader, const char* name, sfColor color)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, sf::Color(color.r, color.g, color.b, color.a)));
 }
 
@@ -403,6 +820,7 @@ void sfShader_setColorParameter(sfShader* shader, const char* name, sfColor colo
 ////////////////////////////////////////////////////////////
 void sfShader_setTransformParameter(sfShader* shader, const char* name, sfTransform transform)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, convertTransform(transform)));
 }
 
@@ -410,6 +828,7 @@ void sfShader_setTransformParameter(sfShader* shader, const char* name, sfTransf
 ////////////////////////////////////////////////////////////
 void sfShader_setTextureParameter(sfShader* shader, const char* name, const sfTexture* texture)
 {
+	forgetUniformValues(shader);
 	CSFML_CHECK(texture);
 	CSFML_CALL(shader, setParameter(name,*texture->This));
 }
@@ -418,6 +837,7 @@ void sfShader_setTextureParameter(sfShader* shader, const char* name, const sfTe
 ////////////////////////////////////////////////////////////
 void sfShader_setCurrentTextureParameter(sfShader* shader, const char* name)
 {
+	forgetUniformValues(shader);
 	CSFML_CALL(shader, setParameter(name, sf::Shader::CurrentTexture));
 }
 
@@ -448,3 +868,26 @@ sfBool sfShader_isGeometryAvailable(void)
 {
     return sf::Shader::isGeometryAvailable() ? sfTrue : sfFalse;
 }
+
+
+////////////////////////////////////////////////////////////
+void sfShader_setProgramCacheDirectory(const char* directory)
+{
+    priv::setProgramCacheDirectory(directory);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfShader_isProgramCacheAvailable(void)
+{
+    return priv::isProgramCacheSupported() ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfShader_isLoadedFromProgramCache(const sfShader* shader)
+{
+    CSFML_CHECK_RETURN(shader, sfFalse);
+
+    return shader->FromProgramCache ? sfTrue : sfFalse;
+}
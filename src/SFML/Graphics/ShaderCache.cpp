@@ -0,0 +1,457 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ShaderCache.hpp>
+#include <SFML/Graphics/GlFunctions.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+    using namespace priv;
+
+    sf::Mutex   cacheMutex;
+    std::string cacheDirectory;
+
+    // Header of the cache files, followed by the driver identity,
+    // the sources, the binary format, the binary length, its
+    // checksum and the binary
+    const char fileMagic[8] = {'C', 'S', 'F', 'M', 'L', 'P', 'B', '2'};
+
+    // Length written for a missing stage, which differs from an empty one
+    const sfUint64 missingStage = ~0ULL;
+
+    // SFML owns the program objects and only creates them by compiling
+    // sources, so cached programs are loaded over this trivial one
+    const char* const placeholderSource = "void main() { gl_FragColor = vec4(1.0); }";
+
+    ////////////////////////////////////////////////////////////
+    // FNV-1a hash, chained through \a hash
+    ////////////////////////////////////////////////////////////
+    sfUint64 hashBytes(const void* data, std::size_t size, sfUint64 hash)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+
+        return hash;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Drain the OpenGL error flags, so that the errors generated
+    // by rejected binaries are not reported later by SFML
+    ////////////////////////////////////////////////////////////
+    void clearErrors(const GlFunctions& gl)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            if (gl.GetError() == GL_NO_ERROR)
+                break;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Drivers may support program binaries but no format, like
+    // Mesa when its own shader cache is disabled
+    ////////////////////////////////////////////////////////////
+    bool hasBinaryFormats(const GlFunctions& gl)
+    {
+        if (!gl.HasProgramBinary)
+            return false;
+
+        GLint count = 0;
+        gl.GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+        clearErrors(gl);
+
+        return count > 0;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isFormatSupported(const GlFunctions& gl, GLenum format)
+    {
+        GLint count = 0;
+        gl.GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+        if (count <= 0)
+            return false;
+
+        std::vector<GLint> formats(static_cast<std::size_t>(count));
+        gl.GetIntegerv(GL_PROGRAM_BINARY_FORMATS, &formats[0]);
+
+        return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) != formats.end();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Identify the driver and the GPU of the active context;
+    // binaries can only be loaded by the exact same driver
+    ////////////////////////////////////////////////////////////
+    std::string getDriver(const GlFunctions& gl)
+    {
+        const GLenum names[] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+
+        std::string driver;
+        for (std::size_t i = 0; i < sizeof(names) / sizeof(*names); ++i)
+        {
+            const GLubyte* name = gl.GetString(names[i]);
+            if (name)
+                driver += reinterpret_cast<const char*>(name);
+            driver += '\n';
+        }
+
+        return driver;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    std::string toHex(sfUint64 value)
+    {
+        const char digits[] = "0123456789abcdef";
+
+        std::string hex(16, '0');
+        for (int i = 15; i >= 0; --i, value >>= 4)
+            hex[i] = digits[value & 15];
+
+        return hex;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Path of a file of the cache, empty if the cache is disabled
+    ////////////////////////////////////////////////////////////
+    std::string getCachePath(const std::string& name)
+    {
+        sf::Lock lock(cacheMutex);
+
+        if (cacheDirectory.empty())
+            return std::string();
+
+        char last = cacheDirectory[cacheDirectory.size() - 1];
+        if ((last == '/') || (last == '\\'))
+            return cacheDirectory + name;
+        else
+            return cacheDirectory + '/' + name;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint64 getSourceLength(const char* source)
+    {
+        return source ? std::strlen(source) : missingStage;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // The name of a cache file is a hash of the sources and the
+    // driver; it only locates the file, whose contents are
+    // compared to the sources and the driver when it is loaded
+    ////////////////////////////////////////////////////////////
+    std::string getProgramFilename(const std::string& driver, const char* const sources[3])
+    {
+        sfUint64 hash = 14695981039346656037ULL;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            // Stages are separated by their length
+            sfUint64 length = getSourceLength(sources[i]);
+            hash = hashBytes(&length, sizeof(length), hash);
+            if (sources[i])
+                hash = hashBytes(sources[i], static_cast<std::size_t>(length), hash);
+        }
+
+        hash = hashBytes(driver.data(), driver.size(), hash);
+
+        return toHex(hash) + ".bin";
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool readFile(const std::string& path, std::vector<char>& data)
+    {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+
+        bool success = (std::fseek(file, 0, SEEK_END) == 0);
+        long size = success ? std::ftell(file) : -1;
+        success = (size > 0) && (std::fseek(file, 0, SEEK_SET) == 0);
+        if (success)
+        {
+            data.resize(static_cast<std::size_t>(size));
+            success = std::fread(&data[0], 1, data.size(), file) == data.size();
+        }
+
+        std::fclose(file);
+        return success;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Write through a temporary file, so that a crash or a
+    // concurrent run never leaves a truncated file behind
+    ////////////////////////////////////////////////////////////
+    bool writeFile(const std::string& path, const std::vector<char>& data)
+    {
+        std::string temporaryPath = path + ".tmp";
+        std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+        if (!file)
+            return false;
+
+        bool success = std::fwrite(&data[0], 1, data.size(), file) == data.size();
+        success = (std::fclose(file) == 0) && success;
+
+        // rename doesn't replace existing files on Windows
+        std::remove(path.c_str());
+        if (!success || (std::rename(temporaryPath.c_str(), path.c_str()) != 0))
+        {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void writeValue(std::vector<char>& data, T value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(value));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    bool readValue(const std::vector<char>& data, std::size_t& offset, T& value)
+    {
+        if (data.size() - offset < sizeof(value))
+            return false;
+
+        std::memcpy(&value, &data[offset], sizeof(value));
+        offset += sizeof(value);
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Cached program, pointing into the contents of its file
+    ////////////////////////////////////////////////////////////
+    struct CachedProgram
+    {
+        GLenum      Format;
+        const char* Binary;
+        sfUint32    Length;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Check the header, the sources and the checksum of a cache
+    // file; files written for other sources, by another driver or
+    // corrupted are rejected
+    ////////////////////////////////////////////////////////////
+    bool parseCachedProgram(const std::vector<char>& data, const std::string& driver, const char* const sources[3], CachedProgram& program)
+    {
+        if ((data.size() < sizeof(fileMagic)) || (std::memcmp(&data[0], fileMagic, sizeof(fileMagic)) != 0))
+            return false;
+
+        std::size_t offset = sizeof(fileMagic);
+        sfUint32 driverLength = 0;
+        if (!readValue(data, offset, driverLength) || (driverLength != driver.size()) || (data.size() - offset < driverLength))
+            return false;
+        if (driver.compare(0, driverLength, &data[offset], driverLength) != 0)
+            return false;
+        offset += driverLength;
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            sfUint64 length = 0;
+            if (!readValue(data, offset, length) || (length != getSourceLength(sources[i])))
+                return false;
+            if (!sources[i])
+                continue;
+            if ((data.size() - offset < length) || (std::memcmp(&data[offset], sources[i], static_cast<std::size_t>(length)) != 0))
+                return false;
+            offset += static_cast<std::size_t>(length);
+        }
+
+        sfUint32 format   = 0;
+        sfUint64 checksum = 0;
+        if (!readValue(data, offset, format) || !readValue(data, offset, program.Length) || !readValue(data, offset, checksum))
+            return false;
+        if ((program.Length == 0) || (data.size() - offset != program.Length))
+            return false;
+
+        program.Format = format;
+        program.Binary = &data[offset];
+
+        return hashBytes(program.Binary, program.Length, 14695981039346656037ULL) == checksum;
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    void setProgramCacheDirectory(const char* directory)
+    {
+        sf::Lock lock(cacheMutex);
+
+        cacheDirectory = directory ? directory : "";
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isProgramCacheEnabled()
+    {
+        sf::Lock lock(cacheMutex);
+
+        return !cacheDirectory.empty();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool isProgramCacheSupported()
+    {
+        ActiveContext context;
+
+        return hasBinaryFormats(getGlFunctions());
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool loadCachedProgram(sf::Shader& shader, const char* vertexShader, const char* geometryShader, const char* fragmentShader)
+    {
+        if (!isProgramCacheEnabled())
+            return false;
+
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+        if (!hasBinaryFormats(gl))
+            return false;
+
+        const char* sources[] = {vertexShader, geometryShader, fragmentShader};
+        std::string driver = getDriver(gl);
+        std::string path = getCachePath(getProgramFilename(driver, sources));
+        if (path.empty())
+            return false;
+
+        std::vector<char> data;
+        if (!readFile(path, data))
+            return false;
+
+        CachedProgram cached;
+        if (!parseCachedProgram(data, driver, sources, cached) || !isFormatSupported(gl, cached.Format))
+        {
+            clearErrors(gl);
+            std::remove(path.c_str());
+            return false;
+        }
+
+        if (!shader.loadFromMemory(placeholderSource, sf::Shader::Fragment))
+            return false;
+
+        GLuint program = shader.getNativeHandle();
+        GLint linked = 0;
+        gl.ProgramBinary(program, cached.Format, cached.Binary, static_cast<GLsizei>(cached.Length));
+        gl.GetProgramiv(program, GL_LINK_STATUS, &linked);
+        clearErrors(gl);
+
+        if (!linked)
+        {
+            // The program is compiled from its sources instead, and
+            // saved again if the driver produces a binary
+            std::remove(path.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void storeCachedProgram(const sf::Shader& shader, const char* vertexShader, const char* geometryShader, const char* fragmentShader)
+    {
+        GLuint program = shader.getNativeHandle();
+        if (!program || !isProgramCacheEnabled())
+            return;
+
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+        if (!hasBinaryFormats(gl))
+            return;
+
+        const char* sources[] = {vertexShader, geometryShader, fragmentShader};
+        std::string driver = getDriver(gl);
+        std::string path = getCachePath(getProgramFilename(driver, sources));
+        if (path.empty())
+            return;
+
+        // SFML links the program without GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+        // drivers that require it report an empty binary
+        GLint length = 0;
+        gl.GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+        {
+            clearErrors(gl);
+            return;
+        }
+
+        std::vector<char> binary(static_cast<std::size_t>(length));
+        GLsizei written = 0;
+        GLenum format = 0;
+        gl.GetProgramBinary(program, length, &written, &format, &binary[0]);
+        clearErrors(gl);
+        if (written <= 0)
+            return;
+
+        std::vector<char> data(fileMagic, fileMagic + sizeof(fileMagic));
+        writeValue(data, static_cast<sfUint32>(driver.size()));
+        data.insert(data.end(), driver.begin(), driver.end());
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            sfUint64 sourceLength = getSourceLength(sources[i]);
+            writeValue(data, sourceLength);
+            if (sources[i])
+                data.insert(data.end(), sources[i], sources[i] + sourceLength);
+        }
+        writeValue(data, static_cast<sfUint32>(format));
+        writeValue(data, static_cast<sfUint32>(written));
+        writeValue(data, hashBytes(&binary[0], static_cast<std::size_t>(written), 14695981039346656037ULL));
+        data.insert(data.end(), binary.begin(), binary.begin() + written);
+
+        writeFile(path, data);
+    }
+}
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SHADERCACHE_HPP
+#define SFML_SHADERCACHE_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Shader.hpp>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Set the directory of the program binary cache (NULL or
+    // empty to disable the cache)
+    ////////////////////////////////////////////////////////////
+    void setProgramCacheDirectory(const char* directory);
+
+    ////////////////////////////////////////////////////////////
+    // Tell whether a cache directory is set
+    ////////////////////////////////////////////////////////////
+    bool isProgramCacheEnabled();
+
+    ////////////////////////////////////////////////////////////
+    // Tell whether the driver can save and load program binaries
+    ////////////////////////////////////////////////////////////
+    bool isProgramCacheSupported();
+
+    ////////////////////////////////////////////////////////////
+    // Load the program made of the given sources (NULL for a
+    // missing stage) from the cache; returns false if it's not
+    // in the cache or can't be used, the shader must then be
+    // compiled from its sources
+    ////////////////////////////////////////////////////////////
+    bool loadCachedProgram(sf::Shader& shader, const char* vertexShader, const char* geometryShader, const char* fragmentShader);
+
+    ////////////////////////////////////////////////////////////
+    // Save the program of a shader freshly compiled from the
+    // given sources to the cache
+    ////////////////////////////////////////////////////////////
+    void storeCachedProgram(const sf::Shader& shader, const char* vertexShader, const char* geometryShader, const char* fragmentShader);
+}
+
+
+#endif // SFML_SHADERCACHE_HPP
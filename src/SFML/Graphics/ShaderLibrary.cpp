@@ -0,0 +1,385 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ShaderLibrary.h>
+#include <SFML/Graphics/ShaderLibraryStruct.h>
+#include <SFML/Graphics/Shader.h>
+#include <SFML/Window/Context.hpp>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <cstdlib>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Convert a "NAME" or "NAME=VALUE" definition to a #define line
+    ////////////////////////////////////////////////////////////
+    bool getDefinitionLine(const char* definition, priv::String& line)
+    {
+        priv::String name(definition);
+        priv::String value;
+        std::size_t separator = name.find('=');
+        if (separator != priv::String::npos)
+        {
+            value = name.substr(separator + 1);
+            name.erase(separator);
+        }
+
+        if (name.empty() || ((name[0] >= '0') && (name[0] <= '9')) || (value.find_first_of("\r\n") != priv::String::npos))
+            return false;
+
+        for (std::size_t i = 0; i < name.size(); ++i)
+        {
+            char c = name[i];
+            if (!(((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_')))
+                return false;
+        }
+
+        line = "#define " + name;
+        if (!value.empty())
+            line += " " + value;
+        line += "\n";
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Insert the #define lines in a template, after its #version
+    // directive which must come first
+    ////////////////////////////////////////////////////////////
+    priv::String insertDefinitions(const priv::String& source, const priv::String& definitions)
+    {
+        if (definitions.empty())
+            return source;
+
+        std::size_t position = 0;
+        int version = 110;
+        std::size_t start = source.find_first_not_of(" \t\r\n");
+        if ((start != priv::String::npos) && (source.compare(start, 8, "#version") == 0))
+        {
+            version = std::atoi(source.c_str() + start + 8);
+            std::size_t end = source.find('\n', start);
+            position = (end != priv::String::npos) ? end + 1 : source.size();
+        }
+
+        priv::String result = source.substr(0, position);
+        if (!result.empty() && (result[result.size() - 1] != '\n'))
+            result += '\n';
+        result += definitions;
+
+        // Keep the line numbers of the compilation errors relative to
+        // the template; before GLSL 3.30, #line numbers the directive
+        // itself rather than the next line
+        int nextLine = 1 + static_cast<int>(std::count(source.begin(), source.begin() + position, '\n'));
+        result += "#line ";
+        result += std::to_string((version >= 330) ? nextLine : nextLine - 1).c_str();
+        result += "\n";
+        result += source.substr(position);
+
+        return result;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfShader* compileVariant(const sfShaderLibrary& library, const sfShaderVariant& variant)
+    {
+        const char* sources[3];
+        for (int i = 0; i < 3; ++i)
+            sources[i] = library.HasStage[i] ? variant.Sources[i].c_str() : NULL;
+
+        return sfShader_createFromMemory(sources[0], sources[1], sources[2]);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Publish the result of a compilation; the mutex of the
+    // library must be locked
+    ////////////////////////////////////////////////////////////
+    void finishVariant(sfShaderLibrary& library, sfShaderVariant& variant, sfShader* shader)
+    {
+        variant.Shader = shader;
+        variant.Status.store(shader ? sfShaderVariantReady : sfShaderVariantFailed, std::memory_order_release);
+        library.Compiled.notify_all();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Compile the variant at the front of the queue on the calling
+    // thread; the lock is released during the compilation
+    ////////////////////////////////////////////////////////////
+    void compileNextVariant(sfShaderLibrary& library, std::unique_lock<std::mutex>& lock)
+    {
+        sfShaderVariant* variant = library.Queue.front();
+        library.Queue.pop_front();
+
+        lock.unlock();
+        sfShader* shader = compileVariant(library, *variant);
+        lock.lock();
+
+        finishVariant(library, *variant, shader);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void compilationThread(sfShaderLibrary* library)
+    {
+        // The programs compiled on this context are shared with all the other contexts
+        sf::Context context;
+
+        std::unique_lock<std::mutex> lock(library->Mutex);
+        while (library->Running)
+        {
+            if (library->Queue.empty())
+                library->Wake.wait(lock);
+            else
+                compileNextVariant(*library, lock);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Shader of a variant if it is compiled; the mutex of the
+    // library must be locked
+    ////////////////////////////////////////////////////////////
+    sfShader* getReadyShader(const sfShaderLibrary& library, int variant)
+    {
+        if ((variant < 0) || (static_cast<std::size_t>(variant) >= library.Variants.size()))
+            return NULL;
+
+        const sfShaderVariant* entry = library.Variants[variant];
+        if (entry->Status.load(std::memory_order_acquire) != sfShaderVariantReady)
+            return NULL;
+
+        return entry->Shader;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfShaderLibrary* sfShaderLibrary_create(const char* vertexTemplate, const char* geometryTemplate, const char* fragmentTemplate, unsigned int threadCount)
+{
+    if (!vertexTemplate && !geometryTemplate && !fragmentTemplate)
+        return NULL;
+
+    sfShaderLibrary* library = new sfShaderLibrary;
+    const char* templates[3] = {vertexTemplate, geometryTemplate, fragmentTemplate};
+    for (int i = 0; i < 3; ++i)
+    {
+        library->HasStage[i] = (templates[i] != NULL);
+        if (templates[i])
+            library->Templates[i] = templates[i];
+    }
+
+    library->DefaultVariant = 0;
+    library->Running = true;
+
+    if (threadCount == 0)
+        threadCount = 1;
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        library->Threads.push_back(new sf::Thread(&compilationThread, library));
+        library->Threads.back()->launch();
+    }
+
+    return library;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderLibrary_destroy(sfShaderLibrary* library)
+{
+    if (!library)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(library->Mutex);
+        library->Running = false;
+        library->Queue.clear();
+        library->Wake.notify_all();
+    }
+
+    for (std::vector<sf::Thread*, priv::Allocator<sf::Thread*> >::iterator it = library->Threads.begin(); it != library->Threads.end(); ++it)
+    {
+        (*it)->wait();
+        delete *it;
+    }
+
+    for (std::vector<sfShaderVariant*, priv::Allocator<sfShaderVariant*> >::iterator it = library->Variants.begin(); it != library->Variants.end(); ++it)
+    {
+        sfShader_destroy((*it)->Shader);
+        delete *it;
+    }
+
+    delete library;
+}
+
+
+////////////////////////////////////////////////////////////
+int sfShaderLibrary_addVariant(sfShaderLibrary* library, const char* const* defines, size_t defineCount)
+{
+    CSFML_CHECK_RETURN(library, -1);
+    if (!defines && (defineCount > 0))
+        return -1;
+
+    // Sorted definitions identify the variant whatever their order
+    std::vector<priv::String, priv::Allocator<priv::String> > lines(defineCount);
+    for (size_t i = 0; i < defineCount; ++i)
+    {
+        if (!defines[i] || !getDefinitionLine(defines[i], lines[i]))
+            return -1;
+    }
+
+    std::sort(lines.begin(), lines.end());
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+
+    priv::String definitions;
+    for (std::vector<priv::String, priv::Allocator<priv::String> >::const_iterator it = lines.begin(); it != lines.end(); ++it)
+        definitions += *it;
+
+    std::lock_guard<std::mutex> lock(library->Mutex);
+
+    priv::VariantIdentifiers::const_iterator found = library->Identifiers.find(definitions);
+    if (found != library->Identifiers.end())
+        return found->second;
+
+    sfShaderVariant* variant = new sfShaderVariant;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (library->HasStage[i])
+            variant->Sources[i] = insertDefinitions(library->Templates[i], definitions);
+    }
+    variant->Shader = NULL;
+    variant->Status.store(sfShaderVariantPending);
+
+    int identifier = static_cast<int>(library->Variants.size());
+    library->Variants.push_back(variant);
+    library->Identifiers[definitions] = identifier;
+    library->Queue.push_back(variant);
+    library->Wake.notify_one();
+
+    return identifier;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfShaderLibrary_getVariantCount(const sfShaderLibrary* library)
+{
+    CSFML_CHECK_RETURN(library, 0);
+
+    std::lock_guard<std::mutex> lock(const_cast<sfShaderLibrary*>(library)->Mutex);
+
+    return library->Variants.size();
+}
+
+
+////////////////////////////////////////////////////////////
+sfShaderVariantStatus sfShaderLibrary_getVariantStatus(const sfShaderLibrary* library, int variant)
+{
+    CSFML_CHECK_RETURN(library, sfShaderVariantFailed);
+
+    std::lock_guard<std::mutex> lock(const_cast<sfShaderLibrary*>(library)->Mutex);
+
+    if ((variant < 0) || (static_cast<std::size_t>(variant) >= library->Variants.size()))
+        return sfShaderVariantFailed;
+
+    return static_cast<sfShaderVariantStatus>(library->Variants[variant]->Status.load(std::memory_order_acquire));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderLibrary_setDefaultVariant(sfShaderLibrary* library, int variant)
+{
+    CSFML_CHECK(library);
+
+    std::lock_guard<std::mutex> lock(library->Mutex);
+    library->DefaultVariant = variant;
+}
+
+
+////////////////////////////////////////////////////////////
+sfShader* sfShaderLibrary_getShader(sfShaderLibrary* library, int variant)
+{
+    CSFML_CHECK_RETURN(library, NULL);
+
+    std::lock_guard<std::mutex> lock(library->Mutex);
+
+    sfShader* shader = getReadyShader(*library, variant);
+    if (!shader)
+        shader = getReadyShader(*library, library->DefaultVariant);
+
+    return shader;
+}
+
+
+////////////////////////////////////////////////////////////
+sfShaderVariantStatus sfShaderLibrary_waitVariant(sfShaderLibrary* library, int variant)
+{
+    CSFML_CHECK_RETURN(library, sfShaderVariantFailed);
+
+    std::unique_lock<std::mutex> lock(library->Mutex);
+
+    if ((variant < 0) || (static_cast<std::size_t>(variant) >= library->Variants.size()))
+        return sfShaderVariantFailed;
+
+    // Don't wait for a compilation thread to become available
+    sfShaderVariant* entry = library->Variants[variant];
+    std::deque<sfShaderVariant*, priv::Allocator<sfShaderVariant*> >::iterator queued = std::find(library->Queue.begin(), library->Queue.end(), entry);
+    if (queued != library->Queue.end())
+    {
+        library->Queue.erase(queued);
+        library->Queue.push_front(entry);
+        compileNextVariant(*library, lock);
+    }
+
+    while (entry->Status.load(std::memory_order_acquire) == sfShaderVariantPending)
+        library->Compiled.wait(lock);
+
+    return static_cast<sfShaderVariantStatus>(entry->Status.load(std::memory_order_acquire));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderLibrary_waitAll(sfShaderLibrary* library)
+{
+    CSFML_CHECK(library);
+
+    std::unique_lock<std::mutex> lock(library->Mutex);
+
+    // The calling thread helps the compilation threads
+    while (!library->Queue.empty())
+        compileNextVariant(*library, lock);
+
+    for (std::size_t i = 0; i < library->Variants.size(); ++i)
+    {
+        while (library->Variants[i]->Status.load(std::memory_order_acquire) == sfShaderVariantPending)
+            library->Compiled.wait(lock);
+    }
+}
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SHADERLIBRARYSTRUCT_H
+#define SFML_SHADERLIBRARYSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ShaderLibrary.h>
+#include <SFML/System/Thread.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Variant of a shader library
+////////////////////////////////////////////////////////////
+struct sfShaderVariant : public priv::Allocated
+{
+    priv::String     Sources[3]; ///< Vertex, geometry and fragment sources, with the definitions inserted
+    sfShader*        Shader;     ///< Compiled shader, valid once Status is sfShaderVariantReady
+    std::atomic<int> Status;     ///< sfShaderVariantStatus of the variant
+};
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Identifier of each variant, by sorted definitions
+    ////////////////////////////////////////////////////////////
+    typedef std::map<String, int, std::less<String>, Allocator<std::pair<const String, int> > > VariantIdentifiers;
+}
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfShaderLibrary
+////////////////////////////////////////////////////////////
+struct sfShaderLibrary : public priv::Allocated
+{
+    priv::String                                                      Templates[3];   ///< Vertex, geometry and fragment templates
+    bool                                                              HasStage[3];    ///< Whether each template was provided
+    std::vector<sfShaderVariant*, priv::Allocator<sfShaderVariant*> > Variants;       ///< Variants, indexed by identifier
+    priv::VariantIdentifiers                                          Identifiers;    ///< Identifier of each variant, by sorted definitions
+    int                                                               DefaultVariant; ///< Variant used while the requested one is not ready
+    std::deque<sfShaderVariant*, priv::Allocator<sfShaderVariant*> >  Queue;          ///< Variants waiting for a compilation thread
+    std::vector<sf::Thread*, priv::Allocator<sf::Thread*> >           Threads;        ///< Compilation threads
+    bool                                                              Running;        ///< False when the compilation threads must stop
+    std::mutex                                                        Mutex;          ///< Protects Variants, Identifiers, DefaultVariant, Queue and Running
+    std::condition_variable                                           Wake;           ///< Signaled when a variant is queued or the threads must stop
+    std::condition_variable                                           Compiled;       ///< Signaled when a variant is compiled
+};
+
+
+#endif // SFML_SHADERLIBRARYSTRUCT_H
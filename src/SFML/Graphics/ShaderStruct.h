@@ -29,15 +29,79 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <SFML/Config.h>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Types of the values that can be set through uniform handles
+    ////////////////////////////////////////////////////////////
+    enum UniformType
+    {
+        UniformFloat,
+        UniformVec2,
+        UniformVec3,
+        UniformVec4,
+        UniformInt,
+        UniformIvec2,
+        UniformIvec3,
+        UniformIvec4,
+        UniformMat3,
+        UniformMat4,
+        UniformTexture
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Value of a uniform, as uploaded to OpenGL
+    ////////////////////////////////////////////////////////////
+    struct UniformValue
+    {
+        int                Location; ///< Handle of the uniform
+        UniformType        Type;     ///< Type of the value
+        sfUint32           Data[16]; ///< Bits of the float or int components
+        const sf::Texture* Texture;  ///< Texture, for UniformTexture
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+// Uniform of a shader that has a handle
+////////////////////////////////////////////////////////////
+struct sfShaderUniform
+{
+    std::string        Name;       ///< Name of the uniform in GLSL
+    int                Location;   ///< OpenGL location of the uniform
+    unsigned int       Generation; ///< Value of sfShader::UniformGeneration when Value was uploaded
+    priv::UniformValue Value;      ///< Last value uploaded through the handle
+};
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfShader
 ////////////////////////////////////////////////////////////
-struct sfShader
+struct sfShader : public priv::Allocated
 {
-    sf::Shader This;
+    sf::Shader                   This;
+    std::vector<sfShaderUniform> Uniforms;          ///< Uniforms that have a handle, indexed by handle
+    unsigned int                 UniformGeneration; ///< Incremented when uniforms are set by name, which makes the uploaded values unknown
+    bool                         FromProgramCache;  ///< Whether the program was loaded from the program binary cache
 };
 
 
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Upload uniform values through their handles, skipping the
+    // ones that didn't change; returns the number of uploads
+    ////////////////////////////////////////////////////////////
+    std::size_t uploadUniforms(sfShader& shader, const UniformValue* values, std::size_t count);
+}
+
+
 #endif // SFML_SHADERSTRUCT_H
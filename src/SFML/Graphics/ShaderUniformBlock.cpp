@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ShaderUniformBlock.h>
+#include <SFML/Graphics/ShaderUniformBlockStruct.h>
+#include <SFML/Graphics/TextureStruct.h>
+#include <SFML/Internal.h>
+#include <cstring>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Get the value of a uniform in a block, adding it if needed
+    ////////////////////////////////////////////////////////////
+    priv::UniformValue& getValue(sfShaderUniformBlock& block, int location, priv::UniformType type)
+    {
+        std::size_t slot = static_cast<std::size_t>(location);
+        if (slot >= block.Slots.size())
+            block.Slots.resize(slot + 1, -1);
+
+        if (block.Slots[slot] < 0)
+        {
+            block.Slots[slot] = static_cast<int>(block.Values.size());
+            block.Values.push_back(priv::UniformValue());
+        }
+
+        priv::UniformValue& value = block.Values[block.Slots[slot]];
+        std::memset(&value, 0, sizeof(value));
+        value.Location = location;
+        value.Type     = type;
+
+        return value;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setFloats(sfShaderUniformBlock* block, int location, priv::UniformType type, const float* components, std::size_t count)
+    {
+        CSFML_CHECK(block);
+        if (location < 0)
+            return;
+
+        std::memcpy(getValue(*block, location, type).Data, components, count * sizeof(float));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void setInts(sfShaderUniformBlock* block, int location, priv::UniformType type, const int* components, std::size_t count)
+    {
+        CSFML_CHECK(block);
+        if (location < 0)
+            return;
+
+        std::memcpy(getValue(*block, location, type).Data, components, count * sizeof(int));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfShaderUniformBlock* sfShaderUniformBlock_create(void)
+{
+    return new sfShaderUniformBlock;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_destroy(sfShaderUniformBlock* block)
+{
+    delete block;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_clear(sfShaderUniformBlock* block)
+{
+    CSFML_CHECK(block);
+
+    block->Values.clear();
+    block->Slots.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfShaderUniformBlock_getValueCount(const sfShaderUniformBlock* block)
+{
+    CSFML_CHECK_RETURN(block, 0);
+
+    return block->Values.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setFloat(sfShaderUniformBlock* block, int location, float x)
+{
+    setFloats(block, location, priv::UniformFloat, &x, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setVec2(sfShaderUniformBlock* block, int location, sfGlslVec2 vector)
+{
+    float components[2] = {vector.x, vector.y};
+    setFloats(block, location, priv::UniformVec2, components, 2);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setVec3(sfShaderUniformBlock* block, int location, sfGlslVec3 vector)
+{
+    float components[3] = {vector.x, vector.y, vector.z};
+    setFloats(block, location, priv::UniformVec3, components, 3);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setVec4(sfShaderUniformBlock* block, int location, sfGlslVec4 vector)
+{
+    float components[4] = {vector.x, vector.y, vector.z, vector.w};
+    setFloats(block, location, priv::UniformVec4, components, 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setColor(sfShaderUniformBlock* block, int location, sfColor color)
+{
+    float components[4] = {color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f};
+    setFloats(block, location, priv::UniformVec4, components, 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setInt(sfShaderUniformBlock* block, int location, int x)
+{
+    setInts(block, location, priv::UniformInt, &x, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setIvec2(sfShaderUniformBlock* block, int location, sfGlslIvec2 vector)
+{
+    int components[2] = {vector.x, vector.y};
+    setInts(block, location, priv::UniformIvec2, components, 2);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setIvec3(sfShaderUniformBlock* block, int location, sfGlslIvec3 vector)
+{
+    int components[3] = {vector.x, vector.y, vector.z};
+    setInts(block, location, priv::UniformIvec3, components, 3);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setIvec4(sfShaderUniformBlock* block, int location, sfGlslIvec4 vector)
+{
+    int components[4] = {vector.x, vector.y, vector.z, vector.w};
+    setInts(block, location, priv::UniformIvec4, components, 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setBool(sfShaderUniformBlock* block, int location, sfBool x)
+{
+    int component = (x != sfFalse) ? 1 : 0;
+    setInts(block, location, priv::UniformInt, &component, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setMat3(sfShaderUniformBlock* block, int location, const sfGlslMat3* matrix)
+{
+    CSFML_CHECK(matrix);
+    setFloats(block, location, priv::UniformMat3, matrix->array, 9);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setMat4(sfShaderUniformBlock* block, int location, const sfGlslMat4* matrix)
+{
+    CSFML_CHECK(matrix);
+    setFloats(block, location, priv::UniformMat4, matrix->array, 16);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShaderUniformBlock_setTexture(sfShaderUniformBlock* block, int location, const sfTexture* texture)
+{
+    CSFML_CHECK(block);
+    CSFML_CHECK(texture);
+    if (location < 0)
+        return;
+
+    getValue(*block, location, priv::UniformTexture).Texture = texture->This;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfShaderUniformBlock_apply(const sfShaderUniformBlock* block, sfShader* shader)
+{
+    CSFML_CHECK_RETURN(block, 0);
+    CSFML_CHECK_RETURN(shader, 0);
+
+    if (block->Values.empty())
+        return 0;
+
+    return priv::uploadUniforms(*shader, &block->Values[0], block->Values.size());
+}
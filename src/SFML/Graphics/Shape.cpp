@@ -48,6 +48,45 @@ void sfShape_destroy(sfShape* shape)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfShape_sizeof(void)
+{
+    return sizeof(sfShape);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfShape_alignof(void)
+{
+    return alignof(sfShape);
+}
+
+
+////////////////////////////////////////////////////////////
+sfShape* sfShape_init(void* memory,
+                     sfShapeGetPointCountCallback getPointCount,
+                     sfShapeGetPointCallback getPoint,
+                     void* userData)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfShape)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfShape_init is not suitably aligned");
+        return NULL;
+    }
+
+    return new (memory) sfShape(getPointCount, getPoint, userData);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfShape_deinit(sfShape* shape)
+{
+    if (shape)
+        shape->~sfShape();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfShape_setPosition(sfShape* shape, sfVector2f position)
 {
@@ -32,6 +32,7 @@
 #include <SFML/Graphics/Shape.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -75,7 +76,7 @@ private:
 ////////////////////////////////////////////////////////////
 // Internal structure of sfShape
 ////////////////////////////////////////////////////////////
-struct sfShape
+struct sfShape : public priv::Allocated
 {
     sfShape(sfShapeGetPointCountCallback getPointCount,
             sfShapeGetPointCallback      getPoint,
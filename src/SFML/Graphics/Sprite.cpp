@@ -59,6 +59,45 @@ void sfSprite_destroy(sfSprite* sprite)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfSprite_sizeof(void)
+{
+    return sizeof(sfSprite);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfSprite_alignof(void)
+{
+    return alignof(sfSprite);
+}
+
+
+////////////////////////////////////////////////////////////
+sfSprite* sfSprite_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfSprite)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfSprite_init is not suitably aligned");
+        return NULL;
+    }
+
+    sfSprite* sprite = new (memory) sfSprite;
+    sprite->Texture = NULL;
+
+    return sprite;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSprite_deinit(sfSprite* sprite)
+{
+    if (sprite)
+        sprite->~sfSprite();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfSprite_setPosition(sfSprite* sprite, sfVector2f position)
 {
@@ -31,12 +31,13 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSprite
 ////////////////////////////////////////////////////////////
-struct sfSprite
+struct sfSprite : public priv::Pooled<sfSprite>
 {
     sf::Sprite          This;
     const sfTexture*    Texture;
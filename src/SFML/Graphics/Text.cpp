@@ -59,6 +59,45 @@ void sfText_destroy(sfText* text)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfText_sizeof(void)
+{
+    return sizeof(sfText);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfText_alignof(void)
+{
+    return alignof(sfText);
+}
+
+
+////////////////////////////////////////////////////////////
+sfText* sfText_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfText)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfText_init is not suitably aligned");
+        return NULL;
+    }
+
+    sfText* text = new (memory) sfText;
+    text->Font = NULL;
+
+    return text;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfText_deinit(sfText* text)
+{
+    if (text)
+        text->~sfText();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfText_setPosition(sfText* text, sfVector2f position)
 {
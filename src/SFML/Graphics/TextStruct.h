@@ -32,13 +32,14 @@
 #include <SFML/Graphics/FontStruct.h>
 #include <SFML/Graphics/Rect.h>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 #include <string>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfText
 ////////////////////////////////////////////////////////////
-struct sfText
+struct sfText : public priv::Pooled<sfText>
 {
     sf::Text            This;
     const sfFont*       Font;
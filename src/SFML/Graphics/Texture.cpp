@@ -27,16 +27,201 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Texture.h>
 #include <SFML/Graphics/TextureStruct.h>
+#include <SFML/Graphics/TextureReadbackStruct.h>
 #include <SFML/Graphics/ImageStruct.h>
 #include <SFML/Graphics/RenderWindowStruct.h>
+#include <SFML/Graphics/TextureContainer.hpp>
+#include <SFML/Graphics/BlockDecoder.hpp>
+#include <SFML/Graphics/GlFunctions.hpp>
 #include <SFML/Window/WindowStruct.h>
+#include <SFML/System/FileInputStream.hpp>
 #include <SFML/Internal.h>
 #include <SFML/CallbackStream.h>
+#include <SFML/ProfileZone.h>
+#include <algorithm>
+#include <vector>
+
+
+namespace
+{
+    using namespace priv;
+
+    ////////////////////////////////////////////////////////////
+    bool isFormatSupported(const GlFunctions& gl, sfTextureFormat format)
+    {
+        // The list of GL_COMPRESSED_TEXTURE_FORMATS is not reliable (formats
+        // that can't be used as render targets are often missing), so
+        // support is deduced from the extensions and the version instead
+        if (!gl.HasCompression)
+            return format == sfTextureFormatRgba8;
+
+        switch (format)
+        {
+            case sfTextureFormatRgba8:
+                return true;
+
+            case sfTextureFormatBc1:
+            case sfTextureFormatBc2:
+            case sfTextureFormatBc3:
+                return hasExtension(gl, "GL_EXT_texture_compression_s3tc");
+
+            case sfTextureFormatBc4:
+            case sfTextureFormatBc5:
+                return hasVersion(gl, false, 3, 0) || hasExtension(gl, "GL_ARB_texture_compression_rgtc") ||
+                       hasExtension(gl, "GL_EXT_texture_compression_rgtc");
+
+            case sfTextureFormatBc7:
+                return hasVersion(gl, false, 4, 2) || hasExtension(gl, "GL_ARB_texture_compression_bptc") ||
+                       hasExtension(gl, "GL_EXT_texture_compression_bptc");
+
+            case sfTextureFormatEtc2Rgb:
+            case sfTextureFormatEtc2Rgba:
+                return hasVersion(gl, false, 4, 3) || hasVersion(gl, true, 3, 0) || hasExtension(gl, "GL_ARB_ES3_compatibility");
+
+            case sfTextureFormatAstc:
+                return hasExtension(gl, "GL_KHR_texture_compression_astc_ldr");
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool readFile(const char* filename, std::vector<sfUint8>& data)
+    {
+        sf::FileInputStream stream;
+        if (!filename || !stream.open(filename))
+            return false;
+
+        sf::Int64 size = stream.getSize();
+        if (size <= 0)
+            return false;
+
+        data.resize(static_cast<std::size_t>(size));
+        return stream.read(&data[0], size) == size;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool uploadCompressedLevels(const GlFunctions& gl, const TextureContainer& container)
+    {
+        GLenum internalFormat = getInternalFormat(container);
+
+        // Flush previous errors, so that a refused upload can be detected
+        for (int i = 0; i < 16; ++i)
+        {
+            if (gl.GetError() == GL_NO_ERROR)
+                break;
+        }
+
+        for (std::size_t i = 0; i < container.Levels.size(); ++i)
+        {
+            const TextureLevel& level = container.Levels[i];
+            gl.CompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), internalFormat, static_cast<GLsizei>(level.Width),
+                                    static_cast<GLsizei>(level.Height), 0, static_cast<GLsizei>(level.Size), level.Data);
+        }
+
+        return gl.GetError() == GL_NO_ERROR;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void uploadLevels(const GlFunctions& gl, const TextureContainer& container)
+    {
+        // The driver may still refuse a format it advertises (some ASTC block
+        // sizes for example), in which case the levels are decoded after all
+        bool native = (container.Format != sfTextureFormatRgba8) && isFormatSupported(gl, container.Format);
+        if (!native || !uploadCompressedLevels(gl, container))
+        {
+            std::vector<sfUint8> pixels;
+            for (std::size_t i = 0; i < container.Levels.size(); ++i)
+            {
+                const TextureLevel& level = container.Levels[i];
+                const sfUint8* data = level.Data;
+                if (container.Format != sfTextureFormatRgba8)
+                {
+                    decodeLevel(container, level, pixels);
+                    data = &pixels[0];
+                }
+
+                gl.TexImage2D(GL_TEXTURE_2D, static_cast<GLint>(i), GL_RGBA8, static_cast<GLsizei>(level.Width),
+                              static_cast<GLsizei>(level.Height), 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            }
+        }
+
+        if (container.Levels.size() > 1)
+        {
+            gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(container.Levels.size() - 1));
+            gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTexture* createFromContainer(const TextureContainer& container)
+    {
+        const TextureLevel& base = container.Levels[0];
+
+        sfTexture* texture = new sfTexture;
+        if (!texture->This->create(base.Width, base.Height))
+        {
+            delete texture;
+            return NULL;
+        }
+
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+
+        if (!gl.HasCompression)
+        {
+            // Only the full size level can be uploaded through sf::Texture
+            std::vector<sfUint8> pixels;
+            decodeLevel(container, base, pixels);
+            texture->This->update(&pixels[0]);
+            return texture;
+        }
+
+        GLint previousTexture = 0;
+        gl.GetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+        gl.BindTexture(GL_TEXTURE_2D, texture->This->getNativeHandle());
+
+        uploadLevels(gl, container);
+
+        gl.BindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previousTexture));
+        gl.Flush();
+
+        return texture;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTexture* createFromKtx(const void* data, std::size_t size)
+    {
+        TextureContainer container;
+        if (!data || !parseKtx(data, size, container))
+            return NULL;
+
+        return createFromContainer(container);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTexture* createFromDds(const void* data, std::size_t size)
+    {
+        TextureContainer container;
+        if (!data || !parseDds(data, size, container))
+            return NULL;
+
+        return createFromContainer(container);
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_create(unsigned int width, unsigned int height)
 {
+    CSFML_PROFILE_ZONE("sfTexture_create");
+
     sfTexture* texture = new sfTexture;
 
     if (!texture->This->create(width, height))
@@ -52,6 +237,8 @@ sfTexture* sfTexture_create(unsigned int width, unsigned int height)
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_createFromFile(const char* filename, const sfIntRect* area)
 {
+    CSFML_PROFILE_ZONE("sfTexture_createFromFile");
+
     sfTexture* texture = new sfTexture;
 
     sf::IntRect rect;
@@ -71,6 +258,8 @@ sfTexture* sfTexture_createFromFile(const char* filename, const sfIntRect* area)
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_createFromMemory(const void* data, size_t sizeInBytes, const sfIntRect* area)
 {
+    CSFML_PROFILE_ZONE("sfTexture_createFromMemory");
+
     sfTexture* texture = new sfTexture;
 
     sf::IntRect rect;
@@ -90,6 +279,8 @@ sfTexture* sfTexture_createFromMemory(const void* data, size_t sizeInBytes, cons
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_createFromStream(sfInputStream* stream, const sfIntRect* area)
 {
+    CSFML_PROFILE_ZONE("sfTexture_createFromStream");
+
     CSFML_CHECK_RETURN(stream, NULL);
 
     sfTexture* texture = new sfTexture;
@@ -112,6 +303,8 @@ sfTexture* sfTexture_createFromStream(sfInputStream* stream, const sfIntRect* ar
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_createFromImage(const sfImage* image, const sfIntRect* area)
 {
+    CSFML_PROFILE_ZONE("sfTexture_createFromImage");
+
     CSFML_CHECK_RETURN(image, NULL);
 
     sfTexture* texture = new sfTexture;
@@ -130,6 +323,58 @@ sfTexture* sfTexture_createFromImage(const sfImage* image, const sfIntRect* area
 }
 
 
+////////////////////////////////////////////////////////////
+sfTexture* sfTexture_createFromKTX(const char* filename)
+{
+    CSFML_PROFILE_ZONE("sfTexture_createFromKTX");
+
+    std::vector<sfUint8> data;
+    if (!readFile(filename, data))
+        return NULL;
+
+    return createFromKtx(&data[0], data.size());
+}
+
+
+////////////////////////////////////////////////////////////
+sfTexture* sfTexture_createFromKTXMemory(const void* data, size_t sizeInBytes)
+{
+    CSFML_PROFILE_ZONE("sfTexture_createFromKTXMemory");
+
+    return createFromKtx(data, sizeInBytes);
+}
+
+
+////////////////////////////////////////////////////////////
+sfTexture* sfTexture_createFromDDS(const char* filename)
+{
+    CSFML_PROFILE_ZONE("sfTexture_createFromDDS");
+
+    std::vector<sfUint8> data;
+    if (!readFile(filename, data))
+        return NULL;
+
+    return createFromDds(&data[0], data.size());
+}
+
+
+////////////////////////////////////////////////////////////
+sfTexture* sfTexture_createFromDDSMemory(const void* data, size_t sizeInBytes)
+{
+    CSFML_PROFILE_ZONE("sfTexture_createFromDDSMemory");
+
+    return createFromDds(data, sizeInBytes);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfTexture_isFormatSupported(sfTextureFormat format)
+{
+    priv::ActiveContext context;
+    return isFormatSupported(priv::getGlFunctions(), format) ? sfTrue : sfFalse;
+}
+
+
 ////////////////////////////////////////////////////////////
 sfTexture* sfTexture_copy(const sfTexture* texture)
 {
@@ -174,37 +419,64 @@ sfImage* sfTexture_copyToImage(const sfTexture* texture)
 }
 
 
+////////////////////////////////////////////////////////////
+sfTextureReadback* sfTexture_copyToImageAsync(const sfTexture* texture)
+{
+    CSFML_CHECK_RETURN(texture, NULL);
+    CSFML_CHECK_RETURN(texture->This, NULL);
+
+    return priv::readbackTexture(*texture->This, texture->Flipped);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfTexture_updateFromPixels(sfTexture* texture, const sfUint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y)
 {
+    CSFML_PROFILE_ZONE("sfTexture_updateFromPixels");
+
+    CSFML_CHECK(texture);
+
     CSFML_CALL_PTR(texture, update(pixels, width, height, x, y));
+    texture->Flipped = false;
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfTexture_updateFromImage(sfTexture* texture, const sfImage* image, unsigned int x, unsigned int y)
 {
+    CSFML_PROFILE_ZONE("sfTexture_updateFromImage");
+
+    CSFML_CHECK(texture);
     CSFML_CHECK(image);
 
     CSFML_CALL_PTR(texture, update(image->This, x, y));
+    texture->Flipped = false;
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfTexture_updateFromWindow(sfTexture* texture, const sfWindow* window, unsigned int x, unsigned int y)
 {
+    CSFML_PROFILE_ZONE("sfTexture_updateFromWindow");
+
+    CSFML_CHECK(texture);
     CSFML_CHECK(window);
 
     CSFML_CALL_PTR(texture, update(window->This, x, y));
+    texture->Flipped = true;
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfTexture_updateFromRenderWindow(sfTexture* texture, const sfRenderWindow* renderWindow, unsigned int x, unsigned int y)
 {
+    CSFML_PROFILE_ZONE("sfTexture_updateFromRenderWindow");
+
+    CSFML_CHECK(texture);
     CSFML_CHECK(renderWindow);
 
     CSFML_CALL_PTR(texture, update(renderWindow->This, x, y));
+    texture->Flipped = true;
 }
 
 
@@ -266,9 +538,11 @@ sfBool sfTexture_generateMipmap(sfTexture* texture)
 ////////////////////////////////////////////////////////////
 void sfTexture_swap(sfTexture* left, sfTexture* right)
 {
+    CSFML_CHECK(left);
     CSFML_CHECK(right);
 
     CSFML_CALL_PTR(left, swap(*right->This));
+    std::swap(left->Flipped, right->Flipped);
 }
 
 
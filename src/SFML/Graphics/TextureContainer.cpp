@@ -0,0 +1,640 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureContainer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+
+namespace
+{
+    // Identifiers at the beginning of the files
+    const sfUint8 ktx1Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+    const sfUint8 ktx2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    const sfUint8 ddsIdentifier[4]   = {'D', 'D', 'S', ' '};
+
+    // OpenGL formats found in KTX 1 files
+    const sfUint32 GL_UNSIGNED_BYTE                     = 0x1401;
+    const sfUint32 GL_RGBA                              = 0x1908;
+    const sfUint32 GL_RGBA8                             = 0x8058;
+    const sfUint32 GL_SRGB8_ALPHA8                      = 0x8C43;
+    const sfUint32 GL_COMPRESSED_RGB_S3TC_DXT1          = 0x83F0;
+    const sfUint32 GL_COMPRESSED_RGBA_S3TC_DXT1         = 0x83F1;
+    const sfUint32 GL_COMPRESSED_RGBA_S3TC_DXT3         = 0x83F2;
+    const sfUint32 GL_COMPRESSED_RGBA_S3TC_DXT5         = 0x83F3;
+    const sfUint32 GL_COMPRESSED_SRGB_S3TC_DXT1         = 0x8C4C;
+    const sfUint32 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1   = 0x8C4D;
+    const sfUint32 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3   = 0x8C4E;
+    const sfUint32 GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5   = 0x8C4F;
+    const sfUint32 GL_COMPRESSED_RED_RGTC1              = 0x8DBB;
+    const sfUint32 GL_COMPRESSED_RG_RGTC2               = 0x8DBD;
+    const sfUint32 GL_COMPRESSED_RGBA_BPTC_UNORM        = 0x8E8C;
+    const sfUint32 GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM  = 0x8E8D;
+    const sfUint32 GL_ETC1_RGB8                         = 0x8D64;
+    const sfUint32 GL_COMPRESSED_RGB8_ETC2              = 0x9274;
+    const sfUint32 GL_COMPRESSED_SRGB8_ETC2             = 0x9275;
+    const sfUint32 GL_COMPRESSED_RGBA8_ETC2_EAC         = 0x9278;
+    const sfUint32 GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC  = 0x9279;
+    const sfUint32 GL_COMPRESSED_RGBA_ASTC_4x4          = 0x93B0;
+    const sfUint32 GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4  = 0x93D0;
+
+    // Dimensions of the ASTC blocks, in the order of their OpenGL and Vulkan formats
+    const unsigned int astcBlockCount = 14;
+    const unsigned int astcBlocks[astcBlockCount][2] =
+    {
+        {4, 4}, {5, 4}, {5, 5}, {6, 5}, {6, 6}, {8, 5}, {8, 6}, {8, 8}, {10, 5}, {10, 6}, {10, 8}, {10, 10}, {12, 10}, {12, 12}
+    };
+
+    // Flags of the DDS headers
+    const sfUint32 DDSD_MIPMAPCOUNT        = 0x20000;
+    const sfUint32 DDPF_ALPHAPIXELS        = 0x1;
+    const sfUint32 DDPF_ALPHA              = 0x2;
+    const sfUint32 DDPF_FOURCC             = 0x4;
+    const sfUint32 DDPF_RGB                = 0x40;
+    const sfUint32 DDPF_LUMINANCE          = 0x20000;
+    const sfUint32 DDSCAPS2_CUBEMAP        = 0x200;
+    const sfUint32 DDSCAPS2_VOLUME         = 0x200000;
+    const sfUint32 D3D10_DIMENSION_TEXTURE2D = 3;
+    const sfUint32 D3D10_MISC_TEXTURECUBE  = 0x4;
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 read32(const sfUint8* data, bool swap = false)
+    {
+        if (swap)
+            return (static_cast<sfUint32>(data[0]) << 24) | (static_cast<sfUint32>(data[1]) << 16) | (static_cast<sfUint32>(data[2]) << 8) | data[3];
+        else
+            return (static_cast<sfUint32>(data[3]) << 24) | (static_cast<sfUint32>(data[2]) << 16) | (static_cast<sfUint32>(data[1]) << 8) | data[0];
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint64 read64(const sfUint8* data)
+    {
+        return (static_cast<sfUint64>(read32(data + 4)) << 32) | read32(data);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 makeFourCC(char a, char b, char c, char d)
+    {
+        return static_cast<sfUint32>(a) | (static_cast<sfUint32>(b) << 8) | (static_cast<sfUint32>(c) << 16) | (static_cast<sfUint32>(d) << 24);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Set the format of a container; sRGB formats are loaded as
+    // linear ones, like every other texture
+    ////////////////////////////////////////////////////////////
+    void setFormat(priv::TextureContainer& container, sfTextureFormat format, unsigned int blockSize, unsigned int blockWidth = 4, unsigned int blockHeight = 4)
+    {
+        container.Format = format;
+        container.BlockWidth = blockWidth;
+        container.BlockHeight = blockHeight;
+        container.BlockSize = blockSize;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool setAstcFormat(priv::TextureContainer& container, unsigned int index)
+    {
+        if (index >= astcBlockCount)
+            return false;
+
+        setFormat(container, sfTextureFormatAstc, 16, astcBlocks[index][0], astcBlocks[index][1]);
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool setGlFormat(priv::TextureContainer& container, sfUint32 internalFormat)
+    {
+        switch (internalFormat)
+        {
+            case GL_RGBA:
+            case GL_RGBA8:
+            case GL_SRGB8_ALPHA8:                     setFormat(container, sfTextureFormatRgba8, 4, 1, 1); return true;
+            case GL_COMPRESSED_RGB_S3TC_DXT1:
+            case GL_COMPRESSED_RGBA_S3TC_DXT1:
+            case GL_COMPRESSED_SRGB_S3TC_DXT1:
+            case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1:  setFormat(container, sfTextureFormatBc1, 8); return true;
+            case GL_COMPRESSED_RGBA_S3TC_DXT3:
+            case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3:  setFormat(container, sfTextureFormatBc2, 16); return true;
+            case GL_COMPRESSED_RGBA_S3TC_DXT5:
+            case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5:  setFormat(container, sfTextureFormatBc3, 16); return true;
+            case GL_COMPRESSED_RED_RGTC1:             setFormat(container, sfTextureFormatBc4, 8); return true;
+            case GL_COMPRESSED_RG_RGTC2:              setFormat(container, sfTextureFormatBc5, 16); return true;
+            case GL_COMPRESSED_RGBA_BPTC_UNORM:
+            case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM: setFormat(container, sfTextureFormatBc7, 16); return true;
+            case GL_ETC1_RGB8:
+            case GL_COMPRESSED_RGB8_ETC2:
+            case GL_COMPRESSED_SRGB8_ETC2:            setFormat(container, sfTextureFormatEtc2Rgb, 8); return true;
+            case GL_COMPRESSED_RGBA8_ETC2_EAC:
+            case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC: setFormat(container, sfTextureFormatEtc2Rgba, 16); return true;
+        }
+
+        if ((internalFormat >= GL_COMPRESSED_RGBA_ASTC_4x4) && (internalFormat < GL_COMPRESSED_RGBA_ASTC_4x4 + astcBlockCount))
+            return setAstcFormat(container, internalFormat - GL_COMPRESSED_RGBA_ASTC_4x4);
+
+        if ((internalFormat >= GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4) && (internalFormat < GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4 + astcBlockCount))
+            return setAstcFormat(container, internalFormat - GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4);
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool setVkFormat(priv::TextureContainer& container, sfUint32 vkFormat)
+    {
+        switch (vkFormat)
+        {
+            case 37:  // VK_FORMAT_R8G8B8A8_UNORM
+            case 43:  // VK_FORMAT_R8G8B8A8_SRGB
+                setFormat(container, sfTextureFormatRgba8, 4, 1, 1);
+                return true;
+            case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+            case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+                setFormat(container, sfTextureFormatBc1, 8);
+                return true;
+            case 135: // VK_FORMAT_BC2_UNORM_BLOCK
+            case 136: // VK_FORMAT_BC2_SRGB_BLOCK
+                setFormat(container, sfTextureFormatBc2, 16);
+                return true;
+            case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+            case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+                setFormat(container, sfTextureFormatBc3, 16);
+                return true;
+            case 139: // VK_FORMAT_BC4_UNORM_BLOCK
+                setFormat(container, sfTextureFormatBc4, 8);
+                return true;
+            case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+                setFormat(container, sfTextureFormatBc5, 16);
+                return true;
+            case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+            case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+                setFormat(container, sfTextureFormatBc7, 16);
+                return true;
+            case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+                setFormat(container, sfTextureFormatEtc2Rgb, 8);
+                return true;
+            case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+                setFormat(container, sfTextureFormatEtc2Rgba, 16);
+                return true;
+        }
+
+        // VK_FORMAT_ASTC_4x4_UNORM_BLOCK to VK_FORMAT_ASTC_12x12_SRGB_BLOCK, UNORM and SRGB alternate
+        if ((vkFormat >= 157) && (vkFormat <= 184))
+            return setAstcFormat(container, (vkFormat - 157) / 2);
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool setDxgiFormat(priv::TextureContainer& container, sfUint32 dxgiFormat)
+    {
+        switch (dxgiFormat)
+        {
+            case 27: // DXGI_FORMAT_R8G8B8A8_TYPELESS
+            case 28: // DXGI_FORMAT_R8G8B8A8_UNORM
+            case 29: // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+                setFormat(container, sfTextureFormatRgba8, 4, 1, 1);
+                return true;
+            case 70: // DXGI_FORMAT_BC1_TYPELESS
+            case 71: // DXGI_FORMAT_BC1_UNORM
+            case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+                setFormat(container, sfTextureFormatBc1, 8);
+                return true;
+            case 73: // DXGI_FORMAT_BC2_TYPELESS
+            case 74: // DXGI_FORMAT_BC2_UNORM
+            case 75: // DXGI_FORMAT_BC2_UNORM_SRGB
+                setFormat(container, sfTextureFormatBc2, 16);
+                return true;
+            case 76: // DXGI_FORMAT_BC3_TYPELESS
+            case 77: // DXGI_FORMAT_BC3_UNORM
+            case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+                setFormat(container, sfTextureFormatBc3, 16);
+                return true;
+            case 79: // DXGI_FORMAT_BC4_TYPELESS
+            case 80: // DXGI_FORMAT_BC4_UNORM
+                setFormat(container, sfTextureFormatBc4, 8);
+                return true;
+            case 82: // DXGI_FORMAT_BC5_TYPELESS
+            case 83: // DXGI_FORMAT_BC5_UNORM
+                setFormat(container, sfTextureFormatBc5, 16);
+                return true;
+            case 97: // DXGI_FORMAT_BC7_TYPELESS
+            case 98: // DXGI_FORMAT_BC7_UNORM
+            case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+                setFormat(container, sfTextureFormatBc7, 16);
+                return true;
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Compute the size of a level of a container; returns false
+    // if the dimensions are invalid
+    ////////////////////////////////////////////////////////////
+    bool getLevel(const priv::TextureContainer& container, sfUint32 width, sfUint32 height, unsigned int index, priv::TextureLevel& level)
+    {
+        if ((width == 0) || (height == 0) || (index >= 32))
+            return false;
+
+        level.Width = std::max<sfUint32>(width >> index, 1);
+        level.Height = std::max<sfUint32>(height >> index, 1);
+        level.Data = NULL;
+
+        sfUint64 blocksX = (static_cast<sfUint64>(level.Width) + container.BlockWidth - 1) / container.BlockWidth;
+        sfUint64 blocksY = (static_cast<sfUint64>(level.Height) + container.BlockHeight - 1) / container.BlockHeight;
+
+        // Both counts fit in 32 bits, so only the last product can overflow
+        sfUint64 blocks = blocksX * blocksY;
+        if (blocks > std::numeric_limits<sfUint64>::max() / container.BlockSize)
+            return false;
+
+        sfUint64 size = blocks * container.BlockSize;
+        level.Size = static_cast<std::size_t>(size);
+
+        return level.Size == size;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Get the number of levels of a container, checking that
+    // the mipmap chain is not longer than the full one
+    ////////////////////////////////////////////////////////////
+    bool getLevelCount(sfUint32 width, sfUint32 height, sfUint32 levelCount, unsigned int& count)
+    {
+        unsigned int fullCount = 1;
+        for (sfUint32 size = std::max(width, height); size > 1; size >>= 1)
+            ++fullCount;
+
+        count = std::max<sfUint32>(levelCount, 1);
+        return count <= fullCount;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Extract a channel of a pixel with its mask, and expand it to 8 bits
+    ////////////////////////////////////////////////////////////
+    struct ChannelMask
+    {
+        explicit ChannelMask(sfUint32 mask) :
+        Mask(mask),
+        Shift(0),
+        Max(0)
+        {
+            if (mask)
+            {
+                while (!((mask >> Shift) & 1))
+                    ++Shift;
+                Max = mask >> Shift;
+            }
+        }
+
+        sfUint8 extract(sfUint32 pixel, sfUint8 defaultValue) const
+        {
+            if (!Max)
+                return defaultValue;
+
+            sfUint64 value = (pixel & Mask) >> Shift;
+            return static_cast<sfUint8>((value * 255 + Max / 2) / Max);
+        }
+
+        sfUint32 Mask;
+        unsigned int Shift;
+        sfUint32 Max;
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Convert the uncompressed levels of a DDS file to RGBA
+    ////////////////////////////////////////////////////////////
+    bool convertDdsPixels(priv::TextureContainer& container, const sfUint8* data, std::size_t size, sfUint32 bitCount, sfUint32 flags, const sfUint32 masks[4])
+    {
+        if ((bitCount != 8) && (bitCount != 16) && (bitCount != 24) && (bitCount != 32))
+            return false;
+
+        ChannelMask red(masks[0]);
+        ChannelMask green(masks[1]);
+        ChannelMask blue(masks[2]);
+        ChannelMask alpha((flags & (DDPF_ALPHAPIXELS | DDPF_ALPHA)) ? masks[3] : 0);
+        bool luminance = (flags & DDPF_LUMINANCE) != 0;
+        std::size_t pixelSize = bitCount / 8;
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < container.Levels.size(); ++i)
+            total += container.Levels[i].Size;
+
+        // Sizes were computed for RGBA pixels, the source pixels may be smaller
+        if (total / 4 * pixelSize > size)
+            return false;
+
+        container.Storage.resize(total);
+        sfUint8* output = &container.Storage[0];
+        for (std::size_t i = 0; i < container.Levels.size(); ++i)
+        {
+            priv::TextureLevel& level = container.Levels[i];
+            std::size_t count = level.Size / 4;
+            for (std::size_t j = 0; j < count; ++j, data += pixelSize)
+            {
+                sfUint32 pixel = 0;
+                for (std::size_t k = 0; k < pixelSize; ++k)
+                    pixel |= static_cast<sfUint32>(data[k]) << (k * 8);
+
+                sfUint8 r = red.extract(pixel, 0);
+                output[j * 4 + 0] = r;
+                output[j * 4 + 1] = luminance ? r : green.extract(pixel, 0);
+                output[j * 4 + 2] = luminance ? r : blue.extract(pixel, 0);
+                output[j * 4 + 3] = alpha.extract(pixel, 255);
+            }
+
+            level.Data = output;
+            output += level.Size;
+        }
+
+        return true;
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    bool parseKtx(const void* data, std::size_t size, TextureContainer& container)
+    {
+        const sfUint8* bytes = static_cast<const sfUint8*>(data);
+        container.Levels.clear();
+        container.Storage.clear();
+
+        if (!bytes || (size < 12))
+            return false;
+
+        if (std::memcmp(bytes, ktx1Identifier, 12) == 0)
+        {
+            if (size < 64)
+                return false;
+
+            // The endianness field tells whether the file was written with the other byte order
+            bool swap;
+            if (read32(bytes + 12) == 0x04030201)
+                swap = false;
+            else if (read32(bytes + 12, true) == 0x04030201)
+                swap = true;
+            else
+                return false;
+
+            sfUint32 glType           = read32(bytes + 16, swap);
+            sfUint32 glFormat         = read32(bytes + 24, swap);
+            sfUint32 glInternalFormat = read32(bytes + 28, swap);
+            sfUint32 width            = read32(bytes + 36, swap);
+            sfUint32 height           = read32(bytes + 40, swap);
+            sfUint32 depth            = read32(bytes + 44, swap);
+            sfUint32 arrayElements    = read32(bytes + 48, swap);
+            sfUint32 faces            = read32(bytes + 52, swap);
+            sfUint32 levelCount       = read32(bytes + 56, swap);
+            sfUint32 keyValueSize     = read32(bytes + 60, swap);
+
+            if ((depth != 0) || (arrayElements != 0) || (faces != 1))
+                return false;
+
+            // Uncompressed textures must be made of 8 bits RGBA pixels
+            bool compressed = (glType == 0) && (glFormat == 0);
+            if (!compressed && ((glType != GL_UNSIGNED_BYTE) || (glFormat != GL_RGBA)))
+                return false;
+
+            unsigned int count;
+            if (!setGlFormat(container, glInternalFormat) || (compressed == (container.Format == sfTextureFormatRgba8)) ||
+                !getLevelCount(width, height, levelCount, count))
+                return false;
+
+            // Each level starts with its size and is padded to 4 bytes
+            sfUint64 offset = 64 + static_cast<sfUint64>(keyValueSize);
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                TextureLevel level;
+                if (!getLevel(container, width, height, i, level) || (offset + 4 > size))
+                    return false;
+
+                sfUint64 levelSize = read32(bytes + offset, swap);
+                offset += 4;
+                if ((levelSize < level.Size) || (offset + levelSize > size))
+                    return false;
+
+                level.Data = bytes + offset;
+                container.Levels.push_back(level);
+                offset += (levelSize + 3) & ~static_cast<sfUint64>(3);
+            }
+
+            return true;
+        }
+        else if (std::memcmp(bytes, ktx2Identifier, 12) == 0)
+        {
+            if (size < 80)
+                return false;
+
+            sfUint32 vkFormat          = read32(bytes + 12);
+            sfUint32 width             = read32(bytes + 20);
+            sfUint32 height            = read32(bytes + 24);
+            sfUint32 depth             = read32(bytes + 28);
+            sfUint32 layers            = read32(bytes + 32);
+            sfUint32 faces             = read32(bytes + 36);
+            sfUint32 levelCount        = read32(bytes + 40);
+            sfUint32 supercompression  = read32(bytes + 44);
+
+            unsigned int count;
+            if ((depth != 0) || (layers != 0) || (faces != 1) || (supercompression != 0) ||
+                !setVkFormat(container, vkFormat) || !getLevelCount(width, height, levelCount, count) ||
+                (80 + static_cast<sfUint64>(count) * 24 > size))
+                return false;
+
+            // The level index follows the header, starting with the full size level
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                sfUint64 offset = read64(bytes + 80 + i * 24);
+                sfUint64 levelSize = read64(bytes + 80 + i * 24 + 8);
+
+                TextureLevel level;
+                if (!getLevel(container, width, height, i, level) || (levelSize < level.Size) ||
+                    (offset > size) || (levelSize > size - offset))
+                    return false;
+
+                level.Data = bytes + offset;
+                container.Levels.push_back(level);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfUint32 getInternalFormat(const TextureContainer& container)
+    {
+        switch (container.Format)
+        {
+            case sfTextureFormatRgba8:    return GL_RGBA8;
+            case sfTextureFormatBc1:      return GL_COMPRESSED_RGBA_S3TC_DXT1;
+            case sfTextureFormatBc2:      return GL_COMPRESSED_RGBA_S3TC_DXT3;
+            case sfTextureFormatBc3:      return GL_COMPRESSED_RGBA_S3TC_DXT5;
+            case sfTextureFormatBc4:      return GL_COMPRESSED_RED_RGTC1;
+            case sfTextureFormatBc5:      return GL_COMPRESSED_RG_RGTC2;
+            case sfTextureFormatBc7:      return GL_COMPRESSED_RGBA_BPTC_UNORM;
+            case sfTextureFormatEtc2Rgb:  return GL_COMPRESSED_RGB8_ETC2;
+            case sfTextureFormatEtc2Rgba: return GL_COMPRESSED_RGBA8_ETC2_EAC;
+            case sfTextureFormatAstc:     break;
+        }
+
+        sfUint32 index = 0;
+        while ((index + 1 < astcBlockCount) && ((astcBlocks[index][0] != container.BlockWidth) || (astcBlocks[index][1] != container.BlockHeight)))
+            ++index;
+
+        return GL_COMPRESSED_RGBA_ASTC_4x4 + index;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    bool parseDds(const void* data, std::size_t size, TextureContainer& container)
+    {
+        const sfUint8* bytes = static_cast<const sfUint8*>(data);
+        container.Levels.clear();
+        container.Storage.clear();
+
+        if (!bytes || (size < 128) || (std::memcmp(bytes, ddsIdentifier, 4) != 0) || (read32(bytes + 4) != 124))
+            return false;
+
+        sfUint32 flags       = read32(bytes + 8);
+        sfUint32 height      = read32(bytes + 12);
+        sfUint32 width       = read32(bytes + 16);
+        sfUint32 levelCount  = (flags & DDSD_MIPMAPCOUNT) ? read32(bytes + 28) : 1;
+        sfUint32 pixelFlags  = read32(bytes + 80);
+        sfUint32 fourCC      = read32(bytes + 84);
+        sfUint32 bitCount    = read32(bytes + 88);
+        sfUint32 masks[4]    = {read32(bytes + 92), read32(bytes + 96), read32(bytes + 100), read32(bytes + 104)};
+        sfUint32 caps2       = read32(bytes + 112);
+        std::size_t offset   = 128;
+
+        if (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+            return false;
+
+        bool convert = false;
+        if (pixelFlags & DDPF_FOURCC)
+        {
+            if (fourCC == makeFourCC('D', 'X', '1', '0'))
+            {
+                if (size < 148)
+                    return false;
+
+                sfUint32 dxgiFormat = read32(bytes + 128);
+                sfUint32 dimension  = read32(bytes + 132);
+                sfUint32 miscFlags  = read32(bytes + 136);
+                sfUint32 arraySize  = read32(bytes + 140);
+                offset = 148;
+
+                if ((dimension != D3D10_DIMENSION_TEXTURE2D) || (miscFlags & D3D10_MISC_TEXTURECUBE) || (arraySize > 1))
+                    return false;
+
+                // BGRA pixels go through the same conversion as the legacy uncompressed formats
+                if ((dxgiFormat == 87) || (dxgiFormat == 88) || (dxgiFormat == 91))
+                {
+                    convert = true;
+                    bitCount = 32;
+                    pixelFlags = (dxgiFormat == 88) ? 0 : DDPF_ALPHAPIXELS;
+                    masks[0] = 0x00FF0000;
+                    masks[1] = 0x0000FF00;
+                    masks[2] = 0x000000FF;
+                    masks[3] = 0xFF000000;
+                    setFormat(container, sfTextureFormatRgba8, 4, 1, 1);
+                }
+                else if (!setDxgiFormat(container, dxgiFormat))
+                {
+                    return false;
+                }
+            }
+            else if (fourCC == makeFourCC('D', 'X', 'T', '1'))
+                setFormat(container, sfTextureFormatBc1, 8);
+            else if ((fourCC == makeFourCC('D', 'X', 'T', '2')) || (fourCC == makeFourCC('D', 'X', 'T', '3')))
+                setFormat(container, sfTextureFormatBc2, 16);
+            else if ((fourCC == makeFourCC('D', 'X', 'T', '4')) || (fourCC == makeFourCC('D', 'X', 'T', '5')))
+                setFormat(container, sfTextureFormatBc3, 16);
+            else if ((fourCC == makeFourCC('A', 'T', 'I', '1')) || (fourCC == makeFourCC('B', 'C', '4', 'U')))
+                setFormat(container, sfTextureFormatBc4, 8);
+            else if ((fourCC == makeFourCC('A', 'T', 'I', '2')) || (fourCC == makeFourCC('B', 'C', '5', 'U')))
+                setFormat(container, sfTextureFormatBc5, 16);
+            else
+                return false;
+        }
+        else if (pixelFlags & (DDPF_RGB | DDPF_LUMINANCE | DDPF_ALPHA))
+        {
+            // Pixels that are already RGBA are used as they are, other layouts are converted
+            convert = (bitCount != 32) || (masks[0] != 0x000000FF) || (masks[1] != 0x0000FF00) || (masks[2] != 0x00FF0000) ||
+                      (masks[3] != 0xFF000000) || !(pixelFlags & DDPF_ALPHAPIXELS) || !(pixelFlags & DDPF_RGB);
+            setFormat(container, sfTextureFormatRgba8, 4, 1, 1);
+        }
+        else
+        {
+            return false;
+        }
+
+        unsigned int count;
+        if (!getLevelCount(width, height, levelCount, count))
+            return false;
+
+        // Levels are stored one after the other
+        std::size_t remaining = size - offset;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            TextureLevel level;
+            if (!getLevel(container, width, height, i, level))
+                return false;
+
+            if (!convert)
+            {
+                if (level.Size > remaining)
+                    return false;
+
+                level.Data = bytes + size - remaining;
+                remaining -= level.Size;
+            }
+
+            container.Levels.push_back(level);
+        }
+
+        return !convert || convertDdsPixels(container, bytes + offset, size - offset, bitCount, pixelFlags, masks);
+    }
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTURECONTAINER_HPP
+#define SFML_TEXTURECONTAINER_HPP
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Texture.h>
+#include <vector>
+#include <cstddef>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Mipmap level of a texture container
+    ////////////////////////////////////////////////////////////
+    struct TextureLevel
+    {
+        unsigned int   Width;  ///< Width of the level, in pixels
+        unsigned int   Height; ///< Height of the level, in pixels
+        const sfUint8* Data;   ///< Blocks of the level, rows stored top to bottom
+        std::size_t    Size;   ///< Size of the data, in bytes
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Texture read from a KTX or DDS file; the levels point
+    // into the file data, or into Storage when the pixels had
+    // to be converted
+    ////////////////////////////////////////////////////////////
+    struct TextureContainer
+    {
+        sfTextureFormat           Format;      ///< Format of the blocks
+        unsigned int              BlockWidth;  ///< Width of a block, in pixels (1 for uncompressed pixels)
+        unsigned int              BlockHeight; ///< Height of a block, in pixels (1 for uncompressed pixels)
+        unsigned int              BlockSize;   ///< Size of a block, in bytes
+        std::vector<TextureLevel> Levels;      ///< Mipmap levels, the first one is the full size texture
+        std::vector<sfUint8>      Storage;     ///< Converted pixels, if any
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Parse a KTX (version 1 or 2) file in memory; arrays,
+    // cubemaps, 3D textures and supercompressed files are
+    // not supported
+    ////////////////////////////////////////////////////////////
+    bool parseKtx(const void* data, std::size_t size, TextureContainer& container);
+
+    ////////////////////////////////////////////////////////////
+    // Parse a DDS file in memory; arrays, cubemaps and volume
+    // textures are not supported
+    ////////////////////////////////////////////////////////////
+    bool parseDds(const void* data, std::size_t size, TextureContainer& container);
+
+    ////////////////////////////////////////////////////////////
+    // Get the OpenGL internal format to upload the blocks of a
+    // container as they are
+    ////////////////////////////////////////////////////////////
+    sfUint32 getInternalFormat(const TextureContainer& container);
+}
+
+
+#endif // SFML_TEXTURECONTAINER_HPP
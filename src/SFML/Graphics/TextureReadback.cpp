@@ -0,0 +1,394 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureReadback.h>
+#include <SFML/Graphics/TextureReadbackStruct.h>
+#include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Graphics/GlFunctions.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/Internal.h>
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+    using namespace priv;
+
+    sf::Mutex poolMutex;
+
+    // Pixel buffers of finished readbacks, reused by the next ones; this
+    // is what turns repeated per-frame readbacks into a ring of buffers
+    struct PooledBuffer
+    {
+        GLuint       Id;
+        std::size_t  Size;
+        unsigned int Idle; ///< Number of buffers acquired since it was pooled
+    };
+
+    // Keeps the shared context alive while buffers exist, so that
+    // their names stay valid until they are deleted
+    class BufferResource : public sf::GlResource
+    {
+    };
+
+    const std::size_t         maxPooledBuffers    = 4;
+    const unsigned int        maxIdleAcquisitions = 8;
+    std::vector<PooledBuffer> pool;
+    std::size_t               bufferCount    = 0;    ///< Number of buffers, pooled or used by readbacks
+    BufferResource*           bufferResource = NULL;
+
+    ////////////////////////////////////////////////////////////
+    // Delete a buffer; poolMutex must be locked and a context
+    // must be active
+    ////////////////////////////////////////////////////////////
+    void deleteBuffer(GLuint id)
+    {
+        getGlFunctions().DeleteBuffers(1, &id);
+
+        if (--bufferCount == 0)
+        {
+            delete bufferResource;
+            bufferResource = NULL;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Delete the pooled buffers at exit
+    ////////////////////////////////////////////////////////////
+    struct PoolCleaner
+    {
+        ~PoolCleaner()
+        {
+            sf::Lock lock(poolMutex);
+
+            if (!pool.empty())
+            {
+                ActiveContext context;
+                for (std::size_t i = 0; i < pool.size(); ++i)
+                    deleteBuffer(pool[i].Id);
+                pool.clear();
+            }
+        }
+    };
+
+    PoolCleaner poolCleaner;
+
+    ////////////////////////////////////////////////////////////
+    // Get a buffer of at least \a size bytes; the returned size
+    // is the actual size of the buffer
+    ////////////////////////////////////////////////////////////
+    PooledBuffer acquireBuffer(std::size_t size)
+    {
+        const GlFunctions& gl = getGlFunctions();
+
+        sf::Lock lock(poolMutex);
+
+        // Trim the buffers that haven't matched the recent requests
+        // (after a resize for instance)
+        for (std::size_t i = pool.size(); i-- > 0;)
+        {
+            if (++pool[i].Idle > maxIdleAcquisitions)
+            {
+                deleteBuffer(pool[i].Id);
+                pool.erase(pool.begin() + i);
+            }
+        }
+
+        // Take the smallest pooled buffer that is large enough
+        std::size_t best = pool.size();
+        for (std::size_t i = 0; i < pool.size(); ++i)
+        {
+            if ((pool[i].Size >= size) && ((best == pool.size()) || (pool[i].Size < pool[best].Size)))
+                best = i;
+        }
+
+        if (best < pool.size())
+        {
+            PooledBuffer buffer = pool[best];
+            pool.erase(pool.begin() + best);
+            return buffer;
+        }
+
+        if (bufferCount++ == 0)
+            bufferResource = new BufferResource;
+
+        PooledBuffer buffer = {0, size, 0};
+        gl.GenBuffers(1, &buffer.Id);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer.Id);
+        gl.BufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), NULL, GL_STREAM_READ);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        return buffer;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void releaseBuffer(GLuint id, std::size_t size)
+    {
+        sf::Lock lock(poolMutex);
+
+        // Make room by deleting the buffer pooled for the longest time
+        if (pool.size() >= maxPooledBuffers)
+        {
+            deleteBuffer(pool[0].Id);
+            pool.erase(pool.begin());
+        }
+
+        PooledBuffer buffer = {id, size, 0};
+        pool.push_back(buffer);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Copy the pixels read from OpenGL to the image of a readback,
+    // dropping the padding and restoring the order of the rows
+    ////////////////////////////////////////////////////////////
+    void copyPixels(sfTextureReadback& readback, const sf::Uint8* source)
+    {
+        if ((readback.Width == 0) || (readback.Height == 0))
+            return;
+
+        std::vector<sf::Uint8> pixels(readback.Width * readback.Height * 4);
+        std::ptrdiff_t sourcePitch = static_cast<std::ptrdiff_t>(readback.Pitch) * 4;
+        std::size_t destinationPitch = readback.Width * 4;
+
+        if (readback.Flipped)
+        {
+            source += sourcePitch * (readback.Height - 1);
+            sourcePitch = -sourcePitch;
+        }
+
+        for (unsigned int y = 0; y < readback.Height; ++y)
+        {
+            std::memcpy(&pixels[y * destinationPitch], source, destinationPitch);
+            source += sourcePitch;
+        }
+
+        readback.Image.create(readback.Width, readback.Height, &pixels[0]);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Insert the fence that tells when the transfer is over
+    ////////////////////////////////////////////////////////////
+    void finishRequest(sfTextureReadback& readback)
+    {
+        const GlFunctions& gl = getGlFunctions();
+
+        if (gl.HasSync)
+            readback.Fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        // Make sure that the transfer starts now rather than at the next flush
+        gl.Flush();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Copy the contents of the pixel buffer to the image, waiting
+    // for the transfer to complete if needed
+    ////////////////////////////////////////////////////////////
+    void complete(sfTextureReadback& readback)
+    {
+        if (!readback.Buffer)
+            return;
+
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback.Buffer);
+        const void* pixels = gl.MapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        if (pixels)
+        {
+            copyPixels(readback, static_cast<const sf::Uint8*>(pixels));
+            gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (readback.Fence)
+            gl.DeleteSync(readback.Fence);
+
+        releaseBuffer(readback.Buffer, readback.BufferSize);
+        readback.Buffer = 0;
+        readback.Fence = NULL;
+    }
+
+    ////////////////////////////////////////////////////////////
+    sfTextureReadback* createReadback(unsigned int width, unsigned int height, unsigned int pitch, bool flipped)
+    {
+        sfTextureReadback* readback = new sfTextureReadback;
+        readback->Buffer     = 0;
+        readback->BufferSize = 0;
+        readback->Fence      = NULL;
+        readback->Width      = width;
+        readback->Height     = height;
+        readback->Pitch      = pitch;
+        readback->Flipped    = flipped;
+
+        return readback;
+    }
+}
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    sfTextureReadback* readbackTexture(const sf::Texture& texture, bool flipped)
+    {
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+
+        sf::Vector2u size = texture.getSize();
+        sfTextureReadback* readback = createReadback(size.x, size.y, size.x, flipped);
+        if (!texture.getNativeHandle())
+            return readback;
+
+        if (!gl.HasBuffers)
+        {
+            // No pixel buffer objects: read the pixels synchronously
+            readback->Image = texture.copyToImage();
+            return readback;
+        }
+
+        GLint previousTexture = 0;
+        gl.GetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+        gl.BindTexture(GL_TEXTURE_2D, texture.getNativeHandle());
+
+        // The OpenGL texture may be larger than the sf::Texture, when
+        // its size had to be rounded to a power of two
+        GLint actualWidth = 0;
+        GLint actualHeight = 0;
+        gl.GetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &actualWidth);
+        gl.GetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &actualHeight);
+        PooledBuffer buffer  = acquireBuffer(static_cast<std::size_t>(actualWidth) * actualHeight * 4);
+        readback->Pitch      = static_cast<unsigned int>(actualWidth);
+        readback->Buffer     = buffer.Id;
+        readback->BufferSize = buffer.Size;
+
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback->Buffer);
+        gl.GetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        gl.BindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previousTexture));
+
+        finishRequest(*readback);
+
+        return readback;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    sfTextureReadback* readbackFramebuffer(unsigned int width, unsigned int height)
+    {
+        const GlFunctions& gl = getGlFunctions();
+
+        // OpenGL stores the rows of framebuffers bottom-up
+        sfTextureReadback* readback = createReadback(width, height, width, true);
+        if (!gl.HasBasics || (width == 0) || (height == 0))
+            return readback;
+
+        if (!gl.HasBuffers)
+        {
+            // No pixel buffer objects: read the pixels synchronously
+            std::vector<sf::Uint8> pixels(width * height * 4);
+            gl.ReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+            copyPixels(*readback, &pixels[0]);
+            return readback;
+        }
+
+        PooledBuffer buffer  = acquireBuffer(static_cast<std::size_t>(width) * height * 4);
+        readback->Buffer     = buffer.Id;
+        readback->BufferSize = buffer.Size;
+
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback->Buffer);
+        gl.ReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        finishRequest(*readback);
+
+        return readback;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureReadback_destroy(sfTextureReadback* readback)
+{
+    if (readback && readback->Buffer)
+    {
+        ActiveContext context;
+        const GlFunctions& gl = getGlFunctions();
+
+        if (readback->Fence)
+            gl.DeleteSync(readback->Fence);
+
+        releaseBuffer(readback->Buffer, readback->BufferSize);
+    }
+
+    delete readback;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfTextureReadback_isReady(const sfTextureReadback* readback)
+{
+    CSFML_CHECK_RETURN(readback, sfFalse);
+
+    // Without sync objects there's no way to know, mapping the buffer will wait
+    if (!readback->Buffer || !readback->Fence)
+        return sfTrue;
+
+    ActiveContext context;
+    GLenum status = getGlFunctions().ClientWaitSync(readback->Fence, 0, 0);
+
+    return ((status == GL_ALREADY_SIGNALED) || (status == GL_CONDITION_SATISFIED)) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfVector2u sfTextureReadback_getSize(const sfTextureReadback* readback)
+{
+    sfVector2u size = {0, 0};
+    CSFML_CHECK_RETURN(readback, size);
+
+    size.x = readback->Width;
+    size.y = readback->Height;
+
+    return size;
+}
+
+
+////////////////////////////////////////////////////////////
+sfImage* sfTextureReadback_getImage(sfTextureReadback* readback)
+{
+    CSFML_CHECK_RETURN(readback, NULL);
+
+    complete(*readback);
+
+    sfImage* image = new sfImage;
+    image->This = readback->Image;
+
+    return image;
+}
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREREADBACKSTRUCT_H
+#define SFML_TEXTUREREADBACKSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTextureReadback
+////////////////////////////////////////////////////////////
+struct sfTextureReadback : public priv::Allocated
+{
+    unsigned int Buffer;     ///< Pixel buffer object receiving the pixels (0 once they're copied to Image)
+    std::size_t  BufferSize; ///< Size of the pixel buffer object, in bytes
+    void*        Fence;      ///< Sync object signaled when the transfer is complete, or NULL
+    unsigned int Width;      ///< Size of the result
+    unsigned int Height;
+    unsigned int Pitch;      ///< Number of pixels per row in the buffer
+    bool         Flipped;    ///< Are the rows stored bottom-up in the buffer?
+    sf::Image    Image;      ///< Result, once it has been read from the buffer
+};
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Start reading the contents of a texture
+    ////////////////////////////////////////////////////////////
+    sfTextureReadback* readbackTexture(const sf::Texture& texture, bool flipped);
+
+    ////////////////////////////////////////////////////////////
+    // Start reading the contents of the framebuffer of the active context
+    ////////////////////////////////////////////////////////////
+    sfTextureReadback* readbackFramebuffer(unsigned int width, unsigned int height);
+}
+
+
+#endif // SFML_TEXTUREREADBACKSTRUCT_H
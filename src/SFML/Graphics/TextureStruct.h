@@ -29,29 +29,33 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTexture
 ////////////////////////////////////////////////////////////
-struct sfTexture
+struct sfTexture : public priv::Allocated
 {
     sfTexture()
     {
         This = new sf::Texture;
         OwnInstance = true;
+        Flipped = false;
     }
 
     sfTexture(sf::Texture* texture)
     {
         This = texture;
         OwnInstance = false;
+        Flipped = false;
     }
 
     sfTexture(const sfTexture& texture)
     {
         This = texture.This ? new sf::Texture(*texture.This) : NULL;
         OwnInstance = true;
+        Flipped = false;
     }
 
     ~sfTexture()
@@ -62,6 +66,7 @@ struct sfTexture
 
     sf::Texture* This;
     bool OwnInstance;
+    bool Flipped; ///< Are the rows stored bottom-up (contents of a window or render texture)?
 };
 
 
@@ -56,6 +56,42 @@ void sfTransformable_destroy(sfTransformable* transformable)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfTransformable_sizeof(void)
+{
+    return sizeof(sfTransformable);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfTransformable_alignof(void)
+{
+    return alignof(sfTransformable);
+}
+
+
+////////////////////////////////////////////////////////////
+sfTransformable* sfTransformable_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfTransformable)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfTransformable_init is not suitably aligned");
+        return NULL;
+    }
+
+    return new (memory) sfTransformable;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformable_deinit(sfTransformable* transformable)
+{
+    if (transformable)
+        transformable->~sfTransformable();
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfTransformable_setPosition(sfTransformable* transformable, sfVector2f position)
 {
@@ -30,12 +30,13 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/Transform.h>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTransformable
 ////////////////////////////////////////////////////////////
-struct sfTransformable
+struct sfTransformable : public priv::Pooled<sfTransformable>
 {
     sf::Transformable   This;
     mutable sfTransform Transform;
@@ -53,6 +53,42 @@ void sfVertexArray_destroy(sfVertexArray* vertexArray)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfVertexArray_sizeof(void)
+{
+    return sizeof(sfVertexArray);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfVertexArray_alignof(void)
+{
+    return alignof(sfVertexArray);
+}
+
+
+////////////////////////////////////////////////////////////
+sfVertexArray* sfVertexArray_init(void* memory)
+{
+    CSFML_CHECK_RETURN(memory, NULL);
+    if (!priv::isAligned(memory, alignof(sfVertexArray)))
+    {
+        sfRaiseError(sfErrorInvalidArgument, "memory passed to sfVertexArray_init is not suitably aligned");
+        return NULL;
+    }
+
+    return new (memory) sfVertexArray;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfVertexArray_deinit(sfVertexArray* vertexArray)
+{
+    if (vertexArray)
+        vertexArray->~sfVertexArray();
+}
+
+
 ////////////////////////////////////////////////////////////
 size_t sfVertexArray_getVertexCount(const sfVertexArray* vertexArray)
 {
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfVertexArray
 ////////////////////////////////////////////////////////////
-struct sfVertexArray
+struct sfVertexArray : public priv::Pooled<sfVertexArray>
 {
     sf::VertexArray This;
 };
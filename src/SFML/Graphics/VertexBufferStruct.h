@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfVertexBuffer
 ////////////////////////////////////////////////////////////
-struct sfVertexBuffer
+struct sfVertexBuffer : public priv::Allocated
 {
     sf::VertexBuffer This;
 };
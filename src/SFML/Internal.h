@@ -26,21 +26,38 @@
 #define SFML_INTERNAL_H
 
 ////////////////////////////////////////////////////////////
-// Define macros to check the validity of CSFML objects in debug run
+// Define macros to check the validity of CSFML objects
+//
+// Checks are compiled in when CSFML_CHECKS is non-zero; it is
+// set by the CSFML_CHECKS CMake option, and defaults to debug
+// builds only. Failed checks are reported with sfRaiseError,
+// so the message only costs something when it's emitted.
 ////////////////////////////////////////////////////////////
-#include <stdio.h>
+#include <SFML/System/Error.h>
+#include <stddef.h>
 
 // this macro avoids the C4127 warning on VC++ ("conditional expression is constant")
 #define ASSERT_FALSE (__LINE__ == -1)
 
-#ifndef NDEBUG
+#ifndef CSFML_CHECKS
+    #ifdef NDEBUG
+        #define CSFML_CHECKS 0
+    #else
+        #define CSFML_CHECKS 1
+    #endif
+#endif
+
+#define CSFML_REPORT_NULL(object_) \
+    sfRaiseError(sfErrorNullObject, "trying to use a null " #object_ " object")
+
+#if CSFML_CHECKS
 
     #define CSFML_CHECK(object_) \
         do \
         { \
             if (object_ == NULL) \
             { \
-                fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+                CSFML_REPORT_NULL(object_); \
                 return; \
             } \
         } \
@@ -55,7 +72,7 @@
             } \
             else \
             { \
-                fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+                CSFML_REPORT_NULL(object_); \
             } \
         } \
         while (ASSERT_FALSE)
@@ -69,7 +86,7 @@
             } \
             else \
             { \
-                fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+                CSFML_REPORT_NULL(object_); \
             } \
         } \
         while (ASSERT_FALSE)
@@ -79,7 +96,7 @@
         { \
             if (object_ == NULL) \
             { \
-                fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+                CSFML_REPORT_NULL(object_); \
                 return default_; \
             } \
         } \
@@ -92,7 +109,7 @@
         } \
         else \
         { \
-            fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+            CSFML_REPORT_NULL(object_); \
             return default_; \
         }
 
@@ -103,7 +120,7 @@
         } \
         else \
         { \
-            fprintf(stderr, "SFML warning: trying to use a null " #object_ " object\n"); \
+            CSFML_REPORT_NULL(object_); \
             return default_; \
         }
 
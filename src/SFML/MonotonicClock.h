@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_MONOTONICCLOCK_H
+#define SFML_MONOTONICCLOCK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Time.h>
+#include <chrono>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Read the monotonic clock of the system, which is also the one
+    // sf::Clock measures elapsed time with (CLOCK_MONOTONIC on Unix,
+    // the performance counter on Windows). The origin is unspecified
+    // but shared by all modules, so timestamps can be compared.
+    ////////////////////////////////////////////////////////////
+    inline sfTime getMonotonicTime()
+    {
+        sfTime time;
+        time.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        return time;
+    }
+}
+
+
+#endif // SFML_MONOTONICCLOCK_H
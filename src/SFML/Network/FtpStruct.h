@@ -29,13 +29,14 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Ftp.hpp>
+#include <SFML/ObjectAllocator.h>
 #include <vector>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtp
 ////////////////////////////////////////////////////////////
-struct sfFtp
+struct sfFtp : public priv::Allocated
 {
     sf::Ftp This;
 };
@@ -44,7 +45,7 @@ struct sfFtp
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpResponse
+struct sfFtpResponse : public priv::Pooled<sfFtpResponse>
 {
     sfFtpResponse(const sf::Ftp::Response& Response)
         : This(Response)
@@ -58,7 +59,7 @@ struct sfFtpResponse
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpDirectoryResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpDirectoryResponse
+struct sfFtpDirectoryResponse : public priv::Pooled<sfFtpDirectoryResponse>
 {
     sfFtpDirectoryResponse(const sf::Ftp::DirectoryResponse& Response)
         : This(Response)
@@ -72,7 +73,7 @@ struct sfFtpDirectoryResponse
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFtpListingResponse
 ////////////////////////////////////////////////////////////
-struct sfFtpListingResponse
+struct sfFtpListingResponse : public priv::Pooled<sfFtpListingResponse>
 {
     sfFtpListingResponse(const sf::Ftp::ListingResponse& Response)
         : This(Response)
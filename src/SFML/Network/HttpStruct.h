@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Http.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttp
 ////////////////////////////////////////////////////////////
-struct sfHttp
+struct sfHttp : public priv::Allocated
 {
     sf::Http This;
 };
@@ -43,7 +44,7 @@ struct sfHttp
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttpRequest
 ////////////////////////////////////////////////////////////
-struct sfHttpRequest
+struct sfHttpRequest : public priv::Pooled<sfHttpRequest>
 {
     sf::Http::Request This;
 };
@@ -52,7 +53,7 @@ struct sfHttpRequest
 ////////////////////////////////////////////////////////////
 // Internal structure of sfHttpResponse
 ////////////////////////////////////////////////////////////
-struct sfHttpResponse
+struct sfHttpResponse : public priv::Pooled<sfHttpResponse>
 {
     sf::Http::Response This;
 };
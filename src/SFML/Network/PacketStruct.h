@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfPacket
 ////////////////////////////////////////////////////////////
-struct sfPacket
+struct sfPacket : public priv::Pooled<sfPacket>
 {
     sf::Packet This;
 };
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketSelector.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfSocketSelector
 ////////////////////////////////////////////////////////////
-struct sfSocketSelector
+struct sfSocketSelector : public priv::Allocated
 {
     sf::SocketSelector This;
 };
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/TcpListener.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTcpListener
 ////////////////////////////////////////////////////////////
-struct sfTcpListener
+struct sfTcpListener : public priv::Allocated
 {
     sf::TcpListener This;
 };
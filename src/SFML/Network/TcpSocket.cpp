@@ -30,6 +30,7 @@
 #include <SFML/Network/PacketStruct.h>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Internal.h>
+#include <SFML/ProfileZone.h>
 #include <string.h>
 
 
@@ -109,6 +110,8 @@ void sfTcpSocket_disconnect(sfTcpSocket* socket)
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_send(sfTcpSocket* socket, const void* data, size_t size)
 {
+    CSFML_PROFILE_ZONE("sfTcpSocket_send");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
 
     return static_cast<sfSocketStatus>(socket->This.send(data, size));
@@ -118,6 +121,8 @@ sfSocketStatus sfTcpSocket_send(sfTcpSocket* socket, const void* data, size_t si
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_sendPartial(sfTcpSocket* socket, const void* data, size_t size, size_t* sent)
 {
+    CSFML_PROFILE_ZONE("sfTcpSocket_sendPartial");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
 
     return static_cast<sfSocketStatus>(socket->This.send(data, size, *sent));
@@ -127,6 +132,8 @@ sfSocketStatus sfTcpSocket_sendPartial(sfTcpSocket* socket, const void* data, si
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_receive(sfTcpSocket* socket, void* data, size_t size, size_t* received)
 {
+    CSFML_PROFILE_ZONE("sfTcpSocket_receive");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
 
     if (received)
@@ -144,6 +151,8 @@ sfSocketStatus sfTcpSocket_receive(sfTcpSocket* socket, void* data, size_t size,
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_sendPacket(sfTcpSocket* socket, sfPacket* packet)
 {
+    CSFML_PROFILE_ZONE("sfTcpSocket_sendPacket");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
@@ -154,6 +163,8 @@ sfSocketStatus sfTcpSocket_sendPacket(sfTcpSocket* socket, sfPacket* packet)
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_receivePacket(sfTcpSocket* socket, sfPacket* packet)
 {
+    CSFML_PROFILE_ZONE("sfTcpSocket_receivePacket");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
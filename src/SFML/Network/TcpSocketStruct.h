@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTcpSocket
 ////////////////////////////////////////////////////////////
-struct sfTcpSocket
+struct sfTcpSocket : public priv::Allocated
 {
     sf::TcpSocket This;
 };
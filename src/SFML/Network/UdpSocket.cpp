@@ -30,6 +30,7 @@
 #include <SFML/Network/PacketStruct.h>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Internal.h>
+#include <SFML/ProfileZone.h>
 #include <string.h>
 
 
@@ -87,6 +88,8 @@ void sfUdpSocket_unbind(sfUdpSocket* socket)
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfUdpSocket_send(sfUdpSocket* socket, const void* data, size_t size, sfIpAddress remoteAddress, unsigned short remotePort)
 {
+    CSFML_PROFILE_ZONE("sfUdpSocket_send");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
 
     // Convert the address
@@ -99,6 +102,8 @@ sfSocketStatus sfUdpSocket_send(sfUdpSocket* socket, const void* data, size_t si
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfUdpSocket_receive(sfUdpSocket* socket, void* data, size_t size, size_t* received, sfIpAddress* remoteAddress, unsigned short* remotePort)
 {
+    CSFML_PROFILE_ZONE("sfUdpSocket_receive");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
 
     sf::IpAddress address;
@@ -125,6 +130,8 @@ sfSocketStatus sfUdpSocket_receive(sfUdpSocket* socket, void* data, size_t size,
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfUdpSocket_sendPacket(sfUdpSocket* socket, sfPacket* packet, sfIpAddress remoteAddress, unsigned short remotePort)
 {
+    CSFML_PROFILE_ZONE("sfUdpSocket_sendPacket");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
@@ -138,6 +145,8 @@ sfSocketStatus sfUdpSocket_sendPacket(sfUdpSocket* socket, sfPacket* packet, sfI
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfUdpSocket_receivePacket(sfUdpSocket* socket, sfPacket* packet, sfIpAddress* remoteAddress, unsigned short* remotePort)
 {
+    CSFML_PROFILE_ZONE("sfUdpSocket_receivePacket");
+
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/UdpSocket.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfUdpSocket
 ////////////////////////////////////////////////////////////
-struct sfUdpSocket
+struct sfUdpSocket : public priv::Allocated
 {
     sf::UdpSocket This;
 };
@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_OBJECTALLOCATOR_H
+#define SFML_OBJECTALLOCATOR_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Allocator.h>
+#include <atomic>
+#include <limits>
+#include <new>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Check that memory provided by the caller is suitably
+    // aligned to construct an object in it
+    ////////////////////////////////////////////////////////////
+    inline bool isAligned(const void* memory, std::size_t alignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(memory) % alignment == 0;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Base of the CSFML structures: allocates them with the
+    // functions passed to sfSetAllocator
+    ////////////////////////////////////////////////////////////
+    class Allocated
+    {
+    public:
+
+        static void* operator new(std::size_t size)
+        {
+            void* pointer = sfMalloc(size);
+            if (!pointer)
+                throw std::bad_alloc();
+
+            return pointer;
+        }
+
+        static void operator delete(void* pointer)
+        {
+            sfFree(pointer);
+        }
+
+        // Placement new must be redeclared, since the class-specific
+        // operator new hides the global ones
+        static void* operator new(std::size_t, void* place)
+        {
+            return place;
+        }
+
+        static void operator delete(void*, void*)
+        {
+        }
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Base of the CSFML structures that are often created and
+    // destroyed: released objects are kept in a free list and
+    // reused by the next allocation of the same type, which
+    // saves a call to the allocator and gives back memory that
+    // is likely still in the cache
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    class Pooled
+    {
+    public:
+
+        static void* operator new(std::size_t size)
+        {
+            void* pointer = getPool().pop(size);
+            if (!pointer)
+                pointer = Allocated::operator new(size);
+
+            return pointer;
+        }
+
+        static void operator delete(void* pointer, std::size_t size)
+        {
+            if (pointer && !getPool().push(pointer, size))
+                Allocated::operator delete(pointer);
+        }
+
+        static void* operator new(std::size_t, void* place)
+        {
+            return place;
+        }
+
+        static void operator delete(void*, void*)
+        {
+        }
+
+    private:
+
+        // Maximum number of free objects kept per type
+        enum {MaxCount = 256};
+
+        struct Node
+        {
+            Node* Next;
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Free list of a type, protected by a spin lock since it's
+        // only held for a couple of instructions
+        ////////////////////////////////////////////////////////////
+        struct Pool
+        {
+            Pool() : Head(NULL), Count(0)
+            {
+                Lock.clear();
+            }
+
+            // Runs during static destruction, so the functions passed
+            // to sfSetAllocator must outlive every other static object
+            ~Pool()
+            {
+                while (Head)
+                {
+                    Node* next = Head->Next;
+                    Allocated::operator delete(Head);
+                    Head = next;
+                }
+            }
+
+            void lock()
+            {
+                while (Lock.test_and_set(std::memory_order_acquire))
+                    ;
+            }
+
+            void unlock()
+            {
+                Lock.clear(std::memory_order_release);
+            }
+
+            void* pop(std::size_t size)
+            {
+                // Derived types have a different size and are not pooled
+                if (size != sizeof(T))
+                    return NULL;
+
+                lock();
+                Node* node = Head;
+                if (node)
+                {
+                    Head = node->Next;
+                    --Count;
+                }
+                unlock();
+
+                return node;
+            }
+
+            bool push(void* pointer, std::size_t size)
+            {
+                if (size != sizeof(T))
+                    return false;
+
+                lock();
+                bool pooled = Count < MaxCount;
+                if (pooled)
+                {
+                    Node* node = static_cast<Node*>(pointer);
+                    node->Next = Head;
+                    Head = node;
+                    ++Count;
+                }
+                unlock();
+
+                return pooled;
+            }
+
+            std::atomic_flag Lock;
+            Node*            Head;
+            unsigned int     Count;
+        };
+
+        static Pool& getPool()
+        {
+            static Pool pool;
+            return pool;
+        }
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    // Standard allocator over the functions passed to
+    // sfSetAllocator, for the containers held by the CSFML
+    // structures
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    class Allocator
+    {
+    public:
+
+        typedef T              value_type;
+        typedef T*             pointer;
+        typedef const T*       const_pointer;
+        typedef T&             reference;
+        typedef const T&       const_reference;
+        typedef std::size_t    size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef Allocator<U> other;
+        };
+
+        Allocator()
+        {
+        }
+
+        template <typename U>
+        Allocator(const Allocator<U>&)
+        {
+        }
+
+        T* allocate(std::size_t count, const void* = NULL)
+        {
+            if (count > max_size())
+                throw std::bad_alloc();
+
+            void* pointer = sfMalloc(count * sizeof(T));
+            if (!pointer)
+                throw std::bad_alloc();
+
+            return static_cast<T*>(pointer);
+        }
+
+        void deallocate(T* pointer, std::size_t)
+        {
+            sfFree(pointer);
+        }
+
+        std::size_t max_size() const
+        {
+            return std::numeric_limits<std::size_t>::max() / sizeof(T);
+        }
+
+        T* address(T& value) const
+        {
+            return &value;
+        }
+
+        const T* address(const T& value) const
+        {
+            return &value;
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* pointer, Args&&... args)
+        {
+            ::new(static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void destroy(U* pointer)
+        {
+            pointer->~U();
+        }
+    };
+
+    template <typename T, typename U>
+    inline bool operator ==(const Allocator<T>&, const Allocator<U>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    inline bool operator !=(const Allocator<T>&, const Allocator<U>&)
+    {
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // String allocated with the functions passed to sfSetAllocator
+    ////////////////////////////////////////////////////////////
+    typedef std::basic_string<char, std::char_traits<char>, Allocator<char> > String;
+}
+
+
+#endif // SFML_OBJECTALLOCATOR_H
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_PROFILEZONE_H
+#define SFML_PROFILEZONE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Profiler.h>
+#include <atomic>
+
+
+////////////////////////////////////////////////////////////
+// State of the profiler, exported by csfml-system so that
+// the zones of every module can test it inline; not part of
+// the public API
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API std::atomic<bool> sfProfiler_enabled;
+
+
+namespace priv
+{
+    ////////////////////////////////////////////////////////////
+    // Profiling zone that lasts until the end of the enclosing
+    // scope. While the profiler is disabled, it only costs a
+    // relaxed load of the flag, without any function call.
+    ////////////////////////////////////////////////////////////
+    class ProfileZone
+    {
+    public:
+
+        explicit ProfileZone(const char* name) :
+        myActive(sfProfiler_enabled.load(std::memory_order_relaxed))
+        {
+            if (myActive)
+                sfProfiler_beginZone(name);
+        }
+
+        ~ProfileZone()
+        {
+            if (myActive)
+                sfProfiler_endZone();
+        }
+
+    private:
+
+        // NonCopyable
+        ProfileZone(const ProfileZone&);
+        ProfileZone& operator =(const ProfileZone&);
+
+        bool myActive; ///< Whether the zone was begun
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+// Profile the rest of the current scope
+////////////////////////////////////////////////////////////
+#define CSFML_PROFILE_ZONE(name) priv::ProfileZone profileZone(name)
+
+
+#endif // SFML_PROFILEZONE_H
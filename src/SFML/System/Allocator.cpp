@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Allocator.h>
+#include <cstdlib>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    void* defaultAllocate(size_t size, void*)
+    {
+        return std::malloc(size);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void defaultDeallocate(void* pointer, void*)
+    {
+        std::free(pointer);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void* defaultReallocate(void* pointer, size_t size, void*)
+    {
+        return std::realloc(pointer, size);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Current allocator; a plain structure with constant
+    // initialization, so that it is usable during static
+    // initialization and destruction of the other modules
+    ////////////////////////////////////////////////////////////
+    struct Allocator
+    {
+        sfAllocateFunction   Allocate;
+        sfDeallocateFunction Deallocate;
+        sfReallocateFunction Reallocate;
+        void*                UserData;
+    };
+
+    Allocator allocator = {&defaultAllocate, &defaultDeallocate, &defaultReallocate, NULL};
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSetAllocator(sfAllocateFunction allocate, sfDeallocateFunction deallocate, sfReallocateFunction reallocate, void* userData)
+{
+    if (allocate && deallocate && reallocate)
+    {
+        allocator.Allocate   = allocate;
+        allocator.Deallocate = deallocate;
+        allocator.Reallocate = reallocate;
+        allocator.UserData   = userData;
+    }
+    else
+    {
+        allocator.Allocate   = &defaultAllocate;
+        allocator.Deallocate = &defaultDeallocate;
+        allocator.Reallocate = &defaultReallocate;
+        allocator.UserData   = NULL;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfMalloc(size_t size)
+{
+    return allocator.Allocate(size, allocator.UserData);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFree(void* pointer)
+{
+    if (pointer)
+        allocator.Deallocate(pointer, allocator.UserData);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfRealloc(void* pointer, size_t size)
+{
+    return allocator.Reallocate(pointer, size, allocator.UserData);
+}
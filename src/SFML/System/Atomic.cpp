@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Atomic.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+
+// The standard atomics can only operate on std::atomic objects, while
+// these functions work on plain C variables: compiler intrinsics are
+// used instead
+#if defined(_MSC_VER)
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Complete a plain aligned read so that it is sequentially
+    // consistent with the interlocked writes: x86 doesn't reorder
+    // loads with locked instructions, so only the compiler must be
+    // kept from moving memory accesses; ARM needs a full barrier
+    ////////////////////////////////////////////////////////////
+    inline void loadBarrier()
+    {
+    #if defined(_M_ARM64)
+        __dmb(_ARM64_BARRIER_ISH);
+    #elif defined(_M_ARM)
+        __dmb(_ARM_BARRIER_ISH);
+    #else
+        _ReadWriteBarrier();
+    #endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_loadInt32(const volatile sfInt32* value)
+{
+    sfInt32 result = *value;
+    loadBarrier();
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storeInt32(volatile sfInt32* value, sfInt32 newValue)
+{
+    _InterlockedExchange(reinterpret_cast<volatile long*>(value), newValue);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_fetchAddInt32(volatile sfInt32* value, sfInt32 amount)
+{
+    return _InterlockedExchangeAdd(reinterpret_cast<volatile long*>(value), amount);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_exchangeInt32(volatile sfInt32* value, sfInt32 newValue)
+{
+    return _InterlockedExchange(reinterpret_cast<volatile long*>(value), newValue);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangeInt32(volatile sfInt32* value, sfInt32* expected, sfInt32 newValue)
+{
+    sfInt32 previous = _InterlockedCompareExchange(reinterpret_cast<volatile long*>(value), newValue, *expected);
+    if (previous == *expected)
+        return sfTrue;
+
+    *expected = previous;
+    return sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_loadInt64(const volatile sfInt64* value)
+{
+#if defined(_M_IX86)
+    // A compare-exchange that can't change the value is the only atomic 64-bit read on 32-bit x86
+    return _InterlockedCompareExchange64(const_cast<volatile sfInt64*>(value), 0, 0);
+#else
+    // Aligned 64-bit reads are atomic on x64 and ARM; on ARM the intrinsic
+    // makes sure that the compiler emits a single 64-bit read
+    #if defined(_M_ARM) || defined(_M_ARM64)
+        sfInt64 result = __iso_volatile_load64(reinterpret_cast<const volatile __int64*>(value));
+    #else
+        sfInt64 result = *value;
+    #endif
+    loadBarrier();
+    return result;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storeInt64(volatile sfInt64* value, sfInt64 newValue)
+{
+    sfAtomic_exchangeInt64(value, newValue);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_fetchAddInt64(volatile sfInt64* value, sfInt64 amount)
+{
+    sfInt64 expected = sfAtomic_loadInt64(value);
+    while (!sfAtomic_compareExchangeInt64(value, &expected, expected + amount))
+        ;
+    return expected;
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_exchangeInt64(volatile sfInt64* value, sfInt64 newValue)
+{
+    sfInt64 expected = sfAtomic_loadInt64(value);
+    while (!sfAtomic_compareExchangeInt64(value, &expected, newValue))
+        ;
+    return expected;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangeInt64(volatile sfInt64* value, sfInt64* expected, sfInt64 newValue)
+{
+    sfInt64 previous = _InterlockedCompareExchange64(value, newValue, *expected);
+    if (previous == *expected)
+        return sfTrue;
+
+    *expected = previous;
+    return sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAtomic_loadPointer(void* const volatile* value)
+{
+    void* result = *value;
+    loadBarrier();
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storePointer(void* volatile* value, void* newValue)
+{
+    _InterlockedExchangePointer(value, newValue);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAtomic_exchangePointer(void* volatile* value, void* newValue)
+{
+    return _InterlockedExchangePointer(value, newValue);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangePointer(void* volatile* value, void** expected, void* newValue)
+{
+    void* previous = _InterlockedCompareExchangePointer(value, newValue, *expected);
+    if (previous == *expected)
+        return sfTrue;
+
+    *expected = previous;
+    return sfFalse;
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_loadInt32(const volatile sfInt32* value)
+{
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storeInt32(volatile sfInt32* value, sfInt32 newValue)
+{
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_fetchAddInt32(volatile sfInt32* value, sfInt32 amount)
+{
+    return __atomic_fetch_add(value, amount, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt32 sfAtomic_exchangeInt32(volatile sfInt32* value, sfInt32 newValue)
+{
+    return __atomic_exchange_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangeInt32(volatile sfInt32* value, sfInt32* expected, sfInt32 newValue)
+{
+    return __atomic_compare_exchange_n(value, expected, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_loadInt64(const volatile sfInt64* value)
+{
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storeInt64(volatile sfInt64* value, sfInt64 newValue)
+{
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_fetchAddInt64(volatile sfInt64* value, sfInt64 amount)
+{
+    return __atomic_fetch_add(value, amount, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfInt64 sfAtomic_exchangeInt64(volatile sfInt64* value, sfInt64 newValue)
+{
+    return __atomic_exchange_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangeInt64(volatile sfInt64* value, sfInt64* expected, sfInt64 newValue)
+{
+    return __atomic_compare_exchange_n(value, expected, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAtomic_loadPointer(void* const volatile* value)
+{
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfAtomic_storePointer(void* volatile* value, void* newValue)
+{
+    __atomic_store_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+void* sfAtomic_exchangePointer(void* volatile* value, void* newValue)
+{
+    return __atomic_exchange_n(value, newValue, __ATOMIC_SEQ_CST);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfAtomic_compareExchangePointer(void* volatile* value, void** expected, void* newValue)
+{
+    return __atomic_compare_exchange_n(value, expected, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? sfTrue : sfFalse;
+}
+
+#endif
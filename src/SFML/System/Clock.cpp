@@ -28,6 +28,7 @@
 #include <SFML/System/Clock.h>
 #include <SFML/System/ClockStruct.h>
 #include <SFML/Internal.h>
+#include <SFML/MonotonicClock.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -71,3 +72,10 @@ sfTime sfClock_restart(sfClock* clock)
     sf::Time time = clock->This.restart();
     return sfMicroseconds(time.asMicroseconds());
 }
+
+
+////////////////////////////////////////////////////////////
+sfTime sfClock_getCurrentTime(void)
+{
+    return priv::getMonotonicTime();
+}
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Clock.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfClock
 ////////////////////////////////////////////////////////////
-struct sfClock
+struct sfClock : public priv::Pooled<sfClock>
 {
     sf::Clock This;
 };
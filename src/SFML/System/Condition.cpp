@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Condition.h>
+#include <SFML/System/ConditionStruct.h>
+#include <SFML/System/FastMutexStruct.h>
+#include <SFML/Internal.h>
+#include <chrono>
+
+
+////////////////////////////////////////////////////////////
+sfCondition* sfCondition_create(void)
+{
+    return new sfCondition;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCondition_destroy(sfCondition* condition)
+{
+    delete condition;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCondition_wait(sfCondition* condition, sfFastMutex* mutex)
+{
+    CSFML_CHECK(condition);
+    CSFML_CHECK(mutex);
+
+    // The mutex is already locked by the caller, and must stay locked on return;
+    // it is released while waiting, so keep the state read by spinning threads up to date
+    std::unique_lock<std::mutex> lock(mutex->This, std::adopt_lock);
+    mutex->Locked.store(false, std::memory_order_relaxed);
+    condition->This.wait(lock);
+    mutex->Locked.store(true, std::memory_order_relaxed);
+    lock.release();
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfCondition_waitFor(sfCondition* condition, sfFastMutex* mutex, sfTime timeout)
+{
+    CSFML_CHECK_RETURN(condition, sfFalse);
+    CSFML_CHECK_RETURN(mutex, sfFalse);
+
+    std::unique_lock<std::mutex> lock(mutex->This, std::adopt_lock);
+    mutex->Locked.store(false, std::memory_order_relaxed);
+    std::cv_status status = condition->This.wait_for(lock, std::chrono::microseconds(timeout.microseconds));
+    mutex->Locked.store(true, std::memory_order_relaxed);
+    lock.release();
+
+    return (status == std::cv_status::no_timeout) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCondition_notifyOne(sfCondition* condition)
+{
+    CSFML_CALL(condition, notify_one());
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCondition_notifyAll(sfCondition* condition)
+{
+    CSFML_CALL(condition, notify_all());
+}
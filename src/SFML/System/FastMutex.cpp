@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FastMutex.h>
+#include <SFML/System/FastMutexStruct.h>
+#include <SFML/Internal.h>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    #include <intrin.h>
+#endif
+
+
+namespace
+{
+    // Bounds of the adaptive spin count; the upper one is roughly
+    // the cost of blocking and waking up a thread
+    const int minSpinLimit = 8;
+    const int maxSpinLimit = 512;
+
+    ////////////////////////////////////////////////////////////
+    // Tell the CPU that we're in a spin loop
+    ////////////////////////////////////////////////////////////
+    inline void pause()
+    {
+    #if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause();
+    #elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+        __builtin_ia32_pause();
+    #elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+        __asm__ __volatile__("yield");
+    #endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfFastMutex* sfFastMutex_create(void)
+{
+    sfFastMutex* mutex = new sfFastMutex;
+    mutex->Locked.store(false, std::memory_order_relaxed);
+    mutex->SpinLimit.store(minSpinLimit * 4, std::memory_order_relaxed);
+
+    return mutex;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFastMutex_destroy(sfFastMutex* mutex)
+{
+    delete mutex;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFastMutex_lock(sfFastMutex* mutex)
+{
+    CSFML_CHECK(mutex);
+
+    if (mutex->This.try_lock())
+    {
+        mutex->Locked.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    // Spin up to twice the number of spins that usually succeed, then
+    // move the estimate towards what this attempt needed (same scheme
+    // as glibc's adaptive mutexes)
+    int limit = mutex->SpinLimit.load(std::memory_order_relaxed);
+    int maxSpins = limit * 2 < maxSpinLimit ? limit * 2 : maxSpinLimit;
+
+    int spins = 0;
+    bool locked = false;
+    while (!locked && (spins < maxSpins))
+    {
+        pause();
+        ++spins;
+
+        // Only attempt to take the lock when it looks free, so that
+        // waiting threads don't bounce its cache line between cores
+        if (!mutex->Locked.load(std::memory_order_relaxed))
+            locked = mutex->This.try_lock();
+    }
+
+    if (!locked)
+        mutex->This.lock();
+
+    mutex->Locked.store(true, std::memory_order_relaxed);
+
+    int updated = limit + (spins - limit) / 8;
+    if (updated < minSpinLimit)
+        updated = minSpinLimit;
+    mutex->SpinLimit.store(updated, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfFastMutex_tryLock(sfFastMutex* mutex)
+{
+    CSFML_CHECK_RETURN(mutex, sfFalse);
+
+    if (!mutex->This.try_lock())
+        return sfFalse;
+
+    mutex->Locked.store(true, std::memory_order_relaxed);
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFastMutex_unlock(sfFastMutex* mutex)
+{
+    CSFML_CHECK(mutex);
+
+    mutex->Locked.store(false, std::memory_order_relaxed);
+    mutex->This.unlock();
+}
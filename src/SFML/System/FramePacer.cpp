@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FramePacer.h>
+#include <SFML/System/FramePacerStruct.h>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+    // Bounds of the sleep margin; sleeping is usually precise to
+    // about a millisecond, but can be much worse on loaded systems
+    const double minSleepMargin     = 200.0;
+    const double maxSleepMargin     = 4000.0;
+    const double initialSleepMargin = 1000.0;
+
+    // Extra time given to predicted frames to absorb small spikes
+    const double predictionSafety = 250.0;
+
+    ////////////////////////////////////////////////////////////
+    sfTime toTime(sf::Int64 microseconds)
+    {
+        sfTime time = {microseconds};
+        return time;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sleep until shortly before the target, then spin on the clock
+    ////////////////////////////////////////////////////////////
+    void waitUntil(sfFramePacer* pacer, sf::Int64 target)
+    {
+        sf::Int64 now = pacer->Clock.getElapsedTime().asMicroseconds();
+        sf::Int64 remaining = target - now;
+        if (remaining > pacer->SleepMargin)
+        {
+            sf::Int64 requested = remaining - static_cast<sf::Int64>(pacer->SleepMargin);
+            sf::sleep(sf::microseconds(requested));
+
+            // Adapt the margin to the measured oversleeping: quickly
+            // when sleeping gets less precise, slowly when it improves
+            sf::Int64 after = pacer->Clock.getElapsedTime().asMicroseconds();
+            double needed = static_cast<double>(after - now - requested) * 1.25;
+            double rate = (needed > pacer->SleepMargin) ? 0.5 : 0.05;
+            pacer->SleepMargin += (needed - pacer->SleepMargin) * rate;
+            pacer->SleepMargin = std::min(std::max(pacer->SleepMargin, minSleepMargin), maxSleepMargin);
+        }
+
+        while (pacer->Clock.getElapsedTime().asMicroseconds() < target)
+        {
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfFramePacer* sfFramePacer_create(sfTime frameTime)
+{
+    sfFramePacer* pacer = new sfFramePacer;
+    pacer->FrameTime     = std::max(frameTime.microseconds, static_cast<sfInt64>(0));
+    pacer->Predictive    = false;
+    pacer->Started       = false;
+    pacer->Cadence       = 0;
+    pacer->FrameStart    = 0;
+    pacer->PresentStart  = -1;
+    pacer->Wait          = 0;
+    pacer->Interval      = 0;
+    pacer->SleepMargin   = initialSleepMargin;
+    pacer->WorkAverage   = 0;
+    pacer->WorkDeviation = 0;
+    pacer->HasWork       = false;
+    pacer->Stats.cpuTime     = sfTime_Zero;
+    pacer->Stats.waitTime    = sfTime_Zero;
+    pacer->Stats.presentTime = sfTime_Zero;
+    pacer->Stats.frameTime   = sfTime_Zero;
+
+    return pacer;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFramePacer_destroy(sfFramePacer* pacer)
+{
+    delete pacer;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFramePacer_setFrameTime(sfFramePacer* pacer, sfTime frameTime)
+{
+    CSFML_CHECK(pacer);
+
+    pacer->FrameTime = std::max(frameTime.microseconds, static_cast<sfInt64>(0));
+}
+
+
+////////////////////////////////////////////////////////////
+sfTime sfFramePacer_getFrameTime(const sfFramePacer* pacer)
+{
+    CSFML_CHECK_RETURN(pacer, sfTime_Zero);
+
+    return toTime(pacer->FrameTime);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFramePacer_setPredictive(sfFramePacer* pacer, sfBool enabled)
+{
+    CSFML_CHECK(pacer);
+
+    pacer->Predictive = enabled == sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+sfTime sfFramePacer_beginFrame(sfFramePacer* pacer)
+{
+    CSFML_CHECK_RETURN(pacer, sfTime_Zero);
+
+    sf::Int64 now = pacer->Clock.getElapsedTime().asMicroseconds();
+    if (!pacer->Started)
+        pacer->Cadence = now;
+
+    if (pacer->FrameTime > 0)
+    {
+        // If we're late by more than a frame, don't try to catch
+        // up with a burst of frames: restart the schedule from now
+        if (now > pacer->Cadence + pacer->FrameTime)
+            pacer->Cadence = now;
+
+        sf::Int64 target = pacer->Cadence;
+        if (pacer->Predictive && pacer->HasWork)
+        {
+            // Start late enough for the frame to end when the next one is due
+            double predicted = pacer->WorkAverage + 2 * pacer->WorkDeviation + predictionSafety;
+            sf::Int64 slack = pacer->FrameTime - static_cast<sf::Int64>(predicted);
+            if (slack > 0)
+                target += slack;
+        }
+
+        pacer->Cadence += pacer->FrameTime;
+        waitUntil(pacer, target);
+    }
+
+    sf::Int64 start = pacer->Clock.getElapsedTime().asMicroseconds();
+    pacer->Wait         = start - now;
+    pacer->Interval     = pacer->Started ? start - pacer->FrameStart : 0;
+    pacer->FrameStart   = start;
+    pacer->PresentStart = -1;
+    pacer->Started      = true;
+
+    return toTime(pacer->Wait);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFramePacer_beginPresent(sfFramePacer* pacer)
+{
+    CSFML_CHECK(pacer);
+
+    pacer->PresentStart = pacer->Clock.getElapsedTime().asMicroseconds();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFramePacer_endFrame(sfFramePacer* pacer)
+{
+    CSFML_CHECK(pacer);
+
+    sf::Int64 end = pacer->Clock.getElapsedTime().asMicroseconds();
+    if (pacer->PresentStart < 0)
+        pacer->PresentStart = end;
+
+    pacer->Stats.cpuTime     = toTime(pacer->PresentStart - pacer->FrameStart);
+    pacer->Stats.waitTime    = toTime(pacer->Wait);
+    pacer->Stats.presentTime = toTime(end - pacer->PresentStart);
+    pacer->Stats.frameTime   = toTime(pacer->Interval);
+
+    // Update the prediction of the duration of the next frame
+    double work = static_cast<double>(end - pacer->FrameStart);
+    if (pacer->HasWork)
+    {
+        pacer->WorkDeviation += (std::fabs(work - pacer->WorkAverage) - pacer->WorkDeviation) / 8;
+        pacer->WorkAverage   += (work - pacer->WorkAverage) / 8;
+    }
+    else
+    {
+        pacer->WorkAverage = work;
+        pacer->WorkDeviation = 0;
+        pacer->HasWork = true;
+    }
+
+    pacer->PresentStart = -1;
+}
+
+
+////////////////////////////////////////////////////////////
+sfFrameStats sfFramePacer_getFrameStats(const sfFramePacer* pacer)
+{
+    sfFrameStats stats = {sfTime_Zero, sfTime_Zero, sfTime_Zero, sfTime_Zero};
+    CSFML_CHECK_RETURN(pacer, stats);
+
+    return pacer->Stats;
+}
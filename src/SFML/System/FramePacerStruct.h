@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMEPACERSTRUCT_H
+#define SFML_FRAMEPACERSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/FramePacer.h>
+#include <SFML/System/Clock.hpp>
+#include <SFML/ObjectAllocator.h>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfFramePacer
+//
+// All the times are in microseconds, measured by Clock
+////////////////////////////////////////////////////////////
+struct sfFramePacer : public priv::Allocated
+{
+    sf::Clock    Clock;         ///< Clock measuring all the times
+    sf::Int64    FrameTime;     ///< Target time between the start of two frames (0 = no limit)
+    bool         Predictive;    ///< Delay the start of frames to finish them just in time?
+    bool         Started;       ///< Has a frame already been started?
+    sf::Int64    Cadence;       ///< Scheduled start of the next frame, before prediction
+    sf::Int64    FrameStart;    ///< Start of the current frame, after waiting
+    sf::Int64    PresentStart;  ///< Start of the presentation of the current frame, or -1
+    sf::Int64    Wait;          ///< Time spent waiting for the current frame
+    sf::Int64    Interval;      ///< Time between the start of the previous frame and the current one
+    double       SleepMargin;   ///< Time before the deadline at which sleeping stops and spinning starts
+    double       WorkAverage;   ///< Moving average of the duration of frames, without waiting
+    double       WorkDeviation; ///< Moving average of the deviation of the duration of frames
+    bool         HasWork;       ///< Are WorkAverage and WorkDeviation valid?
+    sfFrameStats Stats;         ///< Timings of the last complete frame
+};
+
+
+#endif // SFML_FRAMEPACERSTRUCT_H
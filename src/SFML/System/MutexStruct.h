@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Mutex.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfMutex
 ////////////////////////////////////////////////////////////
-struct sfMutex
+struct sfMutex : public priv::Allocated
 {
     sf::Mutex This;
 };
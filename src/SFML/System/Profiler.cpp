@@ -0,0 +1,381 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Profiler.h>
+#include <SFML/ProfileZone.h>
+#include <SFML/Internal.h>
+#include <SFML/ObjectAllocator.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+
+namespace
+{
+    // Number of events per allocation of a thread buffer
+    const std::size_t chunkSize = 2048;
+
+    ////////////////////////////////////////////////////////////
+    // Beginning or end of a zone
+    ////////////////////////////////////////////////////////////
+    struct Event
+    {
+        const char* Name; ///< Name of the zone (NULL for an end)
+        sfInt64     Time; ///< Timestamp, in nanoseconds
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Block of events of a thread; only the owner thread writes
+    // it, and publishes new events by incrementing Count
+    ////////////////////////////////////////////////////////////
+    struct Chunk : public priv::Allocated
+    {
+        Chunk() : Count(0), Next(NULL) {}
+
+        Event                    Events[chunkSize];
+        std::atomic<std::size_t> Count;
+        std::atomic<Chunk*>      Next;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Events recorded by a thread
+    ////////////////////////////////////////////////////////////
+    struct ThreadBuffer : public priv::Allocated
+    {
+        unsigned int Id;       ///< Identifier of the thread in the trace
+        std::string  Name;     ///< Name of the thread (protected by the registry mutex)
+        Chunk*       First;    ///< First block of events
+        Chunk*       Last;     ///< Block currently written (owner thread only)
+        unsigned int Epoch;    ///< Value of the registry epoch when the buffer was last reset
+        bool         Finished; ///< Whether the thread has exited (protected by the registry mutex)
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Global state of the profiler; the mutex is only taken when
+    // a thread records its first event, after a clear, and when
+    // the trace is exported
+    ////////////////////////////////////////////////////////////
+    struct Registry
+    {
+        Registry() : Epoch(0), ClearTime(0), NextId(1) {}
+
+        std::atomic<unsigned int>  Epoch;     ///< Incremented on every clear
+        sfInt64                    ClearTime; ///< Time of the last clear
+        unsigned int               NextId;    ///< Identifier of the next registered thread
+        std::mutex                 Mutex;
+        std::vector<ThreadBuffer*> Buffers;
+    };
+
+    ////////////////////////////////////////////////////////////
+    Registry& getRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    ////////////////////////////////////////////////////////////
+    sfInt64 now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void deleteChunks(Chunk* chunk)
+    {
+        while (chunk)
+        {
+            Chunk* next = chunk->Next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Per-thread state: registers the buffer of the thread on its
+    // first event, hands it back to the registry when the thread
+    // exits, and remembers which of the open zones were recorded
+    // (zones begun while the profiler is disabled are not)
+    ////////////////////////////////////////////////////////////
+    struct BufferOwner
+    {
+        BufferOwner() : Buffer(NULL), Depth(0), Recorded(0) {}
+
+        ~BufferOwner()
+        {
+            if (Buffer)
+            {
+                Registry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.Mutex);
+                Buffer->Finished = true;
+            }
+        }
+
+        ThreadBuffer* get()
+        {
+            if (!Buffer)
+            {
+                Registry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.Mutex);
+
+                Buffer = new ThreadBuffer;
+                Buffer->Id       = registry.NextId++;
+                Buffer->First    = new Chunk;
+                Buffer->Last     = Buffer->First;
+                Buffer->Epoch    = registry.Epoch.load();
+                Buffer->Finished = false;
+                registry.Buffers.push_back(Buffer);
+            }
+
+            return Buffer;
+        }
+
+        ThreadBuffer* Buffer;
+        unsigned int  Depth;    ///< Number of open zones
+        sfUint64      Recorded; ///< Bit N is set if the open zone at depth N was recorded (zones deeper than 64 never are)
+    };
+
+    thread_local BufferOwner currentThread;
+
+    ////////////////////////////////////////////////////////////
+    void record(const char* name)
+    {
+        Event event = {name, now()};
+
+        Registry& registry = getRegistry();
+        ThreadBuffer* buffer = currentThread.get();
+
+        // Drop the events recorded before the last clear
+        if (buffer->Epoch != registry.Epoch.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            deleteChunks(buffer->First);
+            buffer->First = new Chunk;
+            buffer->Last  = buffer->First;
+            buffer->Epoch = registry.Epoch.load();
+        }
+
+        Chunk* chunk = buffer->Last;
+        std::size_t count = chunk->Count.load(std::memory_order_relaxed);
+        if (count == chunkSize)
+        {
+            Chunk* next = new Chunk;
+            chunk->Next.store(next, std::memory_order_release);
+            buffer->Last = next;
+            chunk = next;
+            count = 0;
+        }
+
+        chunk->Events[count] = event;
+        chunk->Count.store(count + 1, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void writeString(std::FILE* file, const char* string)
+    {
+        std::fputc('"', file);
+        for (const char* c = string; *c; ++c)
+        {
+            unsigned char character = static_cast<unsigned char>(*c);
+            if ((character == '"') || (character == '\\'))
+                std::fprintf(file, "\\%c", character);
+            else if (character < 0x20)
+                std::fprintf(file, "\\u%04x", character);
+            else
+                std::fputc(character, file);
+        }
+        std::fputc('"', file);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::atomic<bool> sfProfiler_enabled(false);
+
+
+////////////////////////////////////////////////////////////
+void sfProfiler_setEnabled(sfBool enabled)
+{
+    sfProfiler_enabled.store(enabled == sfTrue);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_isEnabled(void)
+{
+    return sfProfiler_enabled.load(std::memory_order_relaxed) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfProfiler_beginZone(const char* name)
+{
+    CSFML_CHECK(name);
+
+    unsigned int depth = currentThread.Depth++;
+    if (depth >= 64)
+        return;
+
+    sfUint64 bit = static_cast<sfUint64>(1) << depth;
+    if (sfProfiler_enabled.load(std::memory_order_relaxed))
+    {
+        record(name);
+        currentThread.Recorded |= bit;
+    }
+    else
+    {
+        currentThread.Recorded &= ~bit;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfProfiler_endZone(void)
+{
+    if (currentThread.Depth == 0)
+        return;
+
+    // Ends are recorded even while disabled, so that the zones
+    // begun before disabling the profiler are closed
+    unsigned int depth = --currentThread.Depth;
+    if ((depth < 64) && (currentThread.Recorded & (static_cast<sfUint64>(1) << depth)))
+        record(NULL);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfProfiler_setThreadName(const char* name)
+{
+    CSFML_CHECK(name);
+
+    ThreadBuffer* buffer = currentThread.get();
+
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    buffer->Name = name;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfProfiler_clear(void)
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+
+    // Buffers of running threads are reset by their owner on its next
+    // event, those of exited threads can be released right away
+    registry.ClearTime = now();
+    registry.Epoch.fetch_add(1);
+
+    std::vector<ThreadBuffer*> buffers;
+    for (std::vector<ThreadBuffer*>::iterator it = registry.Buffers.begin(); it != registry.Buffers.end(); ++it)
+    {
+        if ((*it)->Finished)
+        {
+            deleteChunks((*it)->First);
+            delete *it;
+        }
+        else
+        {
+            buffers.push_back(*it);
+        }
+    }
+    registry.Buffers.swap(buffers);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_saveToFile(const char* filename)
+{
+    CSFML_CHECK_RETURN(filename, sfFalse);
+
+    std::FILE* file = std::fopen(filename, "wb");
+    if (!file)
+        return sfFalse;
+
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    bool first = true;
+
+    for (std::vector<ThreadBuffer*>::const_iterator it = registry.Buffers.begin(); it != registry.Buffers.end(); ++it)
+    {
+        const ThreadBuffer* buffer = *it;
+
+        if (!buffer->Name.empty())
+        {
+            std::fprintf(file, "%s\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", first ? "" : ",", buffer->Id);
+            writeString(file, buffer->Name.c_str());
+            std::fputs("}}", file);
+            first = false;
+        }
+
+        // Ends that match no recorded beginning (because of a clear)
+        // are skipped, as trace viewers would attach them to other zones
+        unsigned int depth = 0;
+        for (const Chunk* chunk = buffer->First; chunk; chunk = chunk->Next.load(std::memory_order_acquire))
+        {
+            std::size_t count = chunk->Count.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Event& event = chunk->Events[i];
+                if (event.Time < registry.ClearTime)
+                    continue;
+
+                if (!event.Name && (depth == 0))
+                    continue;
+
+                // Timestamps are in microseconds, with nanosecond precision
+                std::fprintf(file, "%s\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%lld.%03d", first ? "" : ",",
+                             event.Name ? 'B' : 'E', buffer->Id,
+                             static_cast<long long>(event.Time / 1000), static_cast<int>(event.Time % 1000));
+                if (event.Name)
+                {
+                    std::fputs(",\"name\":", file);
+                    writeString(file, event.Name);
+                    ++depth;
+                }
+                else
+                {
+                    --depth;
+                }
+                std::fputc('}', file);
+                first = false;
+            }
+        }
+    }
+
+    std::fputs("\n]}\n", file);
+
+    bool success = !std::ferror(file);
+    if (std::fclose(file) != 0)
+        success = false;
+
+    return success ? sfTrue : sfFalse;
+}
@@ -0,0 +1,421 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Queue.h>
+#include <SFML/System/QueueStruct.h>
+#include <SFML/System/Allocator.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <thread>
+#include <cstring>
+
+
+namespace
+{
+    // Number of failed attempts before a blocking push / pop goes to sleep
+    const unsigned int spinCount = 64;
+
+    ////////////////////////////////////////////////////////////
+    unsigned char* slot(sfQueue* queue, std::size_t position)
+    {
+        return queue->Slots + (position & (queue->Capacity - 1)) * queue->ElementSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Copy elements between an array and consecutive slots, which
+    // may wrap around the end of the ring
+    ////////////////////////////////////////////////////////////
+    void copyToSlots(sfQueue* queue, std::size_t position, const unsigned char* elements, std::size_t count)
+    {
+        std::size_t index = position & (queue->Capacity - 1);
+        std::size_t first = std::min(count, queue->Capacity - index);
+        std::memcpy(queue->Slots + index * queue->ElementSize, elements, first * queue->ElementSize);
+        std::memcpy(queue->Slots, elements + first * queue->ElementSize, (count - first) * queue->ElementSize);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void copyFromSlots(sfQueue* queue, std::size_t position, unsigned char* elements, std::size_t count)
+    {
+        std::size_t index = position & (queue->Capacity - 1);
+        std::size_t first = std::min(count, queue->Capacity - index);
+        std::memcpy(elements, queue->Slots + index * queue->ElementSize, first * queue->ElementSize);
+        std::memcpy(elements + first * queue->ElementSize, queue->Slots, (count - first) * queue->ElementSize);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Wake up the threads blocked on the other side of the queue;
+    // the fence pairs with the increment of the waiter count, so
+    // that either the waiter sees the change or we see the waiter
+    ////////////////////////////////////////////////////////////
+    void wake(sfQueue* queue, std::atomic<unsigned int>& waiters, std::condition_variable& condition)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(queue->Mutex);
+            condition.notify_all();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Single producer / single consumer: the indices are owned by
+    // one side each, so publishing is a plain release store
+    ////////////////////////////////////////////////////////////
+    std::size_t spscPush(sfQueue* queue, const unsigned char* elements, std::size_t count)
+    {
+        std::size_t tail = queue->Tail.load(std::memory_order_relaxed);
+        if (queue->Capacity - (tail - queue->CachedHead) < count)
+            queue->CachedHead = queue->Head.load(std::memory_order_acquire);
+
+        count = std::min(count, queue->Capacity - (tail - queue->CachedHead));
+        if (count > 0)
+        {
+            copyToSlots(queue, tail, elements, count);
+            queue->Tail.store(tail + count, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t spscPop(sfQueue* queue, unsigned char* elements, std::size_t count)
+    {
+        std::size_t head = queue->Head.load(std::memory_order_relaxed);
+        if (queue->CachedTail - head < count)
+            queue->CachedTail = queue->Tail.load(std::memory_order_acquire);
+
+        count = std::min(count, queue->CachedTail - head);
+        if (count > 0)
+        {
+            copyFromSlots(queue, head, elements, count);
+            queue->Head.store(head + count, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Multi producer / multi consumer (Vyukov's bounded queue): each
+    // slot has a sequence number telling whether it's ready to be
+    // written (== position) or read (== position + 1) for the current
+    // lap, and threads claim positions with a compare-and-swap
+    ////////////////////////////////////////////////////////////
+    bool mpmcPush(sfQueue* queue, const unsigned char* element)
+    {
+        std::size_t position = queue->Tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::atomic<std::size_t>& sequence = queue->Sequences[position & (queue->Capacity - 1)];
+            std::size_t current = sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(current - position);
+
+            if (difference == 0)
+            {
+                if (queue->Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    std::memcpy(slot(queue, position), element, queue->ElementSize);
+                    sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The slot still holds the element of the previous lap: full
+                return false;
+            }
+            else
+            {
+                position = queue->Tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool mpmcPop(sfQueue* queue, unsigned char* element)
+    {
+        std::size_t position = queue->Head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::atomic<std::size_t>& sequence = queue->Sequences[position & (queue->Capacity - 1)];
+            std::size_t current = sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(current - (position + 1));
+
+            if (difference == 0)
+            {
+                if (queue->Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    std::memcpy(element, slot(queue, position), queue->ElementSize);
+                    sequence.store(position + queue->Capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // The slot hasn't been written for this lap yet: empty
+                return false;
+            }
+            else
+            {
+                position = queue->Head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t pushElements(sfQueue* queue, const unsigned char* elements, std::size_t count)
+    {
+        std::size_t pushed = 0;
+        if (queue->Mode == sfQueueSingleProducerSingleConsumer)
+        {
+            pushed = spscPush(queue, elements, count);
+        }
+        else
+        {
+            while ((pushed < count) && mpmcPush(queue, elements + pushed * queue->ElementSize))
+                ++pushed;
+        }
+
+        if (pushed > 0)
+            wake(queue, queue->PopWaiters, queue->NotEmpty);
+
+        return pushed;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t popElements(sfQueue* queue, unsigned char* elements, std::size_t count)
+    {
+        std::size_t popped = 0;
+        if (queue->Mode == sfQueueSingleProducerSingleConsumer)
+        {
+            popped = spscPop(queue, elements, count);
+        }
+        else
+        {
+            while ((popped < count) && mpmcPop(queue, elements + popped * queue->ElementSize))
+                ++popped;
+        }
+
+        if (popped > 0)
+            wake(queue, queue->PushWaiters, queue->NotFull);
+
+        return popped;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Checks used by blocked threads; claimed positions count as
+    // used, so a thread may wake up slightly before it can proceed
+    ////////////////////////////////////////////////////////////
+    bool isFull(const sfQueue* queue)
+    {
+        return queue->Tail.load() - queue->Head.load() >= queue->Capacity;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool isEmpty(const sfQueue* queue)
+    {
+        return queue->Tail.load() == queue->Head.load();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfQueue* sfQueue_create(sfQueueMode mode, size_t elementSize, size_t capacity)
+{
+    if ((elementSize == 0) || (capacity == 0))
+        return NULL;
+
+    // Beyond the largest power of two, the capacity can't be rounded up
+    const std::size_t maxSize = std::numeric_limits<std::size_t>::max();
+    if (capacity > maxSize / 2 + 1)
+        return NULL;
+
+    std::size_t roundedCapacity = 1;
+    while (roundedCapacity < capacity)
+        roundedCapacity *= 2;
+
+    // The slots (and the sequence numbers) must fit in memory
+    if (roundedCapacity > maxSize / elementSize)
+        return NULL;
+    if ((mode == sfQueueMultiProducerMultiConsumer) && (roundedCapacity > maxSize / sizeof(std::atomic<std::size_t>)))
+        return NULL;
+
+    unsigned char* slots = static_cast<unsigned char*>(sfMalloc(roundedCapacity * elementSize));
+    if (!slots)
+        return NULL;
+
+    sfQueue* queue = new sfQueue;
+    queue->Mode        = mode;
+    queue->ElementSize = elementSize;
+    queue->Capacity    = roundedCapacity;
+    queue->Slots       = slots;
+    queue->Sequences   = NULL;
+    queue->CachedHead  = 0;
+    queue->CachedTail  = 0;
+    queue->Tail.store(0);
+    queue->Head.store(0);
+    queue->PushWaiters.store(0);
+    queue->PopWaiters.store(0);
+
+    if (mode == sfQueueMultiProducerMultiConsumer)
+    {
+        void* sequences = sfMalloc(roundedCapacity * sizeof(std::atomic<std::size_t>));
+        if (!sequences)
+        {
+            sfQueue_destroy(queue);
+            return NULL;
+        }
+
+        queue->Sequences = static_cast<std::atomic<std::size_t>*>(sequences);
+        for (std::size_t i = 0; i < roundedCapacity; ++i)
+            new (&queue->Sequences[i]) std::atomic<std::size_t>(i);
+    }
+
+    return queue;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfQueue_destroy(sfQueue* queue)
+{
+    if (!queue)
+        return;
+
+    // The sequences are trivially destructible, they only need to be released
+    sfFree(queue->Sequences);
+    sfFree(queue->Slots);
+    delete queue;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfQueue_getCapacity(const sfQueue* queue)
+{
+    CSFML_CHECK_RETURN(queue, 0);
+
+    return queue->Capacity;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfQueue_getSize(const sfQueue* queue)
+{
+    CSFML_CHECK_RETURN(queue, 0);
+
+    // Read the head first, so that the difference can't be negative
+    std::size_t head = queue->Head.load();
+    std::size_t tail = queue->Tail.load();
+
+    return std::min(tail - head, queue->Capacity);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfQueue_tryPush(sfQueue* queue, const void* element)
+{
+    CSFML_CHECK_RETURN(queue, sfFalse);
+    CSFML_CHECK_RETURN(element, sfFalse);
+
+    return pushElements(queue, static_cast<const unsigned char*>(element), 1) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfQueue_tryPop(sfQueue* queue, void* element)
+{
+    CSFML_CHECK_RETURN(queue, sfFalse);
+    CSFML_CHECK_RETURN(element, sfFalse);
+
+    return popElements(queue, static_cast<unsigned char*>(element), 1) ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfQueue_push(sfQueue* queue, const void* element)
+{
+    CSFML_CHECK(queue);
+    CSFML_CHECK(element);
+
+    for (unsigned int attempts = 1; !pushElements(queue, static_cast<const unsigned char*>(element), 1); ++attempts)
+    {
+        if (attempts < spinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(queue->Mutex);
+        queue->PushWaiters.fetch_add(1);
+        while (isFull(queue))
+            queue->NotFull.wait(lock);
+        queue->PushWaiters.fetch_sub(1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfQueue_pop(sfQueue* queue, void* element)
+{
+    CSFML_CHECK(queue);
+    CSFML_CHECK(element);
+
+    for (unsigned int attempts = 1; !popElements(queue, static_cast<unsigned char*>(element), 1); ++attempts)
+    {
+        if (attempts < spinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(queue->Mutex);
+        queue->PopWaiters.fetch_add(1);
+        while (isEmpty(queue))
+            queue->NotEmpty.wait(lock);
+        queue->PopWaiters.fetch_sub(1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfQueue_pushBatch(sfQueue* queue, const void* elements, size_t count)
+{
+    CSFML_CHECK_RETURN(queue, 0);
+    CSFML_CHECK_RETURN(elements, 0);
+
+    return pushElements(queue, static_cast<const unsigned char*>(elements), count);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfQueue_popBatch(sfQueue* queue, void* elements, size_t maxCount)
+{
+    CSFML_CHECK_RETURN(queue, 0);
+    CSFML_CHECK_RETURN(elements, 0);
+
+    return popElements(queue, static_cast<unsigned char*>(elements), maxCount);
+}
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_QUEUESTRUCT_H
+#define SFML_QUEUESTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Queue.h>
+#include <SFML/ObjectAllocator.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfQueue
+//
+// The producer and consumer sides are separated by padding so
+// that they don't share a cache line; over-aligned allocation
+// (alignas with new) is not available before C++17
+////////////////////////////////////////////////////////////
+struct sfQueue : public priv::Allocated
+{
+    sfQueueMode               Mode;        ///< Concurrency guarantees of the queue
+    std::size_t               ElementSize; ///< Size of an element, in bytes
+    std::size_t               Capacity;    ///< Number of slots, a power of two
+    unsigned char*            Slots;       ///< Storage of the elements
+    std::atomic<std::size_t>* Sequences;   ///< Sequence number of each slot (multi-producer / multi-consumer only)
+    char                      Padding1[64];
+
+    std::atomic<std::size_t>  Tail;        ///< Number of elements pushed (or being pushed) so far
+    std::size_t               CachedHead;  ///< Last value of Head seen by the producer (single producer only)
+    char                      Padding2[64];
+
+    std::atomic<std::size_t>  Head;        ///< Number of elements popped (or being popped) so far
+    std::size_t               CachedTail;  ///< Last value of Tail seen by the consumer (single consumer only)
+    char                      Padding3[64];
+
+    std::atomic<unsigned int> PushWaiters; ///< Number of threads blocked in sfQueue_push
+    std::atomic<unsigned int> PopWaiters;  ///< Number of threads blocked in sfQueue_pop
+    std::mutex                Mutex;       ///< Mutex associated to NotFull and NotEmpty
+    std::condition_variable   NotFull;     ///< Signaled when elements are popped while PushWaiters > 0
+    std::condition_variable   NotEmpty;    ///< Signaled when elements are pushed while PopWaiters > 0
+};
+
+
+#endif // SFML_QUEUESTRUCT_H
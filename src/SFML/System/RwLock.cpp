@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/RwLock.h>
+#include <SFML/System/RwLockStruct.h>
+#include <SFML/Internal.h>
+
+
+////////////////////////////////////////////////////////////
+sfRwLock* sfRwLock_create(void)
+{
+    sfRwLock* lock = new sfRwLock;
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    InitializeSRWLock(&lock->This);
+#else
+    if (pthread_rwlock_init(&lock->This, NULL) != 0)
+    {
+        delete lock;
+        return NULL;
+    }
+#endif
+
+    return lock;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRwLock_destroy(sfRwLock* lock)
+{
+    if (!lock)
+        return;
+
+#if !defined(CSFML_SYSTEM_WINDOWS)
+    pthread_rwlock_destroy(&lock->This);
+#endif
+
+    delete lock;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRwLock_lockRead(sfRwLock* lock)
+{
+    CSFML_CHECK(lock);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    AcquireSRWLockShared(&lock->This);
+#else
+    pthread_rwlock_rdlock(&lock->This);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfRwLock_tryLockRead(sfRwLock* lock)
+{
+    CSFML_CHECK_RETURN(lock, sfFalse);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    return TryAcquireSRWLockShared(&lock->This) ? sfTrue : sfFalse;
+#else
+    return (pthread_rwlock_tryrdlock(&lock->This) == 0) ? sfTrue : sfFalse;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRwLock_unlockRead(sfRwLock* lock)
+{
+    CSFML_CHECK(lock);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    ReleaseSRWLockShared(&lock->This);
+#else
+    pthread_rwlock_unlock(&lock->This);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRwLock_lockWrite(sfRwLock* lock)
+{
+    CSFML_CHECK(lock);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    AcquireSRWLockExclusive(&lock->This);
+#else
+    pthread_rwlock_wrlock(&lock->This);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfRwLock_tryLockWrite(sfRwLock* lock)
+{
+    CSFML_CHECK_RETURN(lock, sfFalse);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    return TryAcquireSRWLockExclusive(&lock->This) ? sfTrue : sfFalse;
+#else
+    return (pthread_rwlock_trywrlock(&lock->This) == 0) ? sfTrue : sfFalse;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRwLock_unlockWrite(sfRwLock* lock)
+{
+    CSFML_CHECK(lock);
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    ReleaseSRWLockExclusive(&lock->This);
+#else
+    pthread_rwlock_unlock(&lock->This);
+#endif
+}
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+#ifndef SFML_RWLOCKSTRUCT_H
+#define SFML_RWLOCKSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+#include <SFML/ObjectAllocator.h>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfRwLock; native reader-writer locks
+// are used since the standard ones need C++14 / C++17
+////////////////////////////////////////////////////////////
+struct sfRwLock : public priv::Allocated
+{
+#if defined(CSFML_SYSTEM_WINDOWS)
+    SRWLOCK This;
+#else
+    pthread_rwlock_t This;
+#endif
+};
+
+
+#endif // SFML_RWLOCKSTRUCT_H
@@ -0,0 +1,465 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/TaskPool.h>
+#include <SFML/System/TaskPoolStruct.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <thread>
+
+
+namespace
+{
+    // Number of failed attempts to find a task before a worker goes to sleep
+    const unsigned int spinCount = 64;
+
+    // Worker running on the current thread, if any
+    thread_local sfTaskWorker* currentWorker = NULL;
+
+    ////////////////////////////////////////////////////////////
+    void releaseTask(sfTask* task)
+    {
+        if (task->References.fetch_sub(1) == 1)
+            delete task;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void wakeWaiters(sfTaskPool* pool)
+    {
+        if (pool->Waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(pool->SleepMutex);
+            pool->Wake.notify_all();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Queue a task whose dependencies are all finished
+    ////////////////////////////////////////////////////////////
+    void schedule(sfTask* task)
+    {
+        sfTaskPool* pool = task->Pool;
+
+        // Counting the task before it's visible guarantees that Queued
+        // never underflows when another thread takes it immediately
+        pool->Queued.fetch_add(1);
+
+        sfTaskQueue& queue = (currentWorker && (currentWorker->Pool == pool)) ? currentWorker->Queue : pool->Injection;
+        {
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Tasks.push_back(task);
+        }
+
+        // Pairs with the increment of Sleepers / Waiters before they check Queued
+        if ((pool->Sleepers.load() > 0) || (pool->Waiters.load() > 0))
+        {
+            std::lock_guard<std::mutex> lock(pool->SleepMutex);
+            pool->Wake.notify_one();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    sfTask* popBack(sfTaskQueue& queue)
+    {
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (queue.Tasks.empty())
+            return NULL;
+
+        sfTask* task = queue.Tasks.back();
+        queue.Tasks.pop_back();
+        return task;
+    }
+
+    ////////////////////////////////////////////////////////////
+    sfTask* popFront(sfTaskQueue& queue)
+    {
+        // Don't wait for a busy queue: its owner is probably using it,
+        // and the next one can be tried instead
+        std::unique_lock<std::mutex> lock(queue.Mutex, std::try_to_lock);
+        if (!lock.owns_lock() || queue.Tasks.empty())
+            return NULL;
+
+        sfTask* task = queue.Tasks.front();
+        queue.Tasks.pop_front();
+        return task;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Take the next task to run: the most recent one of the local
+    // queue, then the oldest submitted one, then a stolen one
+    ////////////////////////////////////////////////////////////
+    sfTask* takeTask(sfTaskPool* pool)
+    {
+        if (pool->Queued.load() == 0)
+            return NULL;
+
+        sfTaskWorker* worker = (currentWorker && (currentWorker->Pool == pool)) ? currentWorker : NULL;
+
+        sfTask* task = worker ? popBack(worker->Queue) : NULL;
+
+        if (!task)
+        {
+            std::lock_guard<std::mutex> lock(pool->Injection.Mutex);
+            if (!pool->Injection.Tasks.empty())
+            {
+                task = pool->Injection.Tasks.front();
+                pool->Injection.Tasks.pop_front();
+            }
+        }
+
+        if (!task)
+        {
+            // Start with the next worker so that thieves spread over the victims
+            std::size_t count = pool->Workers.size();
+            std::size_t first = worker ? worker->Index + 1 : 0;
+            for (std::size_t i = 0; (i < count) && !task; ++i)
+            {
+                sfTaskWorker* victim = pool->Workers[(first + i) % count];
+                if (victim != worker)
+                    task = popFront(victim->Queue);
+            }
+        }
+
+        if (task)
+            pool->Queued.fetch_sub(1);
+
+        return task;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void runTask(sfTask* task)
+    {
+        sfTaskPool* pool = task->Pool;
+
+        task->Function(task->UserData);
+
+        std::vector<sfTask*> dependents;
+        {
+            std::lock_guard<std::mutex> lock(task->Mutex);
+            task->Finished.store(true);
+            dependents.swap(task->Dependents);
+        }
+
+        for (std::vector<sfTask*>::iterator it = dependents.begin(); it != dependents.end(); ++it)
+        {
+            if ((*it)->Pending.fetch_sub(1) == 1)
+                schedule(*it);
+        }
+
+        pool->Unfinished.fetch_sub(1);
+        wakeWaiters(pool);
+
+        releaseTask(task);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Run tasks of a pool until a condition is met, blocking when
+    // there's nothing to do
+    ////////////////////////////////////////////////////////////
+    template <typename Condition>
+    void helpUntil(sfTaskPool* pool, Condition done)
+    {
+        while (!done())
+        {
+            if (sfTask* task = takeTask(pool))
+            {
+                runTask(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(pool->SleepMutex);
+            pool->Waiters.fetch_add(1);
+            while (!done() && (pool->Queued.load() == 0))
+                pool->Wake.wait(lock);
+            pool->Waiters.fetch_sub(1);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void workerMain(sfTaskWorker* worker)
+    {
+        sfTaskPool* pool = worker->Pool;
+        currentWorker = worker;
+
+        unsigned int attempts = 0;
+        while (true)
+        {
+            if (sfTask* task = takeTask(pool))
+            {
+                runTask(task);
+                attempts = 0;
+                continue;
+            }
+
+            // New tasks often follow shortly, spin a little before sleeping
+            if (++attempts < spinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(pool->SleepMutex);
+            pool->Sleepers.fetch_add(1);
+            while (pool->Running.load() && (pool->Queued.load() == 0))
+                pool->Wake.wait(lock);
+            pool->Sleepers.fetch_sub(1);
+
+            if (!pool->Running.load() && (pool->Queued.load() == 0))
+                break;
+
+            attempts = 0;
+        }
+
+        currentWorker = NULL;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Shared state of a parallel for; chunks are handed out by index
+    // so that the counter can't overflow near the end of the range
+    ////////////////////////////////////////////////////////////
+    struct ParallelFor
+    {
+        std::size_t              Begin;
+        std::size_t              End;
+        std::size_t              GrainSize;
+        std::size_t              ChunkCount;
+        std::atomic<std::size_t> NextChunk;
+        void                     (*Function)(size_t, size_t, void*);
+        void*                    UserData;
+    };
+
+    ////////////////////////////////////////////////////////////
+    void runChunks(void* userData)
+    {
+        ParallelFor* loop = static_cast<ParallelFor*>(userData);
+
+        std::size_t chunk;
+        while ((chunk = loop->NextChunk.fetch_add(1)) < loop->ChunkCount)
+        {
+            std::size_t first = loop->Begin + chunk * loop->GrainSize;
+            std::size_t last  = first + std::min(loop->GrainSize, loop->End - first);
+            loop->Function(first, last, loop->UserData);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTaskPool* sfTaskPool_create(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    sfTaskPool* pool = new sfTaskPool;
+    pool->Queued.store(0);
+    pool->Unfinished.store(0);
+    pool->Sleepers.store(0);
+    pool->Waiters.store(0);
+    pool->Running.store(true);
+
+    pool->Workers.resize(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        sfTaskWorker* worker = new sfTaskWorker;
+        worker->Pool   = pool;
+        worker->Index  = i;
+        worker->Thread = new sf::Thread(&workerMain, worker);
+        pool->Workers[i] = worker;
+    }
+
+    // Start the threads once all the workers exist, since they may steal from each other
+    for (unsigned int i = 0; i < threadCount; ++i)
+        pool->Workers[i]->Thread->launch();
+
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTaskPool_destroy(sfTaskPool* pool)
+{
+    if (!pool)
+        return;
+
+    sfTaskPool_waitAll(pool);
+
+    {
+        std::lock_guard<std::mutex> lock(pool->SleepMutex);
+        pool->Running.store(false);
+        pool->Wake.notify_all();
+    }
+
+    for (std::vector<sfTaskWorker*>::iterator it = pool->Workers.begin(); it != pool->Workers.end(); ++it)
+    {
+        (*it)->Thread->wait();
+        delete (*it)->Thread;
+        delete *it;
+    }
+
+    delete pool;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTaskPool_getThreadCount(const sfTaskPool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    return static_cast<unsigned int>(pool->Workers.size());
+}
+
+
+////////////////////////////////////////////////////////////
+sfTask* sfTaskPool_submit(sfTaskPool* pool, void (*function)(void*), void* userData, sfTask* const* dependencies, size_t dependencyCount)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+    CSFML_CHECK_RETURN(function, NULL);
+
+    sfTask* task = new sfTask;
+    task->Function = function;
+    task->UserData = userData;
+    task->Pool     = pool;
+    task->References.store(2);
+    task->Finished.store(false);
+
+    // The extra pending count prevents the task from being scheduled
+    // by a dependency that finishes while the others are registered
+    task->Pending.store(1);
+    pool->Unfinished.fetch_add(1);
+
+    for (size_t i = 0; i < dependencyCount; ++i)
+    {
+        sfTask* dependency = dependencies[i];
+        if (!dependency)
+            continue;
+
+        std::lock_guard<std::mutex> lock(dependency->Mutex);
+        if (!dependency->Finished.load())
+        {
+            task->Pending.fetch_add(1);
+            dependency->Dependents.push_back(task);
+        }
+    }
+
+    if (task->Pending.fetch_sub(1) == 1)
+        schedule(task);
+
+    return task;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTaskPool_parallelFor(sfTaskPool* pool, size_t begin, size_t end, size_t grainSize, void (*function)(size_t, size_t, void*), void* userData)
+{
+    CSFML_CHECK(pool);
+    CSFML_CHECK(function);
+
+    if (begin >= end)
+        return;
+
+    std::size_t count   = end - begin;
+    std::size_t threads = pool->Workers.size() + 1;
+
+    // Default to a few chunks per thread, which balances uneven chunks
+    // without paying the scheduling cost for every index
+    if (grainSize == 0)
+        grainSize = std::max<std::size_t>(count / (threads * 4), 1);
+
+    ParallelFor loop;
+    loop.Begin      = begin;
+    loop.End        = end;
+    loop.GrainSize  = grainSize;
+    loop.ChunkCount = count / grainSize + (count % grainSize ? 1 : 0);
+    loop.Function   = function;
+    loop.UserData   = userData;
+    loop.NextChunk.store(0);
+
+    // The calling thread processes chunks too, so one helper less is needed
+    std::size_t helperCount = std::min(loop.ChunkCount, threads) - 1;
+    std::vector<sfTask*> helpers(helperCount);
+    for (std::size_t i = 0; i < helperCount; ++i)
+        helpers[i] = sfTaskPool_submit(pool, &runChunks, &loop, NULL, 0);
+
+    runChunks(&loop);
+
+    for (std::size_t i = 0; i < helperCount; ++i)
+    {
+        sfTask_wait(helpers[i]);
+        sfTask_release(helpers[i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTaskPool_waitAll(sfTaskPool* pool)
+{
+    CSFML_CHECK(pool);
+
+    struct Condition
+    {
+        sfTaskPool* pool;
+        bool operator()() const {return pool->Unfinished.load() == 0;}
+    };
+    Condition condition = {pool};
+
+    helpUntil(pool, condition);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTask_wait(sfTask* task)
+{
+    CSFML_CHECK(task);
+
+    struct Condition
+    {
+        sfTask* task;
+        bool operator()() const {return task->Finished.load();}
+    };
+    Condition condition = {task};
+
+    helpUntil(task->Pool, condition);
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfTask_isFinished(const sfTask* task)
+{
+    CSFML_CHECK_RETURN(task, sfFalse);
+
+    return task->Finished.load() ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTask_release(sfTask* task)
+{
+    if (!task)
+        return;
+
+    releaseTask(task);
+}
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TASKPOOLSTRUCT_H
+#define SFML_TASKPOOLSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Thread.hpp>
+#include <SFML/ObjectAllocator.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTask
+////////////////////////////////////////////////////////////
+struct sfTask : public priv::Pooled<sfTask>
+{
+    void                  (*Function)(void*); ///< Function to run
+    void*                 UserData;           ///< Argument of the function
+    sfTaskPool*           Pool;               ///< Pool that runs the task
+    std::atomic<unsigned> References;         ///< One reference for the handle, one for the pool until the task has run
+    std::atomic<unsigned> Pending;            ///< Number of unfinished dependencies (+1 while the task is being submitted)
+    std::atomic<bool>     Finished;           ///< Whether the task has run
+    std::mutex            Mutex;              ///< Protects Dependents, and Finished against new dependents
+    std::vector<sfTask*>  Dependents;         ///< Tasks waiting for this one to finish
+};
+
+
+////////////////////////////////////////////////////////////
+// Queue of tasks owned by a worker thread; the worker pushes
+// and pops at the back, other threads steal from the front
+////////////////////////////////////////////////////////////
+struct sfTaskQueue
+{
+    std::mutex          Mutex; ///< Protects Tasks
+    std::deque<sfTask*> Tasks; ///< Tasks ready to run
+};
+
+
+////////////////////////////////////////////////////////////
+// Worker thread of a task pool
+////////////////////////////////////////////////////////////
+struct sfTaskWorker : public priv::Allocated
+{
+    sfTaskPool*  Pool;   ///< Pool that owns the worker
+    unsigned int Index;  ///< Index of the worker in the pool
+    sfTaskQueue  Queue;  ///< Local queue of the worker
+    sf::Thread*  Thread; ///< Thread running the worker
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTaskPool
+////////////////////////////////////////////////////////////
+struct sfTaskPool : public priv::Allocated
+{
+    std::vector<sfTaskWorker*> Workers;    ///< Worker threads
+    sfTaskQueue                Injection;  ///< Tasks submitted from threads that are not workers of the pool
+    std::atomic<std::size_t>   Queued;     ///< Number of tasks in the queues (may briefly exceed it while a task is pushed)
+    std::atomic<std::size_t>   Unfinished; ///< Number of submitted tasks that haven't run yet
+    std::atomic<unsigned int>  Sleepers;   ///< Number of workers blocked on Wake
+    std::atomic<unsigned int>  Waiters;    ///< Number of threads blocked on Wake in sfTask_wait or sfTaskPool_waitAll
+    std::atomic<bool>          Running;    ///< False when the workers must stop
+    std::mutex                 SleepMutex; ///< Mutex associated to Wake
+    std::condition_variable    Wake;       ///< Signaled when a task is queued or finished
+};
+
+
+#endif // SFML_TASKPOOLSTRUCT_H
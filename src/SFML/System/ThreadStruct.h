@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/System/Thread.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfThread
 ////////////////////////////////////////////////////////////
-struct sfThread
+struct sfThread : public priv::Allocated
 {
     sfThread(void (*function)(void*), void* userData) :
     This(function, userData)
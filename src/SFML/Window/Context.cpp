@@ -30,6 +30,10 @@
 #include <SFML/Internal.h>
 #include <SFML/Window/ContextSettingsInternal.h>
 
+#if defined(CSFML_SYSTEM_LINUX) || defined(CSFML_SYSTEM_FREEBSD)
+    #include <X11/Xlib.h>
+#endif
+
 
 ////////////////////////////////////////////////////////////
 sfContext* sfContext_create(void)
@@ -38,6 +42,20 @@ sfContext* sfContext_create(void)
 }
 
 
+////////////////////////////////////////////////////////////
+sfContext* sfContext_createOffscreen(const sfContextSettings* settings, unsigned int width, unsigned int height)
+{
+    // Convert context settings
+    sf::ContextSettings params;
+    if (settings)
+    {
+        priv::sfContextSettings_writeToCpp(*settings, params);
+    }
+
+    return new sfContext(params, width, height);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfContext_destroy(sfContext* context)
 {
@@ -70,3 +88,30 @@ sfUint64 sfContext_getActiveContextId()
 {
     return sf::Context::getActiveContextId();
 }
+
+
+////////////////////////////////////////////////////////////
+sfBool sfContext_isAvailable(void)
+{
+#if defined(CSFML_SYSTEM_LINUX) || defined(CSFML_SYSTEM_FREEBSD)
+
+    // SFML aborts when the X display can't be opened, so try to
+    // connect to it first; the answer won't change during the run
+    static const sfBool available = []
+    {
+        Display* display = XOpenDisplay(NULL);
+        if (!display)
+            return sfFalse;
+
+        XCloseDisplay(display);
+        return sfTrue;
+    }();
+
+    return available;
+
+#else
+
+    return sfTrue;
+
+#endif
+}
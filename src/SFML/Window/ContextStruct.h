@@ -29,13 +29,23 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Context.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfContext
 ////////////////////////////////////////////////////////////
-struct sfContext
+struct sfContext : public priv::Allocated
 {
+    sfContext()
+    {
+    }
+
+    sfContext(const sf::ContextSettings& settings, unsigned int width, unsigned int height) :
+    This(settings, width, height)
+    {
+    }
+
     sf::Context This;
 };
 
@@ -29,12 +29,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Cursor.hpp>
+#include <SFML/ObjectAllocator.h>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfCursor
 ////////////////////////////////////////////////////////////
-struct sfCursor
+struct sfCursor : public priv::Allocated
 {
     sf::Cursor This;
 };
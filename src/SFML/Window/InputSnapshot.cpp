@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2018 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/InputSnapshot.h>
+#include <SFML/Window/WindowStruct.h>
+#include <SFML/Window/Joystick.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
+#include <SFML/Window/Touch.hpp>
+#include <SFML/Internal.h>
+#include <cstring>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Write a change if there's room left, and count it anyway
+    ////////////////////////////////////////////////////////////
+    void addChange(const sfEvent& event, sfEvent* changes, size_t capacity, size_t& count)
+    {
+        if (count < capacity)
+            changes[count] = event;
+
+        ++count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfInputSnapshot_capture(sfInputSnapshot* snapshot, sfUint32 devices, const sfWindow* relativeTo)
+{
+    CSFML_CHECK(snapshot);
+
+    std::memset(snapshot, 0, sizeof(*snapshot));
+
+    if (devices & sfInputKeyboard)
+    {
+        // The events of the window already tell which keys are pressed; without
+        // window, every key has to be queried (a server round-trip each on X11)
+        if (relativeTo)
+            std::memcpy(snapshot->keys, relativeTo->Keys, sizeof(snapshot->keys));
+        else
+            sfInputSnapshot_captureKeys(snapshot, NULL, sfKeyCount);
+    }
+
+    if (devices & sfInputMouse)
+    {
+        for (int button = 0; button < sfMouseButtonCount; ++button)
+            snapshot->mouseButtons[button] = sf::Mouse::isButtonPressed(static_cast<sf::Mouse::Button>(button)) ? sfTrue : sfFalse;
+
+        sf::Vector2i position = relativeTo ? sf::Mouse::getPosition(relativeTo->This) : sf::Mouse::getPosition();
+        snapshot->mousePosition.x = position.x;
+        snapshot->mousePosition.y = position.y;
+    }
+
+    if (devices & sfInputJoystick)
+    {
+        for (unsigned int joystick = 0; joystick < sfJoystickCount; ++joystick)
+        {
+            // Joystick states are cached by SFML, only the connected
+            // joysticks and their existing buttons and axes are read
+            if (!sf::Joystick::isConnected(joystick))
+                continue;
+
+            snapshot->joystickConnected[joystick] = sfTrue;
+
+            unsigned int buttonCount = sf::Joystick::getButtonCount(joystick);
+            for (unsigned int button = 0; button < buttonCount; ++button)
+                snapshot->joystickButtons[joystick][button] = sf::Joystick::isButtonPressed(joystick, button) ? sfTrue : sfFalse;
+
+            for (int axis = 0; axis < sfJoystickAxisCount; ++axis)
+            {
+                sf::Joystick::Axis SFMLAxis = static_cast<sf::Joystick::Axis>(axis);
+                if (sf::Joystick::hasAxis(joystick, SFMLAxis))
+                    snapshot->joystickAxes[joystick][axis] = sf::Joystick::getAxisPosition(joystick, SFMLAxis);
+            }
+        }
+    }
+
+    if (devices & sfInputTouch)
+    {
+        for (unsigned int finger = 0; finger < sfInputSnapshotFingerCount; ++finger)
+        {
+            if (!sf::Touch::isDown(finger))
+                continue;
+
+            sf::Vector2i position = relativeTo ? sf::Touch::getPosition(finger, relativeTo->This) : sf::Touch::getPosition(finger);
+            snapshot->touchDown[finger] = sfTrue;
+            snapshot->touchPositions[finger].x = position.x;
+            snapshot->touchPositions[finger].y = position.y;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfInputSnapshot_captureKeys(sfInputSnapshot* snapshot, const sfKeyCode* keys, size_t keyCount)
+{
+    CSFML_CHECK(snapshot);
+
+    for (size_t i = 0; i < keyCount; ++i)
+    {
+        int key = keys ? keys[i] : static_cast<int>(i);
+        if ((key >= 0) && (key < sfKeyCount))
+            snapshot->keys[key] = sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(key)) ? sfTrue : sfFalse;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfInputSnapshot_diff(const sfInputSnapshot* previous, const sfInputSnapshot* current, sfEvent* changes, size_t capacity)
+{
+    CSFML_CHECK_RETURN(previous, 0);
+    CSFML_CHECK_RETURN(current, 0);
+    if (!changes)
+        capacity = 0;
+
+    size_t count = 0;
+    sfEvent event;
+
+    // Keyboard
+    event.key.alt     = (current->keys[sfKeyLAlt]     || current->keys[sfKeyRAlt])     ? sfTrue : sfFalse;
+    event.key.control = (current->keys[sfKeyLControl] || current->keys[sfKeyRControl]) ? sfTrue : sfFalse;
+    event.key.shift   = (current->keys[sfKeyLShift]   || current->keys[sfKeyRShift])   ? sfTrue : sfFalse;
+    event.key.system  = (current->keys[sfKeyLSystem]  || current->keys[sfKeyRSystem])  ? sfTrue : sfFalse;
+    for (int key = 0; key < sfKeyCount; ++key)
+    {
+        if (previous->keys[key] != current->keys[key])
+        {
+            event.key.type = current->keys[key] ? sfEvtKeyPressed : sfEvtKeyReleased;
+            event.key.code = static_cast<sfKeyCode>(key);
+            addChange(event, changes, capacity, count);
+        }
+    }
+
+    // Mouse
+    for (int button = 0; button < sfMouseButtonCount; ++button)
+    {
+        if (previous->mouseButtons[button] != current->mouseButtons[button])
+        {
+            event.mouseButton.type   = current->mouseButtons[button] ? sfEvtMouseButtonPressed : sfEvtMouseButtonReleased;
+            event.mouseButton.button = static_cast<sfMouseButton>(button);
+            event.mouseButton.x      = current->mousePosition.x;
+            event.mouseButton.y      = current->mousePosition.y;
+            addChange(event, changes, capacity, count);
+        }
+    }
+
+    if ((previous->mousePosition.x != current->mousePosition.x) || (previous->mousePosition.y != current->mousePosition.y))
+    {
+        event.mouseMove.type = sfEvtMouseMoved;
+        event.mouseMove.x    = current->mousePosition.x;
+        event.mouseMove.y    = current->mousePosition.y;
+        addChange(event, changes, capacity, count);
+    }
+
+    // Joysticks
+    for (unsigned int joystick = 0; joystick < sfJoystickCount; ++joystick)
+    {
+        if (previous->joystickConnected[joystick] != current->joystickConnected[joystick])
+        {
+            event.joystickConnect.type       = current->joystickConnected[joystick] ? sfEvtJoystickConnected : sfEvtJoystickDisconnected;
+            event.joystickConnect.joystickId = joystick;
+            addChange(event, changes, capacity, count);
+
+            // The state of a disconnected joystick is meaningless
+            if (!current->joystickConnected[joystick])
+                continue;
+        }
+
+        for (unsigned int button = 0; button < sfJoystickButtonCount; ++button)
+        {
+            if (previous->joystickButtons[joystick][button] != current->joystickButtons[joystick][button])
+            {
+                event.joystickButton.type       = current->joystickButtons[joystick][button] ? sfEvtJoystickButtonPressed : sfEvtJoystickButtonReleased;
+                event.joystickButton.joystickId = joystick;
+                event.joystickButton.button     = button;
+                addChange(event, changes, capacity, count);
+            }
+        }
+
+        for (int axis = 0; axis < sfJoystickAxisCount; ++axis)
+        {
+            if (previous->joystickAxes[joystick][axis] != current->joystickAxes[joystick][axis])
+            {
+                event.joystickMove.type       = sfEvtJoystickMoved;
+                event.joystickMove.joystickId = joystick;
+                event.joystickMove.axis       = static_cast<sfJoystickAxis>(axis);
+                event.joystickMove.position   = current->joystickAxes[joystick][axis];
+                addChange(event, changes, capacity, count);
+            }
+        }
+    }
+
+    // Touch
+    for (unsigned int finger = 0; finger < sfInputSnapshotFingerCount; ++finger)
+    {
+        bool wasDown = previous->touchDown[finger] == sfTrue;
+        bool isDown  = current->touchDown[finger] == sfTrue;
+        const sfVector2i& position = isDown ? current->touchPositions[finger] : previous->touchPositions[finger];
+
+        if (wasDown && isDown && (position.x == previous->touchPositions[finger].x) && (position.y == previous->touchPositions[finger].y))
+            continue;
+
+        if (wasDown || isDown)
+        {
+            event.touch.type   = !wasDown ? sfEvtTouchBegan : (isDown ? sfEvtTouchMoved : sfEvtTouchEnded);
+            event.touch.finger = finger;
+            event.touch.x      = position.x;
+            event.touch.y      = position.y;
+            addChange(event, changes, capacity, count);
+        }
+    }
+
+    return count;
+}
@@ -31,6 +31,35 @@
 #include <SFML/Window/ContextSettingsInternal.h>
 #include <SFML/Window/CursorStruct.h>
 #include <SFML/ConvertEvent.h>
+#include <SFML/EventQueue.h>
+#include <SFML/ProfileZone.h>
+#include <algorithm>
+
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Keep track of the pressed keys according to the events
+    // returned to the application, for sfInputSnapshot_capture
+    ////////////////////////////////////////////////////////////
+    void trackKeys(sfWindow& window, const sfEvent* events, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const sfEvent& event = events[i];
+            if ((event.type == sfEvtKeyPressed) || (event.type == sfEvtKeyReleased))
+            {
+                if ((event.key.code >= 0) && (event.key.code < sfKeyCount))
+                    window.Keys[event.key.code] = (event.type == sfEvtKeyPressed) ? sfTrue : sfFalse;
+            }
+            else if (event.type == sfEvtLostFocus)
+            {
+                // Keys released while the window doesn't have the focus are not reported
+                std::fill(window.Keys, window.Keys + sfKeyCount, sfFalse);
+            }
+        }
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -92,16 +121,51 @@ sfWindow* sfWindow_createFromHandle(sfWindowHandle handle, const sfContextSettin
 }
 
 
+////////////////////////////////////////////////////////////
+sfWindow* sfWindow_createWithEventQueue(sfVideoMode mode, const char* title, sfUint32 style, const sfContextSettings* settings)
+{
+    // Convert video mode
+    sf::VideoMode videoMode(mode.width, mode.height, mode.bitsPerPixel);
+
+    // Convert context settings
+    sf::ContextSettings params;
+    if (settings)
+    {
+        priv::sfContextSettings_writeToCpp(*settings, params);
+    }
+
+    // Create the window in its input thread
+    sfWindow* window = new sfWindow;
+    window->Events = new priv::EventQueue(window->This);
+    if (!window->Events->start(videoMode, title, style, params))
+    {
+        sfWindow_destroy(window);
+        return NULL;
+    }
+
+    return window;
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfWindow_destroy(sfWindow* window)
 {
+    // Stops the input thread, and waits until a consumer blocked in waitEvent has returned
+    if (window)
+        delete window->Events;
+
     delete window;
 }
 
 ////////////////////////////////////////////////////////////
 void sfWindow_close(sfWindow* window)
 {
-    CSFML_CALL(window, close());
+    CSFML_CHECK(window);
+
+    if (window->Events)
+        window->Events->close();
+    else
+        window->This.close();
 }
 
 
@@ -128,9 +192,23 @@ sfContextSettings sfWindow_getSettings(const sfWindow* window)
 ////////////////////////////////////////////////////////////
 sfBool sfWindow_pollEvent(sfWindow* window, sfEvent* event)
 {
+    CSFML_PROFILE_ZONE("sfWindow_pollEvent");
+
     CSFML_CHECK_RETURN(window, sfFalse);
     CSFML_CHECK_RETURN(event, sfFalse);
 
+    // Events of windows with an event queue go through it
+    if (window->Events)
+    {
+        sfTimedEvent timedEvent;
+        if (!window->Events->pop(timedEvent))
+            return sfFalse;
+
+        *event = timedEvent.event;
+        trackKeys(*window, event, 1);
+        return sfTrue;
+    }
+
     // Get the event
     sf::Event SFMLEvent;
     sfBool ret = window->This.pollEvent(SFMLEvent);
@@ -141,17 +219,71 @@ sfBool sfWindow_pollEvent(sfWindow* window, sfEvent* event)
 
     // Convert the sf::Event event to a sfEvent
     convertEvent(SFMLEvent, event);
+    trackKeys(*window, event, 1);
 
     return sfTrue;
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfWindow_pollEvents(sfWindow* window, sfEvent* events, size_t capacity)
+{
+    CSFML_PROFILE_ZONE("sfWindow_pollEvents");
+
+    CSFML_CHECK_RETURN(window, 0);
+    CSFML_CHECK_RETURN(events, 0);
+
+    if (window->Events)
+    {
+        std::size_t count = window->Events->pop(events, capacity, false);
+        trackKeys(*window, events, count);
+        return count;
+    }
+
+    std::size_t count = pollEvents(window->This, events, capacity, false);
+    trackKeys(*window, events, count);
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfWindow_pollEventsCoalesced(sfWindow* window, sfEvent* events, size_t capacity)
+{
+    CSFML_PROFILE_ZONE("sfWindow_pollEventsCoalesced");
+
+    CSFML_CHECK_RETURN(window, 0);
+    CSFML_CHECK_RETURN(events, 0);
+
+    if (window->Events)
+    {
+        std::size_t count = window->Events->pop(events, capacity, true);
+        trackKeys(*window, events, count);
+        return count;
+    }
+
+    std::size_t count = pollEvents(window->This, events, capacity, true);
+    trackKeys(*window, events, count);
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 sfBool sfWindow_waitEvent(sfWindow* window, sfEvent* event)
 {
     CSFML_CHECK_RETURN(window, sfFalse);
     CSFML_CHECK_RETURN(event, sfFalse);
 
+    if (window->Events)
+    {
+        sfTimedEvent timedEvent;
+        if (!window->Events->wait(timedEvent))
+            return sfFalse;
+
+        *event = timedEvent.event;
+        trackKeys(*window, event, 1);
+        return sfTrue;
+    }
+
     // Get the event
     sf::Event SFMLEvent;
     sfBool ret = window->This.waitEvent(SFMLEvent);
@@ -162,6 +294,35 @@ sfBool sfWindow_waitEvent(sfWindow* window, sfEvent* event)
 
     // Convert the sf::Event event to a sfEvent
     convertEvent(SFMLEvent, event);
+    trackKeys(*window, event, 1);
+
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfWindow_pollTimedEvent(sfWindow* window, sfTimedEvent* event)
+{
+    CSFML_CHECK_RETURN(window, sfFalse);
+    CSFML_CHECK_RETURN(event, sfFalse);
+
+    if (window->Events)
+    {
+        if (!window->Events->pop(*event))
+            return sfFalse;
+
+        trackKeys(*window, &event->event, 1);
+        return sfTrue;
+    }
+
+    // Without event queue, the event is received now
+    sf::Event SFMLEvent;
+    if (!window->This.pollEvent(SFMLEvent))
+        return sfFalse;
+
+    convertEvent(SFMLEvent, &event->event);
+    event->timestamp = priv::getMonotonicTime();
+    trackKeys(*window, &event->event, 1);
 
     return sfTrue;
 }
@@ -297,6 +458,8 @@ sfBool sfWindow_hasFocus(const sfWindow* window)
 ////////////////////////////////////////////////////////////
 void sfWindow_display(sfWindow* window)
 {
+    CSFML_PROFILE_ZONE("sfWindow_display");
+
     CSFML_CALL(window, display());
 }
 
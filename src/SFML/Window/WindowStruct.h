@@ -29,14 +29,32 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Window/Window.hpp>
+#include <SFML/Window/Keyboard.h>
+#include <SFML/ObjectAllocator.h>
+#include <algorithm>
+#include <cstddef>
+
+
+namespace priv
+{
+    class EventQueue;
+}
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfWindow
 ////////////////////////////////////////////////////////////
-struct sfWindow
+struct sfWindow : public priv::Allocated
 {
-    sf::Window This;
+    sfWindow() :
+    Events(NULL)
+    {
+        std::fill(Keys, Keys + sfKeyCount, sfFalse);
+    }
+
+    sf::Window         This;
+    priv::EventQueue*  Events;           ///< Queue of timestamped events, or NULL
+    sfBool             Keys[sfKeyCount]; ///< Keys pressed according to the events returned so far (written by the thread that consumes the events)
 };
 
 